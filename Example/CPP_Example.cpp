@@ -4,8 +4,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -31,6 +31,12 @@ namespace
         return ToLower(path.extension().string()) == ".hlsl";
     }
 
+    // Shaders under a "Library" directory are compiled and linked by CompileAndLinkLibrary and CompileWithLibraries.
+    bool IsLibraryExample(const std::filesystem::path& path)
+    {
+        return path.parent_path().filename() == "Library";
+    }
+
     std::string DetectOutputDirectory(const std::filesystem::path& inputPath)
     {
         const std::string normalized = ignite::PathToString(inputPath);
@@ -58,25 +64,6 @@ namespace
         return IGNITE_SHADER_TYPE_VERTEX;
     }
 
-    bool ReadBinaryFile(const std::filesystem::path& filePath, std::vector<uint8_t>& outBytes)
-    {
-        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-        if (!file)
-        {
-            return false;
-        }
-
-        const std::streamsize size = file.tellg();
-        if (size <= 0)
-        {
-            return false;
-        }
-
-        outBytes.resize(static_cast<size_t>(size));
-        file.seekg(0, std::ios::beg);
-        return file.read(reinterpret_cast<char*>(outBytes.data()), size).good();
-    }
-
     void PrintReflectionSummary(const char* label, const ignite::ShaderReflectionInfo& reflection)
     {
         std::cout
@@ -91,40 +78,99 @@ namespace
             << std::endl;
     }
 
-    bool ReflectAndPrint(const std::filesystem::path& outputPath, IGNITE_ShaderType shaderType, IGNITE_ShaderPlatformType platformType)
+    bool SameMembers(const std::vector<ignite::ShaderBufferMember>& a, const std::vector<ignite::ShaderBufferMember>& b)
     {
-        std::vector<uint8_t> bytes;
-        if (!ReadBinaryFile(outputPath, bytes))
-        {
-            std::cout << "  Reflection skipped (cannot read output): " << outputPath.generic_string() << std::endl;
-            return false;
-        }
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) {
+            return x.name == y.name && x.type == y.type && x.offset == y.offset && x.size == y.size && x.vecSize == y.vecSize
+                && x.columns == y.columns && x.arraySize == y.arraySize && x.arrayStride == y.arrayStride
+                && x.matrixStride == y.matrixStride && x.depth == y.depth && x.rowMajor == y.rowMajor;
+        });
+    }
 
-        try
-        {
-            if (platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV)
-            {
-                ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::SPIRVReflect(shaderType, bytes);
-                PrintReflectionSummary("SPIRV", reflection);
-                return true;
-            }
+    bool SameResources(const std::vector<ignite::ShaderResourceInfo>& a, const std::vector<ignite::ShaderResourceInfo>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) {
+            return x.name == y.name && x.id == y.id && x.set == y.set && x.binding == y.binding && x.count == y.count
+                && x.unbounded == y.unbounded && x.size == y.size && SameMembers(x.members, y.members);
+        });
+    }
+
+    bool SameStageIO(const std::vector<ignite::ShaderStageIOInfo>& a, const std::vector<ignite::ShaderStageIOInfo>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) {
+            return x.name == y.name && x.id == y.id && x.location == y.location && x.component == y.component && x.format == y.format
+                && x.vecSize == y.vecSize && x.columns == y.columns;
+        });
+    }
 
-            if (platformType == IGNITE_SHADER_PLATFORM_TYPE_DXIL)
+    bool SameCompute(const ignite::ShaderComputeInfo& a, const ignite::ShaderComputeInfo& b)
+    {
+        return std::equal(std::begin(a.localSize), std::end(a.localSize), std::begin(b.localSize))
+            && std::equal(std::begin(a.localSizeSpecialized), std::end(a.localSizeSpecialized), std::begin(b.localSizeSpecialized))
+            && std::equal(std::begin(a.localSizeSpecIds), std::end(a.localSizeSpecIds), std::begin(b.localSizeSpecIds))
+            && a.sharedMemorySize == b.sharedMemorySize;
+    }
+
+    // Checks the native SPIR-V parser against the SPIRV-Cross reference backend, field by field.
+    bool MatchesReferenceReflection(IGNITE_ShaderType shaderType, const std::vector<uint8_t>& bytes, const ignite::ShaderReflectionInfo& native)
+    {
+        const ignite::ShaderReflectionInfo reference =
+            ignite::ShaderReflection::SPIRVReflect(shaderType, bytes, IGNITE_SPIRV_REFLECTION_BACKEND_SPIRV_CROSS);
+
+        const bool samePushConstants = std::equal(native.pushConstants.begin(), native.pushConstants.end(),
+            reference.pushConstants.begin(), reference.pushConstants.end(), [](const auto& x, const auto& y) {
+                return x.name == y.name && x.size == y.size && SameMembers(x.members, y.members);
+            });
+
+        const bool sameVertexAttributes = std::equal(native.vertexAttributes.begin(), native.vertexAttributes.end(),
+            reference.vertexAttributes.begin(), reference.vertexAttributes.end(), [](const auto& x, const auto& y) {
+                return x.name == y.name && x.format == y.format && x.bufferIndex == y.bufferIndex && x.offset == y.offset
+                    && x.elementStride == y.elementStride;
+            });
+
+        const bool sameVertexBuffers = std::equal(native.vertexBuffers.begin(), native.vertexBuffers.end(),
+            reference.vertexBuffers.begin(), reference.vertexBuffers.end(), [](const auto& x, const auto& y) {
+                return x.bufferIndex == y.bufferIndex && x.stride == y.stride && x.inputRate == y.inputRate && x.stepRate == y.stepRate;
+            });
+
+        const bool sameSpecializationConstants = std::equal(native.specializationConstants.begin(), native.specializationConstants.end(),
+            reference.specializationConstants.begin(), reference.specializationConstants.end(), [](const auto& x, const auto& y) {
+                return x.name == y.name && x.id == y.id && x.constantId == y.constantId && x.type == y.type && x.defaultValue == y.defaultValue;
+            });
+
+        return native.shaderType == reference.shaderType
+            && SameResources(native.uniformBuffers, reference.uniformBuffers)
+            && SameResources(native.sampledImages, reference.sampledImages)
+            && SameResources(native.storageImages, reference.storageImages)
+            && SameResources(native.storageBuffers, reference.storageBuffers)
+            && SameResources(native.separateSamplers, reference.separateSamplers)
+            && SameResources(native.separateImages, reference.separateImages)
+            && SameStageIO(native.stageInputs, reference.stageInputs)
+            && SameStageIO(native.stageOutputs, reference.stageOutputs)
+            && samePushConstants
+            && sameVertexAttributes
+            && sameVertexBuffers
+            && sameSpecializationConstants
+            && SameCompute(native.compute, reference.compute);
+    }
+
+    bool PrintReflection(const std::filesystem::path& inputPath, const ignite::CompiledShader& compiled, IGNITE_ShaderPlatformType platformType)
+    {
+        if (platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV)
+        {
+            PrintReflectionSummary("SPIRV", compiled.reflection);
+            if (!MatchesReferenceReflection(compiled.reflection.shaderType, compiled.code, compiled.reflection))
             {
-                ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::DXILReflect(shaderType, bytes);
-                PrintReflectionSummary("DXIL", reflection);
-                return true;
+                std::cout << "  Native SPIRV reflection differs from SPIRV-Cross: " << inputPath.generic_string() << std::endl;
+                return false;
             }
+            return true;
         }
-        catch (const std::exception& ex)
-        {
-            std::cout << "  Reflection failed for " << outputPath.generic_string() << " -> " << ex.what() << std::endl;
-            return false;
-        }
-        catch (...)
+
+        if (platformType == IGNITE_SHADER_PLATFORM_TYPE_DXIL)
         {
-            std::cout << "  Reflection failed for " << outputPath.generic_string() << std::endl;
-            return false;
+            PrintReflectionSummary("DXIL", compiled.reflection);
+            return true;
         }
 
         return false;
@@ -150,31 +196,20 @@ namespace
         options.bRegShift = 0;
         options.uRegShift = 0;
 
-        std::vector<uint8_t> output;
-        try
+#if !defined(_WIN32)
+        if (IsHlslFile(inputPath))
         {
-            if (IsHlslFile(inputPath))
-            {
-#if defined(_WIN32)
-                std::shared_ptr<ignite::DXCInstance> dxc = ignite::ShaderCompiler::CreateDXCCompiler();
-                if (!dxc)
-                {
-                    std::cout << "Compile (" << IGNITE_ShaderPlatformToString(platformType) << ") "
-                              << inputPath.generic_string() << " -> failed (CreateDXCCompiler)" << std::endl;
-                    return false;
-                }
-
-                output = ignite::ShaderCompiler::CompileDXC(dxc, options);
-#else
-                std::cout << "Compile (" << IGNITE_ShaderPlatformToString(platformType) << ") "
-                          << inputPath.generic_string() << " -> unsupported platform" << std::endl;
-                return false;
+            std::cout << "Compile (" << IGNITE_ShaderPlatformToString(platformType) << ") "
+                      << inputPath.generic_string() << " -> unsupported platform" << std::endl;
+            return false;
+        }
 #endif
-            }
-            else
-            {
-                output = ignite::ShaderCompiler::CompileGLSL(options);
-            }
+
+        ignite::CompiledShader compiled;
+        try
+        {
+            // Compiles and reflects the in-memory blob; the output file is only written for the engine.
+            compiled = ignite::ShaderCompiler::CompileAndReflect(options);
         }
         catch (const std::exception& ex)
         {
@@ -189,7 +224,7 @@ namespace
             return false;
         }
 
-        const bool ok = !output.empty();
+        const bool ok = static_cast<bool>(compiled);
         std::cout << "Compile (" << IGNITE_ShaderPlatformToString(platformType) << ") "
                   << inputPath.generic_string() << " -> " << (ok ? "OK" : "FAILED") << std::endl;
         if (!ok)
@@ -197,10 +232,132 @@ namespace
             return false;
         }
 
-        const std::filesystem::path outputPath =
-            outputDirectory / inputPath.filename().replace_extension(IGNITE_ShaderPlatformExtension(platformType));
+        return PrintReflection(inputPath, compiled, platformType);
+    }
+
+    // Compiles tonemap.lib.hlsl into a SPIR-V library and tonemap.pixel.hlsl, which imports its
+    // ToneMapACES, then links the two. The link only resolves the import; the optimizer run after
+    // it inlines the library call into the entry point.
+    bool CompileAndLinkLibrary(const std::filesystem::path& libraryDirectory)
+    {
+        const std::filesystem::path libraryPath = libraryDirectory / "tonemap.lib.hlsl";
+        const std::filesystem::path entryPath = libraryDirectory / "tonemap.pixel.hlsl";
+
+#if !defined(_WIN32)
+        std::cout << "Link (SPIRV) " << entryPath.generic_string() << " + " << libraryPath.generic_string()
+                  << " -> unsupported platform" << std::endl;
+        return false;
+#endif
+
+        ignite::CompilerOptions options = {};
+        options.compilerType = IGNITE_SHADER_COMPILER_TYPE_DXC;
+        options.platformType = IGNITE_SHADER_PLATFORM_TYPE_SPIRV;
+        options.shaderDesc.shaderModel = "6_5";
+        options.shaderDesc.vulkanVersion = "1.3";
+        options.shaderDesc.shaderType = IGNITE_SHADER_TYPE_PIXEL;
+        options.shaderDesc.optLevel = IGNITE_OPT_LEVEL_3;
+        options.tRegShift = 0;
+        options.sRegShift = 0;
+        options.bRegShift = 0;
+        options.uRegShift = 0;
+        options.binary = false; // both modules are intermediates; only the linked result is a shader
+        options.binaryBlob = false;
+
+        // The entry shader compiles as a library too, so its bodiless declaration stays an import.
+        options.filepath = libraryPath;
+        const std::vector<uint8_t> library = ignite::ShaderCompiler::CompileLibrary(options);
+        options.filepath = entryPath;
+        const std::vector<uint8_t> entry = ignite::ShaderCompiler::CompileLibrary(options);
+
+        const std::vector<uint8_t> linked = ignite::ShaderCompiler::LinkSPIRV({ entry, library });
+        const std::vector<uint8_t> optimized = linked.empty()
+            ? std::vector<uint8_t>()
+            : ignite::ShaderCompiler::OptimizeSPIRV(linked, IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE);
+
+        const bool ok = !library.empty() && !entry.empty() && !optimized.empty();
+        std::cout << "Link (SPIRV) " << entryPath.generic_string() << " + " << libraryPath.generic_string()
+                  << " -> " << (ok ? "OK" : "FAILED") << std::endl;
+        if (!ok)
+        {
+            return false;
+        }
+
+        PrintReflectionSummary("Linked SPIRV", ignite::ShaderReflection::SPIRVReflect(IGNITE_SHADER_TYPE_PIXEL, optimized));
+        return true;
+    }
+
+    // True for an executable SPIR-V module: it has an entry point and no Linkage capability left.
+    bool IsLinkedShader(const std::vector<uint8_t>& code)
+    {
+        constexpr uint32_t kOpCapability = 17;
+        constexpr uint32_t kOpEntryPoint = 15;
+        constexpr uint32_t kCapabilityLinkage = 5;
+        constexpr size_t kHeaderWordCount = 5;
+
+        std::vector<uint32_t> words(code.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), code.data(), words.size() * sizeof(uint32_t));
 
-        return ReflectAndPrint(outputPath, shaderType, platformType);
+        bool hasEntryPoint = false;
+        for (size_t i = kHeaderWordCount; i < words.size();)
+        {
+            const uint32_t opcode = words[i] & 0xFFFFu;
+            const uint32_t wordCount = words[i] >> 16;
+            if (wordCount == 0 || i + wordCount > words.size())
+            {
+                return false;
+            }
+            if (opcode == kOpCapability && wordCount > 1 && words[i + 1] == kCapabilityLinkage)
+            {
+                return false;
+            }
+            hasEntryPoint = hasEntryPoint || opcode == kOpEntryPoint;
+            i += wordCount;
+        }
+        return hasEntryPoint;
+    }
+
+    // Builds the same pair through CompilerOptions::spirvLibraries: the library compiles through the
+    // cache, the entry shader compiles with the lib profile and CompileAndReflect links, optimizes
+    // and reflects the result.
+    bool CompileWithLibraries(const std::filesystem::path& libraryDirectory, const std::filesystem::path& outputDirectory)
+    {
+        const std::filesystem::path libraryPath = libraryDirectory / "tonemap.lib.hlsl";
+        const std::filesystem::path entryPath = libraryDirectory / "tonemap.pixel.hlsl";
+
+#if !defined(_WIN32)
+        std::cout << "Compile (SPIRV) " << entryPath.generic_string() << " with " << libraryPath.generic_string()
+                  << " -> unsupported platform" << std::endl;
+        return false;
+#endif
+
+        ignite::ShaderLibraryCache libraryCache;
+        ignite::CompilerOptions options = {};
+        options.compilerType = IGNITE_SHADER_COMPILER_TYPE_DXC;
+        options.platformType = IGNITE_SHADER_PLATFORM_TYPE_SPIRV;
+        options.filepath = entryPath;
+        options.outputFilepath = outputDirectory;
+        options.shaderDesc.shaderModel = "6_5";
+        options.shaderDesc.vulkanVersion = "1.3";
+        options.shaderDesc.shaderType = IGNITE_SHADER_TYPE_PIXEL;
+        options.shaderDesc.optLevel = IGNITE_OPT_LEVEL_3;
+        options.tRegShift = 0;
+        options.sRegShift = 0;
+        options.bRegShift = 0;
+        options.uRegShift = 0;
+        options.spirvLibraries = { libraryPath };
+        options.libraryCache = &libraryCache;
+
+        const ignite::CompiledShader compiled = ignite::ShaderCompiler::CompileAndReflect(options);
+        const bool ok = static_cast<bool>(compiled) && IsLinkedShader(compiled.code) && libraryCache.GetSize() == 1;
+        std::cout << "Compile (SPIRV) " << entryPath.generic_string() << " with " << libraryPath.generic_string()
+                  << " -> " << (ok ? "OK" : "FAILED") << std::endl;
+        if (!ok)
+        {
+            return false;
+        }
+
+        PrintReflectionSummary("Linked SPIRV", compiled.reflection);
+        return true;
     }
 
     void OnCompilerLog(IGNITE_LogType type, const char* message, void*)
@@ -237,7 +394,7 @@ int main()
         }
 
         const std::filesystem::path inputPath = entry.path();
-        if (!IsShaderSourceFile(inputPath))
+        if (!IsShaderSourceFile(inputPath) || IsLibraryExample(inputPath))
         {
             continue;
         }
@@ -268,6 +425,25 @@ int main()
         }
     }
 
+    if (CompileAndLinkLibrary(shaderRoot / "HLSL" / "Library"))
+    {
+        compiledCount++;
+    }
+    else
+    {
+        failedCount++;
+    }
+
+    std::filesystem::create_directories("Shaders/Compiled/HSLSL");
+    if (CompileWithLibraries(shaderRoot / "HLSL" / "Library", "Shaders/Compiled/HSLSL"))
+    {
+        compiledCount++;
+    }
+    else
+    {
+        failedCount++;
+    }
+
     std::cout << "Compiled: " << compiledCount << ", Failed: " << failedCount << std::endl;
     ignite::ShaderCompiler::ClearLogCallback();
 
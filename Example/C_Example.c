@@ -159,89 +159,6 @@ static IGNITE_ShaderType DetectShaderTypeFromFilename(const char* filename)
     return IGNITE_SHADER_TYPE_VERTEX;
 }
 
-static const char* GetFileNameFromPath(const char* path)
-{
-    const char* slash = strrchr(path, '/');
-    const char* backslash = strrchr(path, '\\');
-    const char* fileName = slash;
-    if (backslash != NULL && (fileName == NULL || backslash > fileName))
-    {
-        fileName = backslash;
-    }
-
-    return (fileName == NULL) ? path : (fileName + 1);
-}
-
-static int BuildOutputPath(char* outputPath, size_t outputPathSize, const char* outputDirectory, const char* inputPath, IGNITE_ShaderPlatformType platformType)
-{
-    const char* inputFileName = GetFileNameFromPath(inputPath);
-    char baseName[256] = {0};
-    snprintf(baseName, sizeof(baseName), "%s", inputFileName);
-
-    char* dot = strrchr(baseName, '.');
-    if (dot != NULL)
-    {
-        *dot = '\0';
-    }
-
-    return snprintf(outputPath, outputPathSize, "%s/%s%s", outputDirectory, baseName, IGNITE_ShaderPlatformExtension(platformType)) > 0;
-}
-
-static int ReadBinaryFile(const char* filePath, unsigned char** outData, size_t* outSize)
-{
-    FILE* file = fopen(filePath, "rb");
-    long fileSize;
-    size_t readSize;
-    unsigned char* data;
-
-    *outData = NULL;
-    *outSize = 0;
-
-    if (file == NULL)
-    {
-        return 0;
-    }
-
-    if (fseek(file, 0, SEEK_END) != 0)
-    {
-        fclose(file);
-        return 0;
-    }
-
-    fileSize = ftell(file);
-    if (fileSize <= 0)
-    {
-        fclose(file);
-        return 0;
-    }
-
-    if (fseek(file, 0, SEEK_SET) != 0)
-    {
-        fclose(file);
-        return 0;
-    }
-
-    data = (unsigned char*)malloc((size_t)fileSize);
-    if (data == NULL)
-    {
-        fclose(file);
-        return 0;
-    }
-
-    readSize = fread(data, 1, (size_t)fileSize, file);
-    fclose(file);
-
-    if (readSize != (size_t)fileSize)
-    {
-        free(data);
-        return 0;
-    }
-
-    *outData = data;
-    *outSize = readSize;
-    return 1;
-}
-
 static void PrintReflectionSummary(const char* label, const IgniteShaderReflectionInfo* reflection)
 {
     printf("  [%s Reflection] type=%s, UBO=%zu, Samplers=%zu, StorageTex=%zu, StorageBuf=%zu, Inputs=%zu, Outputs=%zu, PushConstants=%zu\n",
@@ -256,61 +173,11 @@ static void PrintReflectionSummary(const char* label, const IgniteShaderReflecti
         reflection->numPushConstants);
 }
 
-static int ReflectAndPrint(const char* outputPath, IGNITE_ShaderType shaderType, IGNITE_ShaderPlatformType platformType)
-{
-    unsigned char* binaryData = NULL;
-    size_t binarySize = 0;
-    IgniteShaderReflectionInfo reflectionInfo;
-    IGNITE_ResultCode result;
-
-    if (!ReadBinaryFile(outputPath, &binaryData, &binarySize))
-    {
-        printf("  Reflection skipped (cannot read output): %s\n", outputPath);
-        return 0;
-    }
-
-    memset(&reflectionInfo, 0, sizeof(reflectionInfo));
-
-    if (platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV)
-    {
-        if ((binarySize % 4) != 0)
-        {
-            printf("  Reflection failed for %s (SPIRV size must be 4-byte aligned).\n", outputPath);
-            free(binaryData);
-            return 0;
-        }
-        result = IgniteCompiler_ReflectSPIRV((const uint32_t*)binaryData, binarySize, shaderType, &reflectionInfo);
-        if (result == IGNITE_RESULT_OK)
-        {
-            PrintReflectionSummary("SPIRV", &reflectionInfo);
-        }
-    }
-    else
-    {
-        result = IgniteCompiler_ReflectDXIL(binaryData, binarySize, shaderType, &reflectionInfo);
-        if (result == IGNITE_RESULT_OK)
-        {
-            PrintReflectionSummary("DXIL", &reflectionInfo);
-        }
-    }
-
-    if (result != IGNITE_RESULT_OK)
-    {
-        printf("  Reflection failed for %s -> %d\n", outputPath, (int)result);
-        free(binaryData);
-        return 0;
-    }
-
-    IgniteCompiler_FreeReflectionInfo(&reflectionInfo);
-    free(binaryData);
-    return 1;
-}
-
 static int CompileAndReflect(const char* inputPath, const char* outputDirectory, IGNITE_ShaderType shaderType, IGNITE_ShaderPlatformType platformType)
 {
     IgniteCompileRequest request = {0};
-    char outputPath[1024] = {0};
-    IGNITE_ResultCode compileResult;
+    IgniteCompiledShader compiled;
+    IGNITE_ResultCode result;
 
     request.inputPath = inputPath;
     request.outputDirectory = outputDirectory;
@@ -325,20 +192,17 @@ static int CompileAndReflect(const char* inputPath, const char* outputDirectory,
     request.rRegShift = 0;
     request.uRegShift = 0;
 
-    compileResult = IgniteCompiler_Compile(&request);
-    printf("Compile (%s) %s -> %d\n", IGNITE_ShaderPlatformToString(platformType), inputPath, (int)compileResult);
-    if (compileResult != IGNITE_RESULT_OK)
-    {
-        return 0;
-    }
-
-    if (!BuildOutputPath(outputPath, sizeof(outputPath), outputDirectory, inputPath, platformType))
+    /* Compiles and reflects the in-memory blob; no need to read the output file back. */
+    result = IgniteCompiler_CompileAndReflect(&request, &compiled);
+    printf("Compile (%s) %s -> %d\n", IGNITE_ShaderPlatformToString(platformType), inputPath, (int)result);
+    if (result != IGNITE_RESULT_OK)
     {
-        printf("  Failed to build output path for reflection.\n");
         return 0;
     }
 
-    return ReflectAndPrint(outputPath, shaderType, platformType);
+    PrintReflectionSummary(platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV ? "SPIRV" : "DXIL", &compiled.reflection);
+    IgniteCompiler_FreeCompiledShader(&compiled);
+    return 1;
 }
 
 int main(void)
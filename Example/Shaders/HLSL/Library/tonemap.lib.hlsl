@@ -0,0 +1,12 @@
+// Compiled as a SPIR-V library (lib profile, no entry point). Exported functions keep an Export
+// LinkageAttributes decoration, which the shaders that import them are linked against.
+
+export float3 ToneMapACES(float3 color)
+{
+    const float a = 2.51f;
+    const float b = 0.03f;
+    const float c = 2.43f;
+    const float d = 0.59f;
+    const float e = 0.14f;
+    return saturate((color * (a * color + b)) / (color * (c * color + d) + e));
+}
@@ -0,0 +1,21 @@
+// Imports ToneMapACES from tonemap.lib.hlsl. Compiled with a lib profile, a function declared
+// without a body becomes an Import LinkageAttributes declaration, resolved when the two modules
+// are linked.
+float3 ToneMapACES(float3 color);
+
+Texture2D sceneTexture : register(t0);
+SamplerState sceneSampler : register(s0);
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float2 texCoord : TEXCOORD;
+};
+
+// Lib profiles take no entry point argument; the attribute names the entry point and its stage.
+[shader("pixel")]
+float4 main(PSInput input) : SV_TARGET0
+{
+    float3 color = sceneTexture.Sample(sceneSampler, input.texCoord).rgb;
+    return float4(ToneMapACES(color), 1.0f);
+}
@@ -0,0 +1,484 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "SPIRVLinker.h"
+#include "SPIRVModule.h"
+#include "SPIRVOptimizer.h"
+#include "ShaderLog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <spirv-tools/libspirv.h>
+
+namespace ignite::spirv
+{
+    namespace
+    {
+        // Linked ids must stay below the limit SPIRV-Tools accepts.
+        constexpr uint32_t kMaxLinkedIdBound = 0x3FFFFF;
+
+        bool IsIdOperand(spv_operand_type_t type)
+        {
+            switch (type)
+            {
+            case SPV_OPERAND_TYPE_ID:
+            case SPV_OPERAND_TYPE_TYPE_ID:
+            case SPV_OPERAND_TYPE_RESULT_ID:
+            case SPV_OPERAND_TYPE_MEMORY_SEMANTICS_ID:
+            case SPV_OPERAND_TYPE_SCOPE_ID:
+            case SPV_OPERAND_TYPE_OPTIONAL_ID:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        struct IdRewrite
+        {
+            std::vector<uint32_t>* output = nullptr;
+            const std::function<uint32_t(uint32_t)>* map = nullptr;
+            size_t offset = kHeaderWordCount; // the parser hands out copies, so positions are tracked here
+        };
+
+        spv_result_t RewriteInstructionIds(void* userData, const spv_parsed_instruction_t* instruction)
+        {
+            IdRewrite& rewrite = *static_cast<IdRewrite*>(userData);
+            uint32_t* words = rewrite.output->data() + rewrite.offset;
+            for (uint16_t i = 0; i < instruction->num_operands; ++i)
+            {
+                const spv_parsed_operand_t& operand = instruction->operands[i];
+                if (IsIdOperand(operand.type))
+                {
+                    words[operand.offset] = (*rewrite.map)(words[operand.offset]);
+                }
+            }
+            rewrite.offset += instruction->num_words;
+            return SPV_SUCCESS;
+        }
+
+        // Instructions of one or more modules, grouped by the section of the logical layout they belong to.
+        struct Sections
+        {
+            std::vector<uint32_t> capabilities; // capability values, first occurrence order
+            std::vector<std::string> extensions;
+            std::vector<uint32_t> extInstImports;
+            std::vector<uint32_t> memoryModel;
+            std::vector<uint32_t> entryPoints;
+            std::vector<uint32_t> executionModes;
+            std::vector<uint32_t> debugSources; // OpString, OpSource*
+            std::vector<uint32_t> debugNames;
+            std::vector<uint32_t> debugProcessed;
+            std::vector<uint32_t> annotations;
+            std::vector<uint32_t> declarations;
+            std::vector<uint32_t> functionDeclarations; // functions without a body (imports) precede definitions
+            std::vector<uint32_t> functionDefinitions;
+        };
+
+        void Append(std::vector<uint32_t>& section, const Instruction& instruction)
+        {
+            section.insert(section.end(), instruction.words, instruction.words + instruction.wordCount);
+        }
+
+        bool SplitSections(const std::vector<uint32_t>& words, size_t moduleIndex, Sections& sections)
+        {
+            std::vector<uint32_t> function;
+            bool inFunction = false;
+            bool hasBody = false;
+            bool valid = true;
+
+            const bool walked = ForEachInstruction(words.data(), words.size(), [&](const Instruction& instruction) {
+                if (inFunction)
+                {
+                    Append(function, instruction);
+                    hasBody = hasBody || instruction.opcode == SpvOpLabel;
+                    if (instruction.opcode == SpvOpFunctionEnd)
+                    {
+                        std::vector<uint32_t>& target = hasBody ? sections.functionDefinitions : sections.functionDeclarations;
+                        target.insert(target.end(), function.begin(), function.end());
+                        function.clear();
+                        inFunction = false;
+                    }
+                    return true;
+                }
+
+                switch (instruction.opcode)
+                {
+                case SpvOpCapability:
+                    if (std::find(sections.capabilities.begin(), sections.capabilities.end(), instruction.Operand(0)) == sections.capabilities.end())
+                    {
+                        sections.capabilities.push_back(instruction.Operand(0));
+                    }
+                    break;
+                case SpvOpExtension:
+                {
+                    std::string extension(ReadString(instruction, 1));
+                    if (std::find(sections.extensions.begin(), sections.extensions.end(), extension) == sections.extensions.end())
+                    {
+                        sections.extensions.push_back(std::move(extension));
+                    }
+                    break;
+                }
+                case SpvOpExtInstImport:
+                    Append(sections.extInstImports, instruction);
+                    break;
+                case SpvOpMemoryModel:
+                    if (sections.memoryModel.empty())
+                    {
+                        Append(sections.memoryModel, instruction);
+                    }
+                    else if (!std::equal(instruction.words, instruction.words + instruction.wordCount, sections.memoryModel.begin(), sections.memoryModel.end()))
+                    {
+                        DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: module " + std::to_string(moduleIndex) + " uses a different memory model.");
+                        valid = false;
+                        return false;
+                    }
+                    break;
+                case SpvOpEntryPoint:
+                    Append(sections.entryPoints, instruction);
+                    break;
+                case SpvOpExecutionMode:
+                case SpvOpExecutionModeId:
+                    Append(sections.executionModes, instruction);
+                    break;
+                case SpvOpString:
+                case SpvOpSource:
+                case SpvOpSourceContinued:
+                case SpvOpSourceExtension:
+                    Append(sections.debugSources, instruction);
+                    break;
+                case SpvOpName:
+                case SpvOpMemberName:
+                    Append(sections.debugNames, instruction);
+                    break;
+                case SpvOpModuleProcessed:
+                    Append(sections.debugProcessed, instruction);
+                    break;
+                case SpvOpDecorate:
+                case SpvOpMemberDecorate:
+                case SpvOpDecorationGroup:
+                case SpvOpGroupDecorate:
+                case SpvOpGroupMemberDecorate:
+                case SpvOpDecorateId:
+                case SpvOpDecorateString:
+                case SpvOpMemberDecorateString:
+                    Append(sections.annotations, instruction);
+                    break;
+                case SpvOpFunction:
+                    Append(function, instruction);
+                    inFunction = true;
+                    hasBody = false;
+                    break;
+                default:
+                    Append(sections.declarations, instruction);
+                    break;
+                }
+                return true;
+            });
+
+            if (!walked || inFunction)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: module " + std::to_string(moduleIndex) + " is malformed.");
+                return false;
+            }
+            return valid;
+        }
+
+        void AppendInstruction(std::vector<uint32_t>& output, SpvOp opcode, std::initializer_list<uint32_t> operands)
+        {
+            output.push_back((uint32_t(operands.size() + 1) << SpvWordCountShift) | uint32_t(opcode));
+            output.insert(output.end(), operands.begin(), operands.end());
+        }
+
+        void AppendStringInstruction(std::vector<uint32_t>& output, SpvOp opcode, const std::string& text)
+        {
+            const uint32_t stringWords = uint32_t(text.size() / sizeof(uint32_t) + 1);
+            output.push_back(((stringWords + 1) << SpvWordCountShift) | uint32_t(opcode));
+            const size_t first = output.size();
+            output.resize(first + stringWords, 0);
+            std::memcpy(output.data() + first, text.data(), text.size());
+        }
+
+        enum class LinkageKind
+        {
+            Function,
+            Variable,
+        };
+
+        struct LinkageSymbol
+        {
+            uint32_t id = 0;
+            std::string name;
+            uint32_t linkageType = SpvLinkageTypeExport;
+        };
+
+        struct SymbolType
+        {
+            LinkageKind kind = LinkageKind::Function;
+            uint32_t resultType = 0; // function return type or variable pointer type
+            uint32_t functionType = 0;
+        };
+    }
+
+    bool RewriteIds(const uint32_t* words, size_t wordCount, const std::function<uint32_t(uint32_t)>& map, std::vector<uint32_t>& output)
+    {
+        output.clear();
+        if (!HasValidHeader(words, wordCount))
+        {
+            return false;
+        }
+
+        spv_context context = spvContextCreate(SPV_ENV_UNIVERSAL_1_6);
+        if (!context)
+        {
+            return false;
+        }
+
+        output.assign(words, words + wordCount);
+        IdRewrite rewrite;
+        rewrite.output = &output;
+        rewrite.map = &map;
+
+        spv_diagnostic diagnostic = nullptr;
+        const spv_result_t result = spvBinaryParse(context, &rewrite, words, wordCount, nullptr, RewriteInstructionIds, &diagnostic);
+        if (result != SPV_SUCCESS)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V parse failed: " + std::string(diagnostic && diagnostic->error ? diagnostic->error : "invalid module"));
+            output.clear();
+        }
+
+        spvDiagnosticDestroy(diagnostic);
+        spvContextDestroy(context);
+        return result == SPV_SUCCESS;
+    }
+
+    bool LinkModules(const std::vector<LinkInput>& modules, bool createLibrary, std::vector<uint32_t>& output)
+    {
+        output.clear();
+        if (modules.empty())
+        {
+            return false;
+        }
+
+        // Each module's ids move past the previous modules', so the sections can simply be concatenated.
+        Sections sections;
+        uint32_t version = 0;
+        uint32_t idBase = 0;
+        for (size_t i = 0; i < modules.size(); ++i)
+        {
+            const LinkInput& module = modules[i];
+            if (!HasValidHeader(module.words, module.wordCount) || module.words[3] == 0)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: module " + std::to_string(i) + " is not a SPIR-V module.");
+                return false;
+            }
+
+            if (uint64_t(idBase) + module.words[3] > kMaxLinkedIdBound)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: the linked module would exceed the id limit.");
+                return false;
+            }
+
+            std::vector<uint32_t> shifted;
+            const uint32_t base = idBase;
+            if (!RewriteIds(module.words, module.wordCount, [base](uint32_t id) { return id + base; }, shifted)
+                || !SplitSections(shifted, i, sections))
+            {
+                return false;
+            }
+
+            version = std::max(version, module.words[1]);
+            idBase += module.words[3] - 1;
+        }
+
+        if (sections.memoryModel.empty())
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: no module declares a memory model.");
+            return false;
+        }
+
+        std::vector<uint32_t> merged = { SpvMagicNumber, version, modules.front().words[2], idBase + 1, 0 };
+        for (uint32_t capability : sections.capabilities)
+        {
+            AppendInstruction(merged, SpvOpCapability, { capability });
+        }
+        for (const std::string& extension : sections.extensions)
+        {
+            AppendStringInstruction(merged, SpvOpExtension, extension);
+        }
+        for (const std::vector<uint32_t>* section : { &sections.extInstImports, &sections.memoryModel, &sections.entryPoints,
+            &sections.executionModes, &sections.debugSources, &sections.debugNames, &sections.debugProcessed, &sections.annotations,
+            &sections.declarations, &sections.functionDeclarations, &sections.functionDefinitions })
+        {
+            merged.insert(merged.end(), section->begin(), section->end());
+        }
+
+        // Every module brought its own types; they are only comparable by id once the duplicates are folded.
+        // The merge is not valid SPIR-V until then, so the validator stays off for this run.
+        std::vector<uint32_t> deduplicated;
+        if (!RunOptimizer(merged.data(), merged.size(), { "--remove-duplicates" }, deduplicated, false))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: could not merge duplicate declarations.");
+            return false;
+        }
+
+        std::vector<LinkageSymbol> symbols;
+        std::unordered_map<uint32_t, SymbolType> types;
+        ForEachInstruction(deduplicated.data(), deduplicated.size(), [&](const Instruction& instruction) {
+            if (instruction.opcode == SpvOpDecorate && instruction.Operand(1) == SpvDecorationLinkageAttributes)
+            {
+                uint32_t nameWords = 0;
+                LinkageSymbol symbol;
+                symbol.id = instruction.Operand(0);
+                symbol.name = std::string(ReadString(instruction, 3, &nameWords));
+                symbol.linkageType = instruction.Operand(2 + nameWords);
+                symbols.push_back(std::move(symbol));
+            }
+            else if (instruction.opcode == SpvOpFunction)
+            {
+                types[instruction.Operand(1)] = { LinkageKind::Function, instruction.Operand(0), instruction.Operand(3) };
+            }
+            else if (instruction.opcode == SpvOpVariable && instruction.Operand(2) != SpvStorageClassFunction)
+            {
+                types[instruction.Operand(1)] = { LinkageKind::Variable, instruction.Operand(0), 0 };
+            }
+            return true;
+        });
+
+        bool valid = true;
+        std::unordered_map<std::string, uint32_t> exports;
+        for (const LinkageSymbol& symbol : symbols)
+        {
+            if (symbol.linkageType != SpvLinkageTypeImport && !exports.emplace(symbol.name, symbol.id).second)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: '" + symbol.name + "' is exported more than once.");
+                valid = false;
+            }
+        }
+
+        std::unordered_map<uint32_t, uint32_t> replacements; // import id -> export id
+        for (const LinkageSymbol& symbol : symbols)
+        {
+            if (symbol.linkageType != SpvLinkageTypeImport)
+            {
+                continue;
+            }
+
+            auto exported = exports.find(symbol.name);
+            if (exported == exports.end())
+            {
+                if (!createLibrary)
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: unresolved import '" + symbol.name + "'.");
+                    valid = false;
+                }
+                continue;
+            }
+
+            const SymbolType& importType = types[symbol.id];
+            const SymbolType& exportType = types[exported->second];
+            if (importType.kind != exportType.kind || importType.resultType != exportType.resultType || importType.functionType != exportType.functionType)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: import '" + symbol.name + "' does not match the type of its export.");
+                valid = false;
+                continue;
+            }
+            replacements[symbol.id] = exported->second;
+        }
+
+        if (!valid)
+        {
+            return false;
+        }
+
+        // Resolved imports go away together with their parameters and everything that names or decorates them.
+        std::unordered_set<uint32_t> removed;
+        for (const auto& [importId, exportId] : replacements)
+        {
+            removed.insert(importId);
+        }
+        bool inRemovedFunction = false;
+        ForEachInstruction(deduplicated.data(), deduplicated.size(), [&](const Instruction& instruction) {
+            if (instruction.opcode == SpvOpFunction)
+            {
+                inRemovedFunction = removed.count(instruction.Operand(1)) != 0;
+            }
+            else if (instruction.opcode == SpvOpFunctionParameter && inRemovedFunction)
+            {
+                removed.insert(instruction.Operand(1));
+            }
+            return true;
+        });
+
+        std::vector<uint32_t> resolved(deduplicated.begin(), deduplicated.begin() + kHeaderWordCount);
+        resolved.reserve(deduplicated.size());
+        inRemovedFunction = false;
+        ForEachInstruction(deduplicated.data(), deduplicated.size(), [&](const Instruction& instruction) {
+            bool keep = true;
+            switch (instruction.opcode)
+            {
+            case SpvOpCapability:
+                keep = createLibrary || instruction.Operand(0) != SpvCapabilityLinkage;
+                break;
+            case SpvOpName:
+            case SpvOpMemberName:
+            case SpvOpDecorateId:
+            case SpvOpDecorateString:
+                keep = !removed.count(instruction.Operand(0));
+                break;
+            case SpvOpDecorate:
+                keep = !removed.count(instruction.Operand(0)) && (createLibrary || instruction.Operand(1) != SpvDecorationLinkageAttributes);
+                break;
+            case SpvOpFunction:
+                inRemovedFunction = removed.count(instruction.Operand(1)) != 0;
+                keep = !inRemovedFunction;
+                break;
+            case SpvOpVariable:
+                keep = !removed.count(instruction.Operand(1));
+                break;
+            default:
+                break;
+            }
+
+            if (inRemovedFunction)
+            {
+                keep = false;
+                inRemovedFunction = instruction.opcode != SpvOpFunctionEnd;
+            }
+
+            if (keep)
+            {
+                resolved.insert(resolved.end(), instruction.words, instruction.words + instruction.wordCount);
+            }
+            return true;
+        });
+
+        std::vector<uint32_t> rewritten;
+        if (!RewriteIds(resolved.data(), resolved.size(), [&replacements](uint32_t id) {
+                auto it = replacements.find(id);
+                return it != replacements.end() ? it->second : id;
+            }, rewritten))
+        {
+            return false;
+        }
+
+        // Library functions no entry point calls lose their Export above, so they can be dropped now.
+        std::vector<std::string> passes;
+        if (!createLibrary)
+        {
+            passes.push_back("--eliminate-dead-functions");
+        }
+        passes.push_back("--compact-ids");
+        if (!RunOptimizer(rewritten.data(), rewritten.size(), passes, output))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIR-V link failed: the linked module is invalid.");
+            output.clear();
+            return false;
+        }
+
+        DispatchLog(IGNITE_LOG_TYPE_INFO, "Linked " + std::to_string(modules.size()) + " SPIR-V modules: "
+            + std::to_string(replacements.size()) + " imports resolved, " + std::to_string(output.size() * sizeof(uint32_t)) + " bytes");
+        return true;
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SPIRV_LINKER_H
+#define _SPIRV_LINKER_H
+
+#pragma once
+
+// Internal header: SPIR-V module linker over the SPIRV-Tools binary parser and optimizer C API,
+// which has no spvLink of its own. Not installed.
+
+#include "ShaderCompiler.h"
+
+#include <functional>
+
+namespace ignite::spirv
+{
+    struct LinkInput
+    {
+        const uint32_t* words = nullptr;
+        size_t wordCount = 0;
+    };
+
+    // Copies a module with every id operand (result ids included) replaced by map(id). Which
+    // operands are ids comes from the SPIRV-Tools grammar. The bound is left as is.
+    // Returns false if SPIRV-Tools cannot parse the module.
+    bool RewriteIds(const uint32_t* words, size_t wordCount, const std::function<uint32_t(uint32_t)>& map, std::vector<uint32_t>& output);
+
+    // Links modules the way spirv-link does:
+    // - the ids of each module are moved past the previous ones and the sections are merged
+    // - spirv-opt --remove-duplicates folds repeated capabilities, imports, types and decorations
+    // - every Import LinkageAttributes declaration is replaced by the Export of the same name,
+    //   after checking that both have the same type
+    // Unless createLibrary is set, unresolved imports are errors and the result is an
+    // executable module: linkage decorations and the Linkage capability are removed, and
+    // functions no entry point reaches are dropped. Diagnostics go to the log callback.
+    bool LinkModules(const std::vector<LinkInput>& modules, bool createLibrary, std::vector<uint32_t>& output);
+}
+
+#endif
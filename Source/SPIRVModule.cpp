@@ -0,0 +1,1300 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "SPIRVModule.h"
+#include "ShaderUtils.h"
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_set>
+
+namespace ignite::spirv
+{
+    namespace
+    {
+        // Rejects modules whose id bound would make the flat tables unreasonably large.
+        constexpr uint32_t kMaxIdBound = 1u << 22;
+        constexpr uint32_t kMaxTypeDepth = 64;
+
+        void ApplyDecoration(IdRecord& record, uint32_t decoration, uint32_t value)
+        {
+            if (decoration < 64)
+            {
+                record.decorations |= uint64_t(1) << decoration;
+            }
+
+            switch (decoration)
+            {
+            case SpvDecorationBinding: record.binding = value; break;
+            case SpvDecorationDescriptorSet: record.set = value; break;
+            case SpvDecorationLocation: record.location = value; break;
+            case SpvDecorationComponent: record.component = value; break;
+            case SpvDecorationSpecId: record.specId = value; break;
+            case SpvDecorationArrayStride: record.arrayStride = value; break;
+            case SpvDecorationBuiltIn: record.builtIn = value; break;
+            default: break;
+            }
+        }
+
+        void ApplyMemberDecoration(MemberRecord& member, uint32_t decoration, uint32_t value)
+        {
+            if (decoration < 64)
+            {
+                member.decorations |= uint64_t(1) << decoration;
+            }
+
+            switch (decoration)
+            {
+            case SpvDecorationOffset: member.offset = value; break;
+            case SpvDecorationMatrixStride: member.matrixStride = value; break;
+            case SpvDecorationBuiltIn: member.builtIn = value; break;
+            case SpvDecorationLocation: member.location = value; break;
+            case SpvDecorationComponent: member.component = value; break;
+            default: break;
+            }
+        }
+
+        IGNITE_ShaderDataType MapDataType(const IdRecord& scalar)
+        {
+            const uint32_t width = scalar.args[0];
+            switch (scalar.opcode)
+            {
+            case SpvOpTypeBool:
+                return IGNITE_SHADER_DATA_TYPE_BOOL;
+            case SpvOpTypeStruct:
+                return IGNITE_SHADER_DATA_TYPE_STRUCT;
+            case SpvOpTypeFloat:
+                if (width == 16) return IGNITE_SHADER_DATA_TYPE_HALF;
+                if (width == 32) return IGNITE_SHADER_DATA_TYPE_FLOAT;
+                if (width == 64) return IGNITE_SHADER_DATA_TYPE_DOUBLE;
+                break;
+            case SpvOpTypeInt:
+            {
+                const bool isSigned = scalar.args[1] != 0;
+                if (width == 8) return isSigned ? IGNITE_SHADER_DATA_TYPE_INT8 : IGNITE_SHADER_DATA_TYPE_UINT8;
+                if (width == 16) return isSigned ? IGNITE_SHADER_DATA_TYPE_INT16 : IGNITE_SHADER_DATA_TYPE_UINT16;
+                if (width == 32) return isSigned ? IGNITE_SHADER_DATA_TYPE_INT : IGNITE_SHADER_DATA_TYPE_UINT;
+                if (width == 64) return isSigned ? IGNITE_SHADER_DATA_TYPE_INT64 : IGNITE_SHADER_DATA_TYPE_UINT64;
+                break;
+            }
+            default:
+                break;
+            }
+            return IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+        }
+
+        // Mirrors IGNITE_MapSpvcType for native type records.
+        IGNITE_VertexElementFormat MapScalarFormat(const IdRecord& scalar, uint32_t vecSize, uint32_t columns)
+        {
+            if (columns != 1 || (scalar.opcode != SpvOpTypeFloat && scalar.opcode != SpvOpTypeInt))
+            {
+                return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+            }
+            return IGNITE_SelectVertexFormat(MapDataType(scalar), vecSize, 0);
+        }
+
+        // Appends the members of structId depth-first; nested struct members are prefixed with their parent's name.
+        void FlattenMembers(const Module& module, uint32_t structId, const std::string& prefix, uint32_t baseOffset, uint32_t depth, std::vector<ShaderBufferMember>& out)
+        {
+            const IdRecord* owner = module.Find(structId);
+            if (!owner || owner->opcode != SpvOpTypeStruct || depth > kMaxTypeDepth)
+            {
+                return;
+            }
+
+            for (uint32_t i = 0; i < owner->memberCount; ++i)
+            {
+                const MemberRecord& member = module.members[owner->firstMember + i];
+
+                ShaderBufferMember item = {};
+                item.name = prefix + (member.name.empty() ? "_m" + std::to_string(i) : std::string(member.name));
+                item.offset = baseOffset + member.offset;
+                item.size = module.DeclaredMemberSize(structId, i, depth);
+                item.matrixStride = member.matrixStride;
+                item.rowMajor = module.HasMemberDecoration(member, SpvDecorationRowMajor);
+                item.depth = depth;
+
+                uint32_t typeId = member.typeId;
+                const IdRecord* type = module.Find(typeId);
+                if (type && (type->opcode == SpvOpTypeArray || type->opcode == SpvOpTypeRuntimeArray))
+                {
+                    item.arrayStride = type->arrayStride;
+                    item.arraySize = type->opcode == SpvOpTypeArray ? static_cast<uint32_t>(module.ConstantValue(type->args[1])) : 0;
+                }
+                for (uint32_t level = 0; type && (type->opcode == SpvOpTypeArray || type->opcode == SpvOpTypeRuntimeArray) && level < kMaxTypeDepth; ++level)
+                {
+                    typeId = type->args[0];
+                    type = module.Find(typeId);
+                }
+
+                const IdRecord* scalar = type;
+                if (type && type->opcode == SpvOpTypeVector)
+                {
+                    item.vecSize = type->args[1];
+                    scalar = module.Find(type->args[0]);
+                }
+                else if (type && type->opcode == SpvOpTypeMatrix)
+                {
+                    const IdRecord* column = module.Find(type->args[0]);
+                    item.columns = type->args[1];
+                    item.vecSize = column ? column->args[1] : 0;
+                    scalar = column ? module.Find(column->args[0]) : nullptr;
+                }
+
+                if (type && type->opcode == SpvOpTypePointer)
+                {
+                    // Buffer device addresses are 64-bit handles; the pointee is not expanded.
+                    item.type = IGNITE_SHADER_DATA_TYPE_UINT64;
+                }
+                else
+                {
+                    item.type = scalar ? MapDataType(*scalar) : IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+                }
+
+                const bool isStruct = item.type == IGNITE_SHADER_DATA_TYPE_STRUCT;
+                const std::string nestedPrefix = isStruct ? item.name + "." : std::string();
+                const uint32_t nestedOffset = item.offset;
+                out.push_back(std::move(item));
+
+                if (isStruct)
+                {
+                    FlattenMembers(module, typeId, nestedPrefix, nestedOffset, depth + 1, out);
+                }
+            }
+        }
+
+        // Block name as SPIRV-Cross reports it: struct name, then variable name, then _<type>_<id>.
+        std::string BlockName(const Module& module, uint32_t variableId, uint32_t structId)
+        {
+            const IdRecord& block = module.ids[structId];
+            if (!block.name.empty())
+            {
+                return std::string(block.name);
+            }
+
+            const IdRecord& variable = module.ids[variableId];
+            if (!variable.name.empty())
+            {
+                return std::string(variable.name);
+            }
+
+            return "_" + std::to_string(structId) + "_" + std::to_string(variableId);
+        }
+    }
+
+    void Module::Reset()
+    {
+        version = 0;
+        bound = 0;
+        ids.clear();
+        members.clear();
+        pendingMembers.clear();
+        variables.clear();
+        specConstants.clear();
+        executionModel = SpvExecutionModelMax;
+        entryFunction = 0;
+        entryName = {};
+        interfaceIds.clear();
+        localSize[0] = localSize[1] = localSize[2] = 0;
+        localSizeIds[0] = localSizeIds[1] = localSizeIds[2] = 0;
+        workgroupSizeId = 0;
+    }
+
+    bool Module::HasDecoration(uint32_t id, SpvDecoration decoration) const
+    {
+        const IdRecord* record = Find(id);
+        return record && decoration < 64 && (record->decorations & (uint64_t(1) << decoration)) != 0;
+    }
+
+    bool Module::HasMemberDecoration(const MemberRecord& member, SpvDecoration decoration) const
+    {
+        return decoration < 64 && (member.decorations & (uint64_t(1) << decoration)) != 0;
+    }
+
+    uint32_t Module::BaseType(uint32_t typeId) const
+    {
+        for (uint32_t depth = 0; depth < kMaxTypeDepth; ++depth)
+        {
+            const IdRecord* record = Find(typeId);
+            if (!record)
+            {
+                return 0;
+            }
+
+            switch (record->opcode)
+            {
+            case SpvOpTypePointer: typeId = record->args[1]; break;
+            case SpvOpTypeArray:
+            case SpvOpTypeRuntimeArray: typeId = record->args[0]; break;
+            default: return typeId;
+            }
+        }
+        return 0;
+    }
+
+    uint32_t Module::DescriptorCount(uint32_t typeId, bool* outUnbounded) const
+    {
+        uint64_t count = 1;
+        *outUnbounded = false;
+        for (uint32_t depth = 0; depth < kMaxTypeDepth; ++depth)
+        {
+            const IdRecord* record = Find(typeId);
+            if (!record)
+            {
+                break;
+            }
+
+            switch (record->opcode)
+            {
+            case SpvOpTypePointer:
+                typeId = record->args[1];
+                continue;
+            case SpvOpTypeArray:
+                // Spec constant lengths use their default value.
+                count *= ConstantValue(record->args[1], 1);
+                typeId = record->args[0];
+                continue;
+            case SpvOpTypeRuntimeArray:
+                *outUnbounded = true;
+                return 0;
+            default:
+                break;
+            }
+            break;
+        }
+        return static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+    }
+
+    uint64_t Module::ConstantValue(uint32_t id, uint64_t fallback) const
+    {
+        const IdRecord* record = Find(id);
+        if (!record)
+        {
+            return fallback;
+        }
+
+        switch (record->opcode)
+        {
+        case SpvOpConstantTrue:
+        case SpvOpConstantFalse:
+        case SpvOpSpecConstantTrue:
+        case SpvOpSpecConstantFalse:
+            return record->value[0];
+        case SpvOpConstant:
+        case SpvOpSpecConstant:
+        {
+            const IdRecord* type = Find(record->resultType);
+            const bool wide = type && type->args[0] == 64;
+            return wide ? (uint64_t(record->value[1]) << 32) | record->value[0] : record->value[0];
+        }
+        default:
+            return fallback;
+        }
+    }
+
+    uint32_t Module::DeclaredStructSize(uint32_t structId, uint32_t depth) const
+    {
+        const IdRecord* record = Find(structId);
+        if (!record || record->opcode != SpvOpTypeStruct || record->memberCount == 0 || depth > kMaxTypeDepth)
+        {
+            return 0;
+        }
+
+        // Offsets may be declared out of order; the size ends at the highest-offset member.
+        uint32_t memberIndex = 0;
+        uint32_t highestOffset = 0;
+        for (uint32_t i = 0; i < record->memberCount; ++i)
+        {
+            const uint32_t offset = members[record->firstMember + i].offset;
+            if (offset > highestOffset)
+            {
+                highestOffset = offset;
+                memberIndex = i;
+            }
+        }
+
+        // A trailing runtime array contributes no size, as in SPIRV-Cross.
+        const uint32_t memberSize = DeclaredMemberSize(structId, memberIndex, depth);
+        const IdRecord* lastType = Find(members[record->firstMember + memberIndex].typeId);
+        const bool runtimeArray = lastType && lastType->opcode == SpvOpTypeRuntimeArray;
+        return (memberSize || runtimeArray) ? highestOffset + memberSize : 0;
+    }
+
+    uint32_t Module::DeclaredMemberSize(uint32_t structId, uint32_t memberIndex, uint32_t depth) const
+    {
+        const IdRecord* owner = Find(structId);
+        if (!owner || owner->opcode != SpvOpTypeStruct || memberIndex >= owner->memberCount)
+        {
+            return 0;
+        }
+
+        const MemberRecord& member = members[owner->firstMember + memberIndex];
+        const IdRecord* type = Find(member.typeId);
+        if (!type)
+        {
+            return 0;
+        }
+
+        switch (type->opcode)
+        {
+        case SpvOpTypeArray:
+            return type->arrayStride * static_cast<uint32_t>(ConstantValue(type->args[1]));
+        case SpvOpTypeRuntimeArray:
+            return 0;
+        case SpvOpTypeStruct:
+            return DeclaredStructSize(member.typeId, depth + 1);
+        case SpvOpTypePointer:
+            return type->args[0] == SpvStorageClassPhysicalStorageBuffer ? 8 : 0;
+        case SpvOpTypeInt:
+        case SpvOpTypeFloat:
+            return type->args[0] / 8;
+        case SpvOpTypeVector:
+        {
+            const IdRecord* component = Find(type->args[0]);
+            return component ? type->args[1] * (component->args[0] / 8) : 0;
+        }
+        case SpvOpTypeMatrix:
+        {
+            const IdRecord* column = Find(type->args[0]);
+            if (!column)
+            {
+                return 0;
+            }
+            if (HasMemberDecoration(member, SpvDecorationRowMajor))
+            {
+                return member.matrixStride * column->args[1];
+            }
+            if (HasMemberDecoration(member, SpvDecorationColMajor))
+            {
+                return member.matrixStride * type->args[1];
+            }
+            return 0;
+        }
+        default:
+            return 0;
+        }
+    }
+
+    uint32_t Module::Std430Size(uint32_t typeId, uint32_t* outAlignment, uint32_t depth) const
+    {
+        const IdRecord* type = Find(typeId);
+        uint32_t size = 0;
+        uint32_t alignment = 1;
+        if (type && depth <= kMaxTypeDepth)
+        {
+            switch (type->opcode)
+            {
+            case SpvOpTypeBool:
+                size = alignment = 4;
+                break;
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+                size = alignment = type->args[0] / 8;
+                break;
+            case SpvOpTypePointer:
+                if (type->args[0] == SpvStorageClassPhysicalStorageBuffer)
+                {
+                    size = alignment = 8;
+                }
+                break;
+            case SpvOpTypeVector:
+            {
+                const uint32_t component = Std430Size(type->args[0], nullptr, depth + 1);
+                size = component * type->args[1];
+                alignment = component * (type->args[1] == 3 ? 4 : type->args[1]);
+                break;
+            }
+            case SpvOpTypeMatrix:
+                // Column-major: each column is padded to its vector alignment.
+                Std430Size(type->args[0], &alignment, depth + 1);
+                size = alignment * type->args[1];
+                break;
+            case SpvOpTypeArray:
+            {
+                const uint32_t element = Std430Size(type->args[0], &alignment, depth + 1);
+                size = AlignUp(element, alignment) * static_cast<uint32_t>(ConstantValue(type->args[1]));
+                break;
+            }
+            case SpvOpTypeStruct:
+            {
+                uint32_t offset = 0;
+                for (uint32_t i = 0; i < type->memberCount; ++i)
+                {
+                    uint32_t memberAlignment = 1;
+                    const uint32_t memberSize = Std430Size(members[type->firstMember + i].typeId, &memberAlignment, depth + 1);
+                    offset = AlignUp(offset, memberAlignment) + memberSize;
+                    alignment = std::max(alignment, memberAlignment);
+                }
+                size = AlignUp(offset, alignment);
+                break;
+            }
+            default:
+                // Runtime arrays and opaque types have no static size.
+                break;
+            }
+        }
+
+        if (outAlignment)
+        {
+            *outAlignment = alignment ? alignment : 1;
+        }
+        return size;
+    }
+
+    bool Module::IsInInterface(uint32_t id) const
+    {
+        return std::find(interfaceIds.begin(), interfaceIds.end(), id) != interfaceIds.end();
+    }
+
+    bool Module::IsBuiltInVariable(uint32_t variableId) const
+    {
+        if (HasDecoration(variableId, SpvDecorationBuiltIn))
+        {
+            return true;
+        }
+
+        const IdRecord* variable = Find(variableId);
+        const IdRecord* base = variable ? Find(BaseType(variable->resultType)) : nullptr;
+        if (!base || base->opcode != SpvOpTypeStruct)
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < base->memberCount; ++i)
+        {
+            if (HasMemberDecoration(members[base->firstMember + i], SpvDecorationBuiltIn))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ParseModule(const uint32_t* words, size_t wordCount, Module& module)
+    {
+        module.Reset();
+        if (!HasValidHeader(words, wordCount) || words[3] == 0 || words[3] > kMaxIdBound)
+        {
+            return false;
+        }
+
+        module.version = words[1];
+        module.bound = words[3];
+        module.ids.resize(module.bound);
+
+        bool valid = true;
+        auto record = [&](uint32_t id) -> IdRecord* {
+            if (id >= module.bound)
+            {
+                valid = false;
+                return nullptr;
+            }
+            return &module.ids[id];
+        };
+
+        const bool walked = ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+            switch (instruction.opcode)
+            {
+            case SpvOpEntryPoint:
+                // Like SPIRV-Cross, the first entry point is the one reflected.
+                if (module.executionModel == SpvExecutionModelMax && instruction.wordCount >= 4)
+                {
+                    uint32_t nameWords = 0;
+                    module.executionModel = static_cast<SpvExecutionModel>(instruction.Operand(0));
+                    module.entryFunction = instruction.Operand(1);
+                    module.entryName = ReadString(instruction, 3, &nameWords);
+                    for (uint32_t i = 3 + nameWords; i < instruction.wordCount; ++i)
+                    {
+                        module.interfaceIds.push_back(instruction.words[i]);
+                    }
+                }
+                break;
+
+            case SpvOpExecutionMode:
+                if (instruction.Operand(0) == module.entryFunction && instruction.Operand(1) == SpvExecutionModeLocalSize && instruction.wordCount >= 6)
+                {
+                    module.localSize[0] = instruction.Operand(2);
+                    module.localSize[1] = instruction.Operand(3);
+                    module.localSize[2] = instruction.Operand(4);
+                }
+                break;
+
+            case SpvOpExecutionModeId:
+                if (instruction.Operand(0) == module.entryFunction && instruction.Operand(1) == SpvExecutionModeLocalSizeId && instruction.wordCount >= 6)
+                {
+                    module.localSizeIds[0] = instruction.Operand(2);
+                    module.localSizeIds[1] = instruction.Operand(3);
+                    module.localSizeIds[2] = instruction.Operand(4);
+                }
+                break;
+
+            case SpvOpName:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    target->name = ReadString(instruction, 2);
+                }
+                break;
+
+            case SpvOpMemberName:
+            {
+                MemberAnnotation& annotation = module.pendingMembers.emplace_back();
+                annotation.structId = instruction.Operand(0);
+                annotation.member = instruction.Operand(1);
+                annotation.name = ReadString(instruction, 3);
+                break;
+            }
+
+            case SpvOpDecorate:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    ApplyDecoration(*target, instruction.Operand(1), instruction.Operand(2));
+                }
+                break;
+
+            case SpvOpMemberDecorate:
+            {
+                MemberAnnotation& annotation = module.pendingMembers.emplace_back();
+                annotation.structId = instruction.Operand(0);
+                annotation.member = instruction.Operand(1);
+                annotation.decoration = static_cast<SpvDecoration>(instruction.Operand(2));
+                annotation.value = instruction.Operand(3);
+                break;
+            }
+
+            case SpvOpDecorationGroup:
+            case SpvOpGroupDecorate:
+            case SpvOpGroupMemberDecorate:
+                // Deprecated indirection; leave such modules to SPIRV-Cross.
+                valid = false;
+                return false;
+
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+            case SpvOpTypeArray:
+            case SpvOpTypeRuntimeArray:
+            case SpvOpTypePointer:
+            case SpvOpTypeSampledImage:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->args[0] = instruction.Operand(1);
+                    target->args[1] = instruction.Operand(2);
+                }
+                break;
+
+            case SpvOpTypeImage:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->args[0] = instruction.Operand(1);
+                    target->args[1] = instruction.Operand(2);
+                    target->args[2] = instruction.Operand(6);
+                }
+                break;
+
+            case SpvOpTypeVoid:
+            case SpvOpTypeBool:
+            case SpvOpTypeSampler:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    target->opcode = instruction.opcode;
+                }
+                break;
+
+            case SpvOpTypeStruct:
+                if (IdRecord* target = record(instruction.Operand(0)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->firstMember = static_cast<uint32_t>(module.members.size());
+                    target->memberCount = instruction.wordCount - 2;
+                    for (uint32_t i = 2; i < instruction.wordCount; ++i)
+                    {
+                        module.members.emplace_back().typeId = instruction.words[i];
+                    }
+                }
+                break;
+
+            case SpvOpConstant:
+            case SpvOpSpecConstant:
+                if (IdRecord* target = record(instruction.Operand(1)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->resultType = instruction.Operand(0);
+                    target->value[0] = instruction.Operand(2);
+                    target->value[1] = instruction.Operand(3);
+                    if (instruction.opcode == SpvOpSpecConstant)
+                    {
+                        module.specConstants.push_back(instruction.Operand(1));
+                    }
+                }
+                break;
+
+            case SpvOpConstantTrue:
+            case SpvOpConstantFalse:
+            case SpvOpSpecConstantTrue:
+            case SpvOpSpecConstantFalse:
+                if (IdRecord* target = record(instruction.Operand(1)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->resultType = instruction.Operand(0);
+                    target->value[0] = (instruction.opcode == SpvOpConstantTrue || instruction.opcode == SpvOpSpecConstantTrue) ? 1 : 0;
+                    if (instruction.opcode == SpvOpSpecConstantTrue || instruction.opcode == SpvOpSpecConstantFalse)
+                    {
+                        module.specConstants.push_back(instruction.Operand(1));
+                    }
+                }
+                break;
+
+            case SpvOpConstantComposite:
+            case SpvOpSpecConstantComposite:
+                if (IdRecord* target = record(instruction.Operand(1)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->resultType = instruction.Operand(0);
+                    target->args[0] = instruction.Operand(2);
+                    target->args[1] = instruction.Operand(3);
+                    target->args[2] = instruction.Operand(4);
+                    if (target->builtIn == SpvBuiltInWorkgroupSize && module.HasDecoration(instruction.Operand(1), SpvDecorationBuiltIn))
+                    {
+                        module.workgroupSizeId = instruction.Operand(1);
+                    }
+                }
+                break;
+
+            case SpvOpVariable:
+                if (IdRecord* target = record(instruction.Operand(1)))
+                {
+                    target->opcode = instruction.opcode;
+                    target->resultType = instruction.Operand(0);
+                    target->args[0] = instruction.Operand(2);
+                    module.variables.push_back(instruction.Operand(1));
+                }
+                break;
+
+            case SpvOpFunction:
+                // Everything reflection needs is declared before the first function body.
+                return false;
+
+            default:
+                break;
+            }
+            return valid;
+        });
+
+        if (!walked || !valid)
+        {
+            return false;
+        }
+
+        for (const MemberAnnotation& annotation : module.pendingMembers)
+        {
+            const IdRecord* owner = module.Find(annotation.structId);
+            if (!owner || owner->opcode != SpvOpTypeStruct || annotation.member >= owner->memberCount)
+            {
+                continue;
+            }
+
+            MemberRecord& member = module.members[owner->firstMember + annotation.member];
+            if (annotation.decoration == SpvDecorationMax)
+            {
+                member.name = annotation.name;
+            }
+            else
+            {
+                ApplyMemberDecoration(member, annotation.decoration, annotation.value);
+            }
+        }
+        return true;
+    }
+
+    bool Reflect(const uint32_t* words, size_t wordCount, ShaderReflectionInfo& info)
+    {
+        // Scratch tables are reused per thread, so steady-state reflection only allocates the output.
+        thread_local Module module;
+        if (!ParseModule(words, wordCount, module) || module.executionModel == SpvExecutionModelMax)
+        {
+            return false;
+        }
+
+        // From SPIR-V 1.4 every global used by the entry point is listed in its interface.
+        const bool interfaceListsAll = module.version >= 0x10400;
+
+        auto makeResource = [&](uint32_t variableId, std::string name) {
+            const IdRecord& variable = module.ids[variableId];
+            ShaderResourceInfo item = {};
+            item.name = std::move(name);
+            item.id = variableId;
+            item.set = variable.set;
+            item.binding = variable.binding;
+            item.count = module.DescriptorCount(variable.resultType, &item.unbounded);
+            return item;
+        };
+
+        auto makeBuffer = [&](uint32_t variableId, uint32_t structId) {
+            ShaderResourceInfo item = makeResource(variableId, BlockName(module, variableId, structId));
+            item.size = module.DeclaredStructSize(structId);
+            FlattenMembers(module, structId, std::string(), 0, 0, item.members);
+            return item;
+        };
+
+        auto makeStageIO = [&](uint32_t variableId, std::string name) {
+            const IdRecord& variable = module.ids[variableId];
+            ShaderStageIOInfo io = {};
+            io.name = std::move(name);
+            io.id = variableId;
+            io.location = variable.location;
+            io.component = variable.component;
+
+            const IdRecord* type = module.Find(module.BaseType(variable.resultType));
+            const IdRecord* scalar = type;
+            io.vecSize = 1;
+            io.columns = 1;
+            if (type && type->opcode == SpvOpTypeVector)
+            {
+                io.vecSize = type->args[1];
+                scalar = module.Find(type->args[0]);
+            }
+            else if (type && type->opcode == SpvOpTypeMatrix)
+            {
+                const IdRecord* column = module.Find(type->args[0]);
+                io.columns = type->args[1];
+                io.vecSize = column ? column->args[1] : 0;
+                scalar = column ? module.Find(column->args[0]) : nullptr;
+            }
+
+            io.format = scalar ? MapScalarFormat(*scalar, io.vecSize, io.columns) : IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+            return io;
+        };
+
+        for (uint32_t variableId : module.variables)
+        {
+            const IdRecord& variable = module.ids[variableId];
+            const uint32_t storage = variable.args[0];
+            const IdRecord* pointer = module.Find(variable.resultType);
+            if (!pointer || pointer->opcode != SpvOpTypePointer || storage == SpvStorageClassFunction)
+            {
+                continue;
+            }
+
+            const bool isIO = storage == SpvStorageClassInput || storage == SpvStorageClassOutput;
+            if ((isIO || interfaceListsAll) && !module.IsInInterface(variableId))
+            {
+                continue;
+            }
+
+            if (storage == SpvStorageClassWorkgroup)
+            {
+                uint32_t alignment = 1;
+                const uint32_t size = module.Std430Size(pointer->args[1], &alignment);
+                info.compute.sharedMemorySize = AlignUp(info.compute.sharedMemorySize, alignment) + size;
+                continue;
+            }
+            if (module.IsBuiltInVariable(variableId))
+            {
+                continue;
+            }
+
+            const uint32_t baseId = module.BaseType(variable.resultType);
+            const IdRecord* base = module.Find(baseId);
+            if (!base)
+            {
+                return false;
+            }
+
+            const bool isBlock = module.HasDecoration(baseId, SpvDecorationBlock);
+            const bool isBufferBlock = module.HasDecoration(baseId, SpvDecorationBufferBlock);
+
+            if (isIO)
+            {
+                std::string name = isBlock ? BlockName(module, variableId, baseId) : std::string(variable.name);
+                std::vector<ShaderStageIOInfo>& list = storage == SpvStorageClassInput ? info.stageInputs : info.stageOutputs;
+                list.push_back(makeStageIO(variableId, std::move(name)));
+            }
+            else if (storage == SpvStorageClassUniform && isBlock)
+            {
+                info.uniformBuffers.push_back(makeBuffer(variableId, baseId));
+            }
+            else if ((storage == SpvStorageClassUniform && isBufferBlock) || storage == SpvStorageClassStorageBuffer)
+            {
+                info.storageBuffers.push_back(makeBuffer(variableId, baseId));
+            }
+            else if (storage == SpvStorageClassPushConstant)
+            {
+                ShaderPushConstantInfo pushConstant = {};
+                pushConstant.name = std::string(variable.name);
+                pushConstant.size = module.DeclaredStructSize(baseId);
+                FlattenMembers(module, baseId, std::string(), 0, 0, pushConstant.members);
+                info.pushConstants.push_back(std::move(pushConstant));
+            }
+            else if (storage == SpvStorageClassUniformConstant)
+            {
+                if (base->opcode == SpvOpTypeImage && base->args[1] != SpvDimSubpassData)
+                {
+                    if (base->args[2] == 2)
+                    {
+                        info.storageImages.push_back(makeResource(variableId, std::string(variable.name)));
+                    }
+                    else if (base->args[2] == 1)
+                    {
+                        info.separateImages.push_back(makeResource(variableId, std::string(variable.name)));
+                    }
+                }
+                else if (base->opcode == SpvOpTypeSampler)
+                {
+                    info.separateSamplers.push_back(makeResource(variableId, std::string(variable.name)));
+                }
+                else if (base->opcode == SpvOpTypeSampledImage)
+                {
+                    info.sampledImages.push_back(makeResource(variableId, std::string(variable.name)));
+                }
+            }
+        }
+
+        auto byLocation = [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
+            return a.location != b.location ? a.location < b.location : a.component < b.component;
+        };
+        std::sort(info.stageInputs.begin(), info.stageInputs.end(), byLocation);
+        std::sort(info.stageOutputs.begin(), info.stageOutputs.end(), byLocation);
+
+        // A WorkgroupSize builtin overrides the execution mode; its constituents and LocalSizeId
+        // operands may be specialization constants.
+        const uint32_t* sizeIds = module.workgroupSizeId != 0 ? module.ids[module.workgroupSizeId].args
+            : (module.localSizeIds[0] != 0 ? module.localSizeIds : nullptr);
+        for (uint32_t dimension = 0; dimension < 3; ++dimension)
+        {
+            if (!sizeIds)
+            {
+                info.compute.localSize[dimension] = module.localSize[dimension];
+                continue;
+            }
+
+            const uint32_t constantId = sizeIds[dimension];
+            const IdRecord* constant = module.Find(constantId);
+            info.compute.localSize[dimension] = static_cast<uint32_t>(module.ConstantValue(constantId));
+            if (constant && constant->opcode == SpvOpSpecConstant && module.HasDecoration(constantId, SpvDecorationSpecId))
+            {
+                info.compute.localSizeSpecialized[dimension] = true;
+                info.compute.localSizeSpecIds[dimension] = constant->specId;
+            }
+        }
+
+        // Only SpecId-decorated constants can be specialized; the rest (OpSpecConstantOp,
+        // composites such as gl_WorkGroupSize) are derived from them.
+        for (uint32_t constantId : module.specConstants)
+        {
+            if (!module.HasDecoration(constantId, SpvDecorationSpecId))
+            {
+                continue;
+            }
+
+            const IdRecord& constant = module.ids[constantId];
+            const IdRecord* type = module.Find(constant.resultType);
+
+            ShaderSpecializationConstant item = {};
+            item.name = std::string(constant.name);
+            item.id = constantId;
+            item.constantId = constant.specId;
+            item.type = type ? MapDataType(*type) : IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+            item.defaultValue = module.ConstantValue(constantId);
+            info.specializationConstants.push_back(std::move(item));
+        }
+
+        std::sort(info.specializationConstants.begin(), info.specializationConstants.end(), [](const ShaderSpecializationConstant& a, const ShaderSpecializationConstant& b) {
+            return a.constantId < b.constantId;
+        });
+        return true;
+    }
+
+    bool SetSpecConstantDefaults(uint32_t* words, size_t wordCount, const std::vector<SpecializationConstantValue>& values)
+    {
+        if (values.empty())
+        {
+            return HasValidHeader(words, wordCount);
+        }
+
+        // Annotations precede every constant declaration, so one pass sees each SpecId first.
+        std::unordered_map<uint32_t, uint64_t> valueById; // result id -> value
+        std::unordered_map<uint32_t, std::pair<uint32_t, bool>> narrowTypes; // type id -> (width, signed) for scalars below 32 bits
+        return ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+            switch (instruction.opcode)
+            {
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+                if (instruction.Operand(1) > 0 && instruction.Operand(1) < 32)
+                {
+                    const bool isSigned = instruction.opcode == SpvOpTypeInt && instruction.Operand(2) != 0;
+                    narrowTypes[instruction.Operand(0)] = { instruction.Operand(1), isSigned };
+                }
+                break;
+
+            case SpvOpDecorate:
+                if (instruction.Operand(1) == SpvDecorationSpecId && instruction.wordCount >= 4)
+                {
+                    for (const SpecializationConstantValue& value : values)
+                    {
+                        if (value.constantId == instruction.Operand(2))
+                        {
+                            valueById[instruction.Operand(0)] = value.value;
+                        }
+                    }
+                }
+                break;
+
+            case SpvOpSpecConstant:
+            {
+                auto it = valueById.find(instruction.Operand(1));
+                if (it != valueById.end() && instruction.wordCount >= 4)
+                {
+                    // Literals narrower than 32 bits are sign-extended for signed integers, zero-extended otherwise.
+                    uint32_t low = static_cast<uint32_t>(it->second);
+                    auto narrow = narrowTypes.find(instruction.Operand(0));
+                    if (narrow != narrowTypes.end())
+                    {
+                        const uint32_t shift = 32 - narrow->second.first;
+                        low = narrow->second.second ? static_cast<uint32_t>(static_cast<int32_t>(low << shift) >> shift) : (low << shift) >> shift;
+                    }
+
+                    uint32_t* literal = words + instruction.offset + 3;
+                    literal[0] = low;
+                    if (instruction.wordCount >= 5)
+                    {
+                        literal[1] = static_cast<uint32_t>(it->second >> 32);
+                    }
+                }
+                break;
+            }
+
+            case SpvOpSpecConstantTrue:
+            case SpvOpSpecConstantFalse:
+            {
+                auto it = valueById.find(instruction.Operand(1));
+                if (it != valueById.end())
+                {
+                    const SpvOp opcode = it->second != 0 ? SpvOpSpecConstantTrue : SpvOpSpecConstantFalse;
+                    words[instruction.offset] = (instruction.wordCount << SpvWordCountShift) | uint32_t(opcode);
+                }
+                break;
+            }
+
+            case SpvOpFunction:
+                return false;
+
+            default:
+                break;
+            }
+            return true;
+        });
+    }
+
+    bool StripDebugInstructions(const uint32_t* words, size_t wordCount, std::vector<uint32_t>& output)
+    {
+        output.clear();
+        if (!HasValidHeader(words, wordCount))
+        {
+            return false;
+        }
+
+        output.reserve(wordCount);
+        output.assign(words, words + kHeaderWordCount);
+
+        // OpExtInstWithForwardRefsKHR is missing from older spirv.h. Its extension goes only if
+        // every use is a NonSemantic set, which the first pass finds out before the OpExtension.
+        constexpr SpvOp kOpExtInstWithForwardRefsKHR = static_cast<SpvOp>(4433);
+        std::unordered_set<uint32_t> nonSemanticSets;
+        bool keepsForwardRefs = false;
+        const bool valid = ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+            if (instruction.opcode == SpvOpExtInstImport && ReadString(instruction, 2).starts_with("NonSemantic."))
+            {
+                nonSemanticSets.insert(instruction.Operand(0));
+            }
+            else if (instruction.opcode == kOpExtInstWithForwardRefsKHR)
+            {
+                keepsForwardRefs = keepsForwardRefs || !nonSemanticSets.count(instruction.Operand(2));
+            }
+            return true;
+        }) && ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+            bool keep = true;
+            if (instruction.opcode == kOpExtInstWithForwardRefsKHR)
+            {
+                keep = !nonSemanticSets.count(instruction.Operand(2));
+            }
+
+            switch (instruction.opcode)
+            {
+            case SpvOpSourceContinued:
+            case SpvOpSource:
+            case SpvOpSourceExtension:
+            case SpvOpString:
+            case SpvOpName:
+            case SpvOpMemberName:
+            case SpvOpLine:
+            case SpvOpNoLine:
+            case SpvOpModuleProcessed:
+                keep = false;
+                break;
+
+            case SpvOpExtension:
+            {
+                const std::string_view name = ReadString(instruction, 1);
+                keep = name != "SPV_KHR_non_semantic_info" && (keepsForwardRefs || name != "SPV_KHR_relaxed_extended_instruction");
+                break;
+            }
+
+            case SpvOpExtInstImport:
+                keep = !nonSemanticSets.count(instruction.Operand(0));
+                break;
+
+            case SpvOpExtInst:
+                keep = !nonSemanticSets.count(instruction.Operand(2));
+                break;
+
+            default:
+                break;
+            }
+
+            if (keep)
+            {
+                output.insert(output.end(), instruction.words, instruction.words + instruction.wordCount);
+            }
+            return true;
+        });
+
+        if (!valid)
+        {
+            output.clear();
+        }
+        return valid;
+    }
+
+    namespace
+    {
+        bool IsPreambleInstruction(SpvOp opcode)
+        {
+            switch (opcode)
+            {
+            case SpvOpNop:
+            case SpvOpCapability:
+            case SpvOpExtension:
+            case SpvOpExtInstImport:
+            case SpvOpMemoryModel:
+            case SpvOpEntryPoint:
+            case SpvOpExecutionMode:
+            case SpvOpExecutionModeId:
+            case SpvOpSourceContinued:
+            case SpvOpSource:
+            case SpvOpSourceExtension:
+            case SpvOpString:
+            case SpvOpName:
+            case SpvOpMemberName:
+            case SpvOpModuleProcessed:
+            case SpvOpDecorate:
+            case SpvOpMemberDecorate:
+            case SpvOpDecorationGroup:
+            case SpvOpGroupDecorate:
+            case SpvOpGroupMemberDecorate:
+            case SpvOpDecorateId:
+            case SpvOpDecorateString:
+            case SpvOpMemberDecorateString:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        // Word index of the result id for instructions the declaration sort can move; 0 for others.
+        uint32_t DeclarationResultWord(SpvOp opcode)
+        {
+            switch (opcode)
+            {
+            case SpvOpTypeVoid:
+            case SpvOpTypeBool:
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+            case SpvOpTypeImage:
+            case SpvOpTypeSampler:
+            case SpvOpTypeSampledImage:
+            case SpvOpTypeArray:
+            case SpvOpTypeRuntimeArray:
+            case SpvOpTypeStruct:
+            case SpvOpTypeOpaque:
+            case SpvOpTypePointer:
+            case SpvOpTypeFunction:
+                return 1;
+            case SpvOpUndef:
+            case SpvOpConstantTrue:
+            case SpvOpConstantFalse:
+            case SpvOpConstant:
+            case SpvOpConstantComposite:
+            case SpvOpConstantSampler:
+            case SpvOpConstantNull:
+            case SpvOpSpecConstantTrue:
+            case SpvOpSpecConstantFalse:
+            case SpvOpSpecConstant:
+            case SpvOpSpecConstantComposite:
+            case SpvOpSpecConstantOp:
+            case SpvOpVariable:
+                return 2;
+            default:
+                return 0;
+            }
+        }
+
+        // Kahn's algorithm over the declarations, taking the smallest content hash among the ready ones.
+        // Any operand word equal to a declared id counts as a dependency; a literal that happens to match
+        // only adds an edge, and a resulting cycle makes the sort give up.
+        bool OrderDeclarations(const std::vector<Instruction>& declarations, std::vector<size_t>& order)
+        {
+            std::unordered_map<uint32_t, size_t> indexById;
+            for (size_t i = 0; i < declarations.size(); ++i)
+            {
+                const Instruction& declaration = declarations[i];
+                const uint32_t resultWord = DeclarationResultWord(declaration.opcode);
+                if (resultWord == 0 || resultWord >= declaration.wordCount || !indexById.emplace(declaration.words[resultWord], i).second)
+                {
+                    return false;
+                }
+            }
+
+            std::vector<std::vector<size_t>> dependents(declarations.size());
+            std::vector<uint32_t> pending(declarations.size(), 0);
+            std::vector<std::pair<uint64_t, size_t>> keys(declarations.size());
+            for (size_t i = 0; i < declarations.size(); ++i)
+            {
+                const Instruction& declaration = declarations[i];
+                const uint32_t resultWord = DeclarationResultWord(declaration.opcode);
+                std::unordered_set<size_t> dependencies;
+                for (uint32_t word = 1; word < declaration.wordCount; ++word)
+                {
+                    auto it = word == resultWord ? indexById.end() : indexById.find(declaration.words[word]);
+                    if (it != indexById.end() && it->second != i && dependencies.insert(it->second).second)
+                    {
+                        dependents[it->second].push_back(i);
+                        ++pending[i];
+                    }
+                }
+                keys[i] = { HashBytes64(declaration.words, declaration.wordCount * sizeof(uint32_t)), i };
+            }
+
+            std::vector<std::pair<uint64_t, size_t>> ready; // min-heap on (hash, original index)
+            auto later = [](const std::pair<uint64_t, size_t>& a, const std::pair<uint64_t, size_t>& b) { return a > b; };
+            for (size_t i = 0; i < declarations.size(); ++i)
+            {
+                if (pending[i] == 0)
+                {
+                    ready.push_back(keys[i]);
+                }
+            }
+            std::make_heap(ready.begin(), ready.end(), later);
+
+            order.clear();
+            while (!ready.empty())
+            {
+                std::pop_heap(ready.begin(), ready.end(), later);
+                const size_t next = ready.back().second;
+                ready.pop_back();
+                order.push_back(next);
+
+                for (size_t dependent : dependents[next])
+                {
+                    if (--pending[dependent] == 0)
+                    {
+                        ready.push_back(keys[dependent]);
+                        std::push_heap(ready.begin(), ready.end(), later);
+                    }
+                }
+            }
+            return order.size() == declarations.size();
+        }
+    }
+
+    bool SortDeclarations(const uint32_t* words, size_t wordCount, std::vector<uint32_t>& output)
+    {
+        output.clear();
+
+        std::vector<Instruction> preamble;
+        std::vector<Instruction> declarations;
+        std::vector<std::pair<size_t, size_t>> functions; // word ranges, OpFunction through OpFunctionEnd
+        std::vector<bool> hasBody;
+        bool inFunction = false;
+        bool malformed = false;
+        const bool valid = ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+            if (instruction.opcode == SpvOpFunction)
+            {
+                if (inFunction)
+                {
+                    malformed = true;
+                    return false;
+                }
+                inFunction = true;
+                functions.emplace_back(instruction.offset, instruction.offset);
+                hasBody.push_back(false);
+            }
+
+            if (inFunction)
+            {
+                functions.back().second = instruction.offset + instruction.wordCount;
+                hasBody.back() = hasBody.back() || instruction.opcode == SpvOpLabel;
+                inFunction = instruction.opcode != SpvOpFunctionEnd;
+            }
+            else if (!functions.empty())
+            {
+                malformed = true; // nothing may follow the function section
+                return false;
+            }
+            else if (declarations.empty() && IsPreambleInstruction(instruction.opcode))
+            {
+                preamble.push_back(instruction);
+            }
+            else
+            {
+                declarations.push_back(instruction);
+            }
+            return true;
+        });
+
+        if (!valid || malformed || inFunction)
+        {
+            return false;
+        }
+
+        output.reserve(wordCount);
+        output.assign(words, words + kHeaderWordCount);
+        for (const Instruction& instruction : preamble)
+        {
+            output.insert(output.end(), instruction.words, instruction.words + instruction.wordCount);
+        }
+
+        std::vector<size_t> order;
+        if (!OrderDeclarations(declarations, order))
+        {
+            order.resize(declarations.size());
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+        }
+        for (size_t index : order)
+        {
+            const Instruction& instruction = declarations[index];
+            output.insert(output.end(), instruction.words, instruction.words + instruction.wordCount);
+        }
+
+        // Function declarations (imports without a body) must precede every definition, as in
+        // SPIRVLinker; within each group calls may go forward, so the hash order is valid.
+        std::vector<std::tuple<bool, uint64_t, size_t>> functionOrder(functions.size());
+        for (size_t i = 0; i < functions.size(); ++i)
+        {
+            const auto [begin, end] = functions[i];
+            functionOrder[i] = { hasBody[i], HashBytes64(words + begin, (end - begin) * sizeof(uint32_t)), i };
+        }
+        std::sort(functionOrder.begin(), functionOrder.end());
+        for (const auto& [definition, hash, index] : functionOrder)
+        {
+            output.insert(output.end(), words + functions[index].first, words + functions[index].second);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,235 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SPIRV_MODULE_H
+#define _SPIRV_MODULE_H
+
+#pragma once
+
+// Internal header: lightweight SPIR-V instruction walker and flat id tables
+// used by the native reflection backend. Not installed.
+
+#include "ShaderCompiler.h"
+
+#include <string_view>
+
+#include <spirv_cross/spirv.h>
+
+namespace ignite::spirv
+{
+    constexpr uint32_t kHeaderWordCount = 5;
+    constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    // One instruction in a word stream; words[0] holds the opcode/word-count pair.
+    struct Instruction
+    {
+        SpvOp opcode = SpvOpNop;
+        uint32_t wordCount = 0;
+        const uint32_t* words = nullptr;
+        size_t offset = 0; // word offset inside the module
+
+        uint32_t Operand(uint32_t index) const { return index + 1 < wordCount ? words[index + 1] : 0; }
+    };
+
+    // Returns true if the stream starts with a SPIR-V header.
+    inline bool HasValidHeader(const uint32_t* words, size_t wordCount)
+    {
+        return words && wordCount >= kHeaderWordCount && words[0] == SpvMagicNumber;
+    }
+
+    // Reads a null-terminated literal string starting at words[first].
+    // Returns an empty view if the terminator is missing.
+    inline std::string_view ReadString(const Instruction& instruction, uint32_t first, uint32_t* outWordCount = nullptr)
+    {
+        if (first >= instruction.wordCount)
+        {
+            return {};
+        }
+
+        const char* begin = reinterpret_cast<const char*>(instruction.words + first);
+        const size_t maxLength = size_t(instruction.wordCount - first) * sizeof(uint32_t);
+        const void* terminator = std::memchr(begin, '\0', maxLength);
+        if (!terminator)
+        {
+            return {};
+        }
+
+        const size_t length = static_cast<const char*>(terminator) - begin;
+        if (outWordCount)
+        {
+            *outWordCount = static_cast<uint32_t>(length / sizeof(uint32_t) + 1);
+        }
+        return std::string_view(begin, length);
+    }
+
+    // Calls fn(const Instruction&) for every instruction after the header.
+    // fn returns false to stop early. Returns false on a malformed stream.
+    template<typename Fn>
+    bool ForEachInstruction(const uint32_t* words, size_t wordCount, Fn&& fn)
+    {
+        if (!HasValidHeader(words, wordCount))
+        {
+            return false;
+        }
+
+        size_t offset = kHeaderWordCount;
+        while (offset < wordCount)
+        {
+            const uint32_t first = words[offset];
+            const uint32_t count = first >> SpvWordCountShift;
+            if (count == 0 || offset + count > wordCount)
+            {
+                return false;
+            }
+
+            Instruction instruction;
+            instruction.opcode = static_cast<SpvOp>(first & SpvOpCodeMask);
+            instruction.wordCount = count;
+            instruction.words = words + offset;
+            instruction.offset = offset;
+            if (!fn(instruction))
+            {
+                return true;
+            }
+
+            offset += count;
+        }
+        return true;
+    }
+
+    // Per-id record. Which fields are meaningful depends on opcode:
+    //   OpTypeInt            args = { width, signedness }
+    //   OpTypeFloat          args = { width }
+    //   OpTypeVector/Matrix  args = { component/column type, count }
+    //   OpTypeArray          args = { element type, length constant id }
+    //   OpTypeRuntimeArray   args = { element type }
+    //   OpTypePointer        args = { storage class, pointee type }
+    //   OpTypeImage          args = { sampled type, dim, sampled }
+    //   OpTypeSampledImage   args = { image type }
+    //   OpTypeStruct         firstMember/memberCount index Module::members
+    //   OpVariable           resultType = pointer type, args = { storage class }
+    //   Op*Constant*         resultType, value = literal words (bools as 0/1)
+    //   Op*ConstantComposite args = first three constituents
+    struct IdRecord
+    {
+        SpvOp opcode = SpvOpNop;
+        uint32_t resultType = 0;
+        uint32_t args[3] = {};
+        uint32_t value[2] = {};
+        uint32_t firstMember = kInvalidIndex;
+        uint32_t memberCount = 0;
+
+        std::string_view name;
+        uint64_t decorations = 0; // bit per decoration value < 64
+        uint32_t binding = 0;
+        uint32_t set = 0;
+        uint32_t location = 0;
+        uint32_t component = 0;
+        uint32_t specId = 0;
+        uint32_t arrayStride = 0;
+        uint32_t builtIn = 0;
+    };
+
+    struct MemberRecord
+    {
+        uint32_t typeId = 0;
+        std::string_view name;
+        uint64_t decorations = 0;
+        uint32_t offset = 0;
+        uint32_t matrixStride = 0;
+        uint32_t builtIn = 0;
+        uint32_t location = 0;
+        uint32_t component = 0;
+    };
+
+    // OpMemberName/OpMemberDecorate seen before the struct they refer to.
+    struct MemberAnnotation
+    {
+        uint32_t structId = 0;
+        uint32_t member = 0;
+        SpvDecoration decoration = SpvDecorationMax; // SpvDecorationMax marks an OpMemberName
+        uint32_t value = 0;
+        std::string_view name;
+    };
+
+    // Flat tables built by one pass over a module. Strings are views into the
+    // module words, so the words must outlive the tables.
+    struct Module
+    {
+        uint32_t version = 0;
+        uint32_t bound = 0;
+
+        std::vector<IdRecord> ids;
+        std::vector<MemberRecord> members;
+        std::vector<MemberAnnotation> pendingMembers;
+        std::vector<uint32_t> variables; // global OpVariable ids in declaration order
+        std::vector<uint32_t> specConstants; // scalar OpSpecConstant* ids in declaration order
+
+        SpvExecutionModel executionModel = SpvExecutionModelMax;
+        uint32_t entryFunction = 0;
+        std::string_view entryName;
+        std::vector<uint32_t> interfaceIds;
+        uint32_t localSize[3] = {}; // OpExecutionMode LocalSize
+        uint32_t localSizeIds[3] = {}; // OpExecutionModeId LocalSizeId
+        uint32_t workgroupSizeId = 0; // constant composite decorated BuiltIn WorkgroupSize
+
+        // Clears the tables while keeping their capacity.
+        void Reset();
+
+        bool HasDecoration(uint32_t id, SpvDecoration decoration) const;
+        bool HasMemberDecoration(const MemberRecord& member, SpvDecoration decoration) const;
+
+        const IdRecord* Find(uint32_t id) const { return id < ids.size() ? &ids[id] : nullptr; }
+
+        // Strips OpTypePointer and array wrappers.
+        uint32_t BaseType(uint32_t typeId) const;
+
+        // Descriptors bound by a variable of this (pointer) type: the product of its array
+        // dimensions, 1 for non-arrays. A runtime array sets *outUnbounded and returns 0.
+        uint32_t DescriptorCount(uint32_t typeId, bool* outUnbounded) const;
+
+        // Scalar value of a 32/64-bit integer or boolean constant; fallback if not a constant.
+        uint64_t ConstantValue(uint32_t id, uint64_t fallback = 0) const;
+
+        // Byte size as SPIRV-Cross's get_declared_struct_size computes it; 0 on failure.
+        uint32_t DeclaredStructSize(uint32_t structId, uint32_t depth = 0) const;
+        uint32_t DeclaredMemberSize(uint32_t structId, uint32_t memberIndex, uint32_t depth = 0) const;
+
+        // Size and alignment under std430 rules, for types without explicit layout (Workgroup memory).
+        uint32_t Std430Size(uint32_t typeId, uint32_t* outAlignment = nullptr, uint32_t depth = 0) const;
+
+        bool IsInInterface(uint32_t id) const;
+        bool IsBuiltInVariable(uint32_t variableId) const;
+    };
+
+    // Parses the first entry point's view of a module into flat tables.
+    // Returns false if the stream is malformed.
+    bool ParseModule(const uint32_t* words, size_t wordCount, Module& module);
+
+    // Fills resources, push constants and stage IO the same way the SPIRV-Cross
+    // backend classifies them. Counters and vertex attributes are left to the caller.
+    bool Reflect(const uint32_t* words, size_t wordCount, ShaderReflectionInfo& info);
+
+    // Rewrites the default of every scalar specialization constant whose SpecId has a value,
+    // in place (literal words for OpSpecConstant, the opcode for OpSpecConstantTrue/False).
+    // The constants stay specializable. Returns false on a malformed stream.
+    bool SetSpecConstantDefaults(uint32_t* words, size_t wordCount, const std::vector<SpecializationConstantValue>& values);
+
+    // Copies a module without its debug instructions: OpSource*, OpString, OpName, OpMemberName,
+    // OpLine, OpNoLine, OpModuleProcessed and every NonSemantic.* instruction set with its
+    // OpExtInst and OpExtInstWithForwardRefsKHR uses, dropping SPV_KHR_non_semantic_info and,
+    // once nothing needs it, SPV_KHR_relaxed_extended_instruction. Ids and the bound are kept,
+    // so the result lines up with the input.
+    // Returns false on a malformed stream.
+    bool StripDebugInstructions(const uint32_t* words, size_t wordCount, std::vector<uint32_t>& output);
+
+    // Copies a module with its function declarations, then its function definitions, each group
+    // sorted by content hash, and its types, constants and global variables in dependency order
+    // with ties broken by content hash. Both orders depend only on the instruction words, so
+    // modules with canonical ids come out in canonical order.
+    // The declaration section is left as is when it holds anything else (OpLine, OpExtInst,
+    // forward pointers, ...) or its dependencies cannot be ordered. Returns false on a
+    // malformed stream.
+    bool SortDeclarations(const uint32_t* words, size_t wordCount, std::vector<uint32_t>& output);
+}
+
+#endif
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "SPIRVOptimizer.h"
+#include "ShaderLog.h"
+#include "SPIRVModule.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include <spirv-tools/libspirv.h>
+
+namespace ignite::spirv
+{
+    namespace
+    {
+        // Vulkan environments, so the validator applies the rules drivers will. Library modules
+        // (Linkage capability) are not Vulkan modules and get the universal ones.
+        spv_target_env TargetEnvironment(const uint32_t* words, size_t wordCount)
+        {
+            const uint32_t version = words[1];
+
+            bool linkage = false;
+            ForEachInstruction(words, wordCount, [&](const Instruction& instruction) {
+                linkage = linkage || (instruction.opcode == SpvOpCapability && instruction.Operand(0) == SpvCapabilityLinkage);
+                return instruction.opcode == SpvOpCapability;
+            });
+            if (linkage)
+            {
+                if (version >= 0x10600) return SPV_ENV_UNIVERSAL_1_6;
+                if (version >= 0x10500) return SPV_ENV_UNIVERSAL_1_5;
+                if (version >= 0x10400) return SPV_ENV_UNIVERSAL_1_4;
+                if (version >= 0x10300) return SPV_ENV_UNIVERSAL_1_3;
+                if (version >= 0x10200) return SPV_ENV_UNIVERSAL_1_2;
+                if (version >= 0x10100) return SPV_ENV_UNIVERSAL_1_1;
+                return SPV_ENV_UNIVERSAL_1_0;
+            }
+
+            if (version >= 0x10600) return SPV_ENV_VULKAN_1_3;
+            if (version >= 0x10500) return SPV_ENV_VULKAN_1_2;
+            if (version >= 0x10400) return SPV_ENV_VULKAN_1_1_SPIRV_1_4;
+            if (version >= 0x10100) return SPV_ENV_VULKAN_1_1;
+            return SPV_ENV_VULKAN_1_0;
+        }
+
+        void ForwardMessage(spv_message_level_t level, const char* source, const spv_position_t* position, const char* message)
+        {
+            (void)source;
+
+            IGNITE_LogType type = IGNITE_LOG_TYPE_INFO;
+            if (level <= SPV_MSG_ERROR)
+            {
+                type = IGNITE_LOG_TYPE_ERROR;
+            }
+            else if (level == SPV_MSG_WARNING)
+            {
+                type = IGNITE_LOG_TYPE_WARNING;
+            }
+
+            std::string text = "spirv-opt: " + std::string(message ? message : "");
+            if (position && position->index != 0)
+            {
+                text += " (word " + std::to_string(position->index) + ")";
+            }
+            DispatchLog(type, text);
+        }
+
+        // Creates an optimizer for the module's environment, lets registerPasses fill it and runs it.
+        template<typename RegisterPasses>
+        bool Optimize(const uint32_t* words, size_t wordCount, RegisterPasses&& registerPasses, std::vector<uint32_t>& output, bool validate)
+        {
+            if (!HasValidHeader(words, wordCount))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "spirv-opt: input is not a SPIR-V module.");
+                return false;
+            }
+
+            spv_optimizer_t* optimizer = spvOptimizerCreate(TargetEnvironment(words, wordCount));
+            if (!optimizer)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "spirv-opt: could not create optimizer.");
+                return false;
+            }
+            spvOptimizerSetMessageConsumer(optimizer, ForwardMessage);
+
+            if (!registerPasses(optimizer))
+            {
+                spvOptimizerDestroy(optimizer);
+                return false;
+            }
+
+            spv_optimizer_options options = spvOptimizerOptionsCreate();
+            spvOptimizerOptionsSetRunValidator(options, validate);
+            spv_binary binary = nullptr;
+            const spv_result_t result = spvOptimizerRun(optimizer, words, wordCount, &binary, options);
+            spvOptimizerOptionsDestroy(options);
+            spvOptimizerDestroy(optimizer);
+
+            if (result != SPV_SUCCESS || !binary)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "spirv-opt: optimization failed (" + std::to_string(int(result)) + ").");
+                spvBinaryDestroy(binary);
+                return false;
+            }
+
+            output.assign(binary->code, binary->code + binary->wordCount);
+            spvBinaryDestroy(binary);
+            return true;
+        }
+    }
+
+    bool IsPassAvailable(const std::string& flag)
+    {
+        static std::mutex mutex;
+        static std::unordered_map<std::string, bool> known;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = known.find(flag);
+        if (it != known.end())
+        {
+            return it->second;
+        }
+
+        bool available = false;
+        if (spv_optimizer_t* optimizer = spvOptimizerCreate(SPV_ENV_VULKAN_1_0))
+        {
+            available = spvOptimizerRegisterPassFromFlag(optimizer, flag.c_str());
+            spvOptimizerDestroy(optimizer);
+        }
+        known.emplace(flag, available);
+        return available;
+    }
+
+    bool RunOptimizer(const uint32_t* words, size_t wordCount, const std::vector<std::string>& flags, std::vector<uint32_t>& output, bool validate)
+    {
+        return Optimize(words, wordCount, [&flags](spv_optimizer_t* optimizer) {
+            for (const std::string& flag : flags)
+            {
+                if (!spvOptimizerRegisterPassFromFlag(optimizer, flag.c_str()))
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "spirv-opt: unknown pass flag '" + flag + "'.");
+                    return false;
+                }
+            }
+            return true;
+        }, output, validate);
+    }
+
+    bool RunRecipe(const uint32_t* words, size_t wordCount, IGNITE_SPIRVOptimizerRecipe recipe, std::vector<uint32_t>& output)
+    {
+        return Optimize(words, wordCount, [recipe](spv_optimizer_t* optimizer) {
+            switch (recipe)
+            {
+            case IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE:
+                spvOptimizerRegisterLegalizationPasses(optimizer);
+                return true;
+            case IGNITE_SPIRV_OPTIMIZER_RECIPE_SIZE:
+                spvOptimizerRegisterSizePasses(optimizer);
+                return true;
+            case IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE:
+                spvOptimizerRegisterPerformancePasses(optimizer);
+                return true;
+            default:
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, std::string("spirv-opt: ") + IGNITE_SPIRVOptimizerRecipeToString(recipe) + " is not a built-in recipe.");
+                return false;
+            }
+        }, output, true);
+    }
+
+    const char* RecipeFlag(IGNITE_SPIRVOptimizerRecipe recipe)
+    {
+        switch (recipe)
+        {
+        case IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE: return "--legalize-hlsl";
+        case IGNITE_SPIRV_OPTIMIZER_RECIPE_SIZE: return "-Os";
+        case IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE: return "-O";
+        default: return nullptr;
+        }
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SPIRV_OPTIMIZER_H
+#define _SPIRV_OPTIMIZER_H
+
+#pragma once
+
+// Internal header: thin wrapper over the SPIRV-Tools optimizer C API. Not installed.
+
+#include "ShaderCompiler.h"
+
+namespace ignite::spirv
+{
+    // Runs spirv-opt passes over a module. Each flag is a spirv-opt command-line pass flag
+    // ("--freeze-spec-const", "-O", "-Os"); passes run in the order given. The target
+    // environment follows the module's SPIR-V version; modules declaring the Linkage
+    // capability get the universal environment, which Vulkan's does not allow. validate
+    // = false skips the validator, for intermediate modules such as a merge before
+    // --remove-duplicates. Diagnostics go to the log callback.
+    // Returns false if a flag is unknown or a pass fails.
+    bool RunOptimizer(const uint32_t* words, size_t wordCount, const std::vector<std::string>& flags, std::vector<uint32_t>& output, bool validate = true);
+
+    // True if the linked SPIRV-Tools knows the pass flag. The answer is cached per flag.
+    bool IsPassAvailable(const std::string& flag);
+
+    // Runs a built-in recipe (LEGALIZE, SIZE or PERFORMANCE) with the pass list the linked
+    // SPIRV-Tools registers for --legalize-hlsl, -Os or -O, so the pipeline always matches the
+    // library version. Returns false for other recipes or if a pass fails.
+    bool RunRecipe(const uint32_t* words, size_t wordCount, IGNITE_SPIRVOptimizerRecipe recipe, std::vector<uint32_t>& output);
+
+    // spirv-opt flag naming a built-in recipe ("-O", "-Os", "--legalize-hlsl"); nullptr for others.
+    const char* RecipeFlag(IGNITE_SPIRVOptimizerRecipe recipe);
+}
+
+#endif
@@ -0,0 +1,438 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "ShaderArchive.h"
+#include "ShaderLog.h"
+#include "ShaderUtils.h"
+
+#include <algorithm>
+#include <bit>
+#include <tuple>
+
+#ifndef _WIN32
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace ignite
+{
+    static_assert(std::endian::native == std::endian::little, "Shader archives are written and mapped in host order and must be little-endian");
+
+    namespace
+    {
+        uint32_t NextPowerOfTwo(uint32_t value)
+        {
+            uint32_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        template<typename T>
+        void WriteAt(std::vector<uint8_t>& image, uint64_t offset, const T& value)
+        {
+            std::memcpy(image.data() + offset, &value, sizeof(T));
+        }
+    }
+
+    uint64_t HashShaderArchiveKey(std::string_view name, IGNITE_ShaderType stage, IGNITE_ShaderPlatformType platform, uint32_t permutationId)
+    {
+        const uint64_t seed = (static_cast<uint64_t>(permutationId) << 16)
+            | (static_cast<uint64_t>(platform & 0xFF) << 8)
+            | static_cast<uint64_t>(stage & 0xFF);
+        return HashBytes64(name.data(), name.size(), seed);
+    }
+
+    void ShaderArchiveWriter::AddShader(const ShaderArchiveKey& key, const std::vector<uint8_t>& blob, const std::vector<uint8_t>& reflection)
+    {
+        const uint64_t keyHash = HashShaderArchiveKey(key.name, key.stage, key.platform, key.permutationId);
+        const auto [first, last] = m_index.equal_range(keyHash);
+        for (auto it = first; it != last; ++it)
+        {
+            PendingEntry& entry = m_entries[it->second];
+            if (entry.key.name == key.name && entry.key.stage == key.stage
+                && entry.key.platform == key.platform && entry.key.permutationId == key.permutationId)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "Shader archive: replacing duplicate entry " + key.name);
+                entry.blob = blob;
+                entry.reflection = reflection;
+                return;
+            }
+        }
+
+        m_index.emplace(keyHash, m_entries.size());
+        PendingEntry& entry = m_entries.emplace_back();
+        entry.key = key;
+        entry.keyHash = keyHash;
+        entry.blob = blob;
+        entry.reflection = reflection;
+    }
+
+    std::vector<uint8_t> ShaderArchiveWriter::Serialize() const
+    {
+        std::vector<const PendingEntry*> sorted;
+        sorted.reserve(m_entries.size());
+        for (const PendingEntry& entry : m_entries)
+        {
+            sorted.push_back(&entry);
+        }
+
+        std::sort(sorted.begin(), sorted.end(), [](const PendingEntry* a, const PendingEntry* b) {
+            return std::tie(a->keyHash, a->key.name, a->key.stage, a->key.platform, a->key.permutationId)
+                < std::tie(b->keyHash, b->key.name, b->key.stage, b->key.platform, b->key.permutationId);
+        });
+
+        const uint32_t entryCount = static_cast<uint32_t>(sorted.size());
+        const uint32_t bucketCount = NextPowerOfTwo(std::max<uint32_t>(entryCount * 2, 1));
+
+        ShaderArchiveHeader header = {};
+        header.magic = SHADER_ARCHIVE_MAGIC;
+        header.version = SHADER_ARCHIVE_VERSION;
+        header.entryCount = entryCount;
+        header.bucketCount = bucketCount;
+        header.entriesOffset = AlignUp<uint64_t>(sizeof(ShaderArchiveHeader), SHADER_ARCHIVE_ALIGNMENT);
+        header.bucketsOffset = AlignUp<uint64_t>(header.entriesOffset + uint64_t(entryCount) * sizeof(ShaderArchiveEntry), SHADER_ARCHIVE_ALIGNMENT);
+        header.stringsOffset = AlignUp<uint64_t>(header.bucketsOffset + uint64_t(bucketCount) * sizeof(uint32_t), SHADER_ARCHIVE_ALIGNMENT);
+
+        std::vector<ShaderArchiveEntry> entries(entryCount);
+        uint64_t stringsSize = 0;
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            entries[i].nameOffset = static_cast<uint32_t>(stringsSize);
+            entries[i].nameLength = static_cast<uint32_t>(sorted[i]->key.name.size());
+            stringsSize += sorted[i]->key.name.size() + 1;
+        }
+        header.stringsSize = stringsSize;
+        header.dataOffset = AlignUp<uint64_t>(header.stringsOffset + stringsSize, SHADER_ARCHIVE_ALIGNMENT);
+
+        uint64_t cursor = header.dataOffset;
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            const PendingEntry& source = *sorted[i];
+            ShaderArchiveEntry& entry = entries[i];
+            entry.keyHash = source.keyHash;
+            entry.permutationId = source.key.permutationId;
+            entry.stage = static_cast<uint8_t>(source.key.stage);
+            entry.platform = static_cast<uint8_t>(source.key.platform);
+            entry.flags = 0;
+
+            entry.blobOffset = cursor;
+            entry.blobSize = source.blob.size();
+            cursor = AlignUp<uint64_t>(cursor + entry.blobSize, SHADER_ARCHIVE_ALIGNMENT);
+
+            if (!source.reflection.empty())
+            {
+                entry.reflectionOffset = cursor;
+                entry.reflectionSize = source.reflection.size();
+                cursor = AlignUp<uint64_t>(cursor + entry.reflectionSize, SHADER_ARCHIVE_ALIGNMENT);
+            }
+        }
+        header.fileSize = cursor;
+
+        std::vector<uint8_t> image(static_cast<size_t>(header.fileSize), 0);
+        WriteAt(image, 0, header);
+
+        std::vector<uint32_t> buckets(bucketCount, SHADER_ARCHIVE_EMPTY_BUCKET);
+        const uint32_t bucketMask = bucketCount - 1;
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            const ShaderArchiveEntry& entry = entries[i];
+            const PendingEntry& source = *sorted[i];
+
+            WriteAt(image, header.entriesOffset + uint64_t(i) * sizeof(ShaderArchiveEntry), entry);
+            std::memcpy(image.data() + header.stringsOffset + entry.nameOffset, source.key.name.data(), source.key.name.size());
+
+            if (!source.blob.empty())
+            {
+                std::memcpy(image.data() + entry.blobOffset, source.blob.data(), source.blob.size());
+            }
+
+            if (!source.reflection.empty())
+            {
+                std::memcpy(image.data() + entry.reflectionOffset, source.reflection.data(), source.reflection.size());
+            }
+
+            uint32_t slot = static_cast<uint32_t>(entry.keyHash) & bucketMask;
+            while (buckets[slot] != SHADER_ARCHIVE_EMPTY_BUCKET)
+            {
+                slot = (slot + 1) & bucketMask;
+            }
+            buckets[slot] = i;
+        }
+
+        std::memcpy(image.data() + header.bucketsOffset, buckets.data(), buckets.size() * sizeof(uint32_t));
+        return image;
+    }
+
+    bool ShaderArchiveWriter::Write(const std::filesystem::path& filepath) const
+    {
+        const std::vector<uint8_t> image = Serialize();
+        const std::string path = filepath.generic_string();
+
+        DataOutputContext context(path.c_str(), false);
+        if (!context.stream)
+        {
+            return false;
+        }
+
+        if (!context.WriteDataAsBinary(image.data(), image.size()) || !context.Flush())
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Shader archive: failed to write " + path);
+            return false;
+        }
+
+        DispatchLog(IGNITE_LOG_TYPE_INFO, "Writing shader archive (" + std::to_string(m_entries.size()) + " entries): " + path);
+        return true;
+    }
+
+    // Read-only file mapping owned by the reader.
+    struct ShaderArchiveReader::MappedFile
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#endif
+
+        ~MappedFile()
+        {
+#ifdef _WIN32
+            if (data)
+            {
+                UnmapViewOfFile(data);
+            }
+            if (mapping)
+            {
+                CloseHandle(mapping);
+            }
+            if (file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(file);
+            }
+#else
+            if (data)
+            {
+                munmap(const_cast<uint8_t*>(data), size);
+            }
+#endif
+        }
+
+        bool Map(const std::filesystem::path& filepath)
+        {
+#ifdef _WIN32
+            file = CreateFileW(filepath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+
+            LARGE_INTEGER fileSize = {};
+            if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+            {
+                return false;
+            }
+
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping)
+            {
+                return false;
+            }
+
+            data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = static_cast<size_t>(fileSize.QuadPart);
+            return data != nullptr;
+#else
+            const int fd = open(filepath.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                return false;
+            }
+
+            struct stat fileStat = {};
+            if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+            {
+                close(fd);
+                return false;
+            }
+
+            void* mapped = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (mapped == MAP_FAILED)
+            {
+                return false;
+            }
+
+            data = static_cast<const uint8_t*>(mapped);
+            size = static_cast<size_t>(fileStat.st_size);
+            return true;
+#endif
+        }
+    };
+
+    ShaderArchiveReader::ShaderArchiveReader() = default;
+
+    ShaderArchiveReader::~ShaderArchiveReader()
+    {
+        Close();
+    }
+
+    bool ShaderArchiveReader::Open(const std::filesystem::path& filepath)
+    {
+        Close();
+
+        std::unique_ptr<MappedFile> file = std::make_unique<MappedFile>();
+        if (!file->Map(filepath))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Shader archive: cannot map " + filepath.generic_string());
+            return false;
+        }
+
+        if (!Attach(file->data, file->size))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Shader archive: invalid archive " + filepath.generic_string());
+            return false;
+        }
+
+        m_file = std::move(file);
+        return true;
+    }
+
+    bool ShaderArchiveReader::OpenMemory(const void* data, size_t size)
+    {
+        Close();
+
+        if (!Attach(static_cast<const uint8_t*>(data), size))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Shader archive: invalid in-memory archive.");
+            return false;
+        }
+        return true;
+    }
+
+    void ShaderArchiveReader::Close()
+    {
+        m_file.reset();
+        m_data = nullptr;
+        m_size = 0;
+        m_header = nullptr;
+        m_entries = nullptr;
+        m_buckets = nullptr;
+        m_strings = nullptr;
+    }
+
+    bool ShaderArchiveReader::Attach(const uint8_t* data, size_t size)
+    {
+        if (!data || size < sizeof(ShaderArchiveHeader) || (reinterpret_cast<uintptr_t>(data) % alignof(ShaderArchiveHeader)) != 0)
+        {
+            return false;
+        }
+
+        // Only the section table is validated; entries are trusted as written.
+        const ShaderArchiveHeader* header = reinterpret_cast<const ShaderArchiveHeader*>(data);
+        const bool valid = header->magic == SHADER_ARCHIVE_MAGIC
+            && header->version == SHADER_ARCHIVE_VERSION
+            && header->fileSize <= size
+            && header->bucketCount != 0
+            && (header->bucketCount & (header->bucketCount - 1)) == 0
+            && header->bucketCount > header->entryCount
+            && header->entriesOffset % SHADER_ARCHIVE_ALIGNMENT == 0
+            && header->bucketsOffset % SHADER_ARCHIVE_ALIGNMENT == 0
+            && header->entriesOffset + uint64_t(header->entryCount) * sizeof(ShaderArchiveEntry) <= header->bucketsOffset
+            && header->bucketsOffset + uint64_t(header->bucketCount) * sizeof(uint32_t) <= header->stringsOffset
+            && header->stringsOffset + header->stringsSize <= header->dataOffset
+            && header->dataOffset <= header->fileSize;
+
+        if (!valid)
+        {
+            return false;
+        }
+
+        m_data = data;
+        m_size = size;
+        m_header = header;
+        m_entries = reinterpret_cast<const ShaderArchiveEntry*>(data + header->entriesOffset);
+        m_buckets = reinterpret_cast<const uint32_t*>(data + header->bucketsOffset);
+        m_strings = reinterpret_cast<const char*>(data + header->stringsOffset);
+        return true;
+    }
+
+    ShaderBlobView ShaderArchiveReader::Find(std::string_view name, IGNITE_ShaderType stage, IGNITE_ShaderPlatformType platform, uint32_t permutationId) const
+    {
+        if (!m_header || m_header->entryCount == 0)
+        {
+            return {};
+        }
+
+        const uint64_t keyHash = HashShaderArchiveKey(name, stage, platform, permutationId);
+        const uint32_t bucketMask = m_header->bucketCount - 1;
+
+        // A valid table always has an empty bucket; the probe bound only matters for corrupt archives.
+        uint32_t slot = static_cast<uint32_t>(keyHash) & bucketMask;
+        for (uint32_t probe = 0; probe < m_header->bucketCount; ++probe, slot = (slot + 1) & bucketMask)
+        {
+            const uint32_t index = m_buckets[slot];
+            if (index == SHADER_ARCHIVE_EMPTY_BUCKET || index >= m_header->entryCount)
+            {
+                return {};
+            }
+
+            const ShaderArchiveEntry& entry = m_entries[index];
+            if (entry.keyHash == keyHash
+                && entry.stage == static_cast<uint8_t>(stage)
+                && entry.platform == static_cast<uint8_t>(platform)
+                && entry.permutationId == permutationId
+                && GetEntryName(index) == name)
+            {
+                return GetBlob(index);
+            }
+        }
+        return {};
+    }
+
+    ShaderBlobView ShaderArchiveReader::Find(const ShaderArchiveKey& key) const
+    {
+        return Find(key.name, key.stage, key.platform, key.permutationId);
+    }
+
+    const ShaderArchiveEntry* ShaderArchiveReader::GetEntry(size_t index) const
+    {
+        if (!m_header || index >= m_header->entryCount)
+        {
+            return nullptr;
+        }
+        return &m_entries[index];
+    }
+
+    std::string_view ShaderArchiveReader::GetEntryName(size_t index) const
+    {
+        const ShaderArchiveEntry* entry = GetEntry(index);
+        if (!entry || uint64_t(entry->nameOffset) + entry->nameLength > m_header->stringsSize)
+        {
+            return {};
+        }
+        return std::string_view(m_strings + entry->nameOffset, entry->nameLength);
+    }
+
+    ShaderBlobView ShaderArchiveReader::GetBlob(size_t index) const
+    {
+        const ShaderArchiveEntry* entry = GetEntry(index);
+        if (!entry || entry->blobOffset + entry->blobSize > m_header->fileSize)
+        {
+            return {};
+        }
+
+        ShaderBlobView view = {};
+        view.data = m_data + entry->blobOffset;
+        view.size = static_cast<size_t>(entry->blobSize);
+        if (entry->reflectionSize > 0 && entry->reflectionOffset + entry->reflectionSize <= m_header->fileSize)
+        {
+            view.reflection = m_data + entry->reflectionOffset;
+            view.reflectionSize = static_cast<size_t>(entry->reflectionSize);
+        }
+        return view;
+    }
+}
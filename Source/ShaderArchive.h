@@ -0,0 +1,158 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_ARCHIVE_H
+#define _SHADER_ARCHIVE_H
+
+#pragma once
+
+#include "ShaderCompiler.h"
+
+#include <string_view>
+#include <unordered_map>
+
+namespace ignite
+{
+    /*
+     * Single-file container for compiled shader blobs.
+     *
+     * Layout (host byte order, which must be little-endian; every section 16-byte aligned):
+     *   ShaderArchiveHeader
+     *   ShaderArchiveEntry[entryCount]   sorted by (keyHash, name, stage, platform, permutationId)
+     *   uint32_t buckets[bucketCount]    open-addressing table of entry indices (power of two)
+     *   char strings[stringsSize]        null-terminated shader names
+     *   payloads                         blob and reflection records, 16-byte aligned
+     *
+     * The file is meant to be memory-mapped and used in place: lookups hash the
+     * key, probe the bucket table and return views into the mapping.
+     */
+
+    constexpr uint32_t SHADER_ARCHIVE_MAGIC = 0x52415349; // "ISAR"
+    constexpr uint32_t SHADER_ARCHIVE_VERSION = 1;
+    constexpr uint32_t SHADER_ARCHIVE_EMPTY_BUCKET = 0xFFFFFFFFu;
+    constexpr uint64_t SHADER_ARCHIVE_ALIGNMENT = 16;
+
+    struct ShaderArchiveHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t bucketCount;
+        uint64_t entriesOffset;
+        uint64_t bucketsOffset;
+        uint64_t stringsOffset;
+        uint64_t stringsSize;
+        uint64_t dataOffset;
+        uint64_t fileSize;
+    };
+    static_assert(sizeof(ShaderArchiveHeader) == 64, "ShaderArchiveHeader layout changed");
+
+    struct ShaderArchiveEntry
+    {
+        uint64_t keyHash;
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t permutationId;
+        uint8_t stage;
+        uint8_t platform;
+        uint16_t flags; // reserved, written as 0
+        uint64_t blobOffset;
+        uint64_t blobSize;
+        uint64_t reflectionOffset;
+        uint64_t reflectionSize;
+    };
+    static_assert(sizeof(ShaderArchiveEntry) == 56, "ShaderArchiveEntry layout changed");
+
+    // Identifies one compiled shader variant inside an archive.
+    struct ShaderArchiveKey
+    {
+        std::string name;
+        IGNITE_ShaderType stage = IGNITE_SHADER_TYPE_VERTEX;
+        IGNITE_ShaderPlatformType platform = IGNITE_SHADER_PLATFORM_TYPE_SPIRV;
+        uint32_t permutationId = 0;
+    };
+
+    // Non-owning view into archive memory; valid while the reader stays open.
+    struct ShaderBlobView
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        const uint8_t* reflection = nullptr;
+        size_t reflectionSize = 0;
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    // Hash used for the archive index; stable across runs and platforms.
+    IGNITECOMPILER_API uint64_t HashShaderArchiveKey(std::string_view name, IGNITE_ShaderType stage, IGNITE_ShaderPlatformType platform, uint32_t permutationId);
+
+    // Collects blobs in memory and writes them as one archive file.
+    class IGNITECOMPILER_API ShaderArchiveWriter
+    {
+    public:
+        // Adds or replaces a shader variant. Reflection bytes are optional and stored verbatim.
+        void AddShader(const ShaderArchiveKey& key, const std::vector<uint8_t>& blob, const std::vector<uint8_t>& reflection = {});
+
+        size_t GetEntryCount() const { return m_entries.size(); }
+
+        // Builds the complete archive image.
+        std::vector<uint8_t> Serialize() const;
+
+        // Serializes and writes the archive to disk.
+        bool Write(const std::filesystem::path& filepath) const;
+
+    private:
+        struct PendingEntry
+        {
+            ShaderArchiveKey key;
+            uint64_t keyHash = 0;
+            std::vector<uint8_t> blob;
+            std::vector<uint8_t> reflection;
+        };
+
+        std::vector<PendingEntry> m_entries;
+        std::unordered_multimap<uint64_t, size_t> m_index; // keyHash -> index into m_entries
+    };
+
+    // Memory-maps an archive and resolves keys to blob views in O(1).
+    class IGNITECOMPILER_API ShaderArchiveReader
+    {
+    public:
+        ShaderArchiveReader();
+        ~ShaderArchiveReader();
+
+        ShaderArchiveReader(const ShaderArchiveReader&) = delete;
+        ShaderArchiveReader& operator=(const ShaderArchiveReader&) = delete;
+
+        // Maps the file read-only; returns false if it is missing or malformed.
+        bool Open(const std::filesystem::path& filepath);
+
+        // Uses caller-owned memory (must outlive the reader and stay 8-byte aligned).
+        bool OpenMemory(const void* data, size_t size);
+
+        void Close();
+        bool IsOpen() const { return m_header != nullptr; }
+
+        ShaderBlobView Find(std::string_view name, IGNITE_ShaderType stage, IGNITE_ShaderPlatformType platform, uint32_t permutationId = 0) const;
+        ShaderBlobView Find(const ShaderArchiveKey& key) const;
+
+        size_t GetEntryCount() const { return m_header ? m_header->entryCount : 0; }
+        const ShaderArchiveEntry* GetEntry(size_t index) const;
+        std::string_view GetEntryName(size_t index) const;
+        ShaderBlobView GetBlob(size_t index) const;
+
+    private:
+        struct MappedFile;
+
+        bool Attach(const uint8_t* data, size_t size);
+
+        std::unique_ptr<MappedFile> m_file;
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        const ShaderArchiveHeader* m_header = nullptr;
+        const ShaderArchiveEntry* m_entries = nullptr;
+        const uint32_t* m_buckets = nullptr;
+        const char* m_strings = nullptr;
+    };
+}
+
+#endif
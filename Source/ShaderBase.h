@@ -5,8 +5,13 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #ifdef __cplusplus
+#   define IGNITE_CONSTEXPR constexpr
 extern "C" {
+#else
+#   define IGNITE_CONSTEXPR const
 #endif
 
 /*
@@ -31,6 +36,27 @@ typedef enum IGNITE_ShaderType
     IGNITE_SHADER_TYPE_TESSELLATION = 4
 } IGNITE_ShaderType;
 
+/* Stage visibility bits, one per IGNITE_ShaderType (1 << type). */
+typedef enum IGNITE_ShaderStageFlags
+{
+    IGNITE_SHADER_STAGE_VERTEX_BIT = 1 << IGNITE_SHADER_TYPE_VERTEX,
+    IGNITE_SHADER_STAGE_PIXEL_BIT = 1 << IGNITE_SHADER_TYPE_PIXEL,
+    IGNITE_SHADER_STAGE_GEOMETRY_BIT = 1 << IGNITE_SHADER_TYPE_GEOMETRY,
+    IGNITE_SHADER_STAGE_COMPUTE_BIT = 1 << IGNITE_SHADER_TYPE_COMPUTE,
+    IGNITE_SHADER_STAGE_TESSELLATION_BIT = 1 << IGNITE_SHADER_TYPE_TESSELLATION
+} IGNITE_ShaderStageFlags;
+
+/* Descriptor kinds, one per reflected resource list. */
+typedef enum IGNITE_DescriptorType
+{
+    IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER = 0,
+    IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+    IGNITE_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+    IGNITE_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    IGNITE_DESCRIPTOR_TYPE_SAMPLER,
+    IGNITE_DESCRIPTOR_TYPE_SAMPLED_IMAGE
+} IGNITE_DescriptorType;
+
 typedef enum IGNITE_ShaderPlatformType
 {
     IGNITE_SHADER_PLATFORM_TYPE_DXBC = 0,
@@ -53,15 +79,64 @@ typedef enum IGNITE_OptimizationLevel
     IGNITE_OPT_LEVEL_3 = 3
 } IGNITE_OptimizationLevel;
 
+/* spirv-opt pass pipeline run on SPIR-V output. DEFAULT follows the optimization level:
+   0 = NONE, 1 = LEGALIZE, 2 and 3 = PERFORMANCE; SIZE is only used when selected. CUSTOM runs a caller-supplied
+   list of pass flags. */
+typedef enum IGNITE_SPIRVOptimizerRecipe
+{
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_DEFAULT = 0,
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE = 1,
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE = 2,
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_SIZE = 3,
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE = 4,
+    IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM = 5
+} IGNITE_SPIRVOptimizerRecipe;
+
+/* Source language emitted by SPIRV-Cross from a SPIR-V blob (ShaderCompiler::CrossCompileSPIRV). */
+typedef enum IGNITE_CrossCompileTarget
+{
+    IGNITE_CROSS_COMPILE_TARGET_GLSL = 0,
+    IGNITE_CROSS_COMPILE_TARGET_ESSL = 1,
+    IGNITE_CROSS_COMPILE_TARGET_HLSL = 2,
+    IGNITE_CROSS_COMPILE_TARGET_MSL = 3
+} IGNITE_CrossCompileTarget;
+
 typedef enum IGNITE_ResultCode
 {
     IGNITE_RESULT_OK = 0,
     IGNITE_RESULT_INVALID_ARGUMENT = 1,
     IGNITE_RESULT_UNSUPPORTED_PLATFORM = 2,
     IGNITE_RESULT_COMPILATION_FAILED = 3,
-    IGNITE_RESULT_INTERNAL_ERROR = 4
+    IGNITE_RESULT_INTERNAL_ERROR = 4,
+    IGNITE_RESULT_NOT_FOUND = 5,
+    IGNITE_RESULT_BUFFER_TOO_SMALL = 6
 } IGNITE_ResultCode;
 
+typedef enum IGNITE_SPIRVReflectionBackend
+{
+    IGNITE_SPIRV_REFLECTION_BACKEND_NATIVE = 0,
+    IGNITE_SPIRV_REFLECTION_BACKEND_SPIRV_CROSS = 1
+} IGNITE_SPIRVReflectionBackend;
+
+/* Scalar component type of a reflected buffer member. */
+typedef enum IGNITE_ShaderDataType
+{
+    IGNITE_SHADER_DATA_TYPE_UNKNOWN = 0,
+    IGNITE_SHADER_DATA_TYPE_BOOL,
+    IGNITE_SHADER_DATA_TYPE_INT8,
+    IGNITE_SHADER_DATA_TYPE_UINT8,
+    IGNITE_SHADER_DATA_TYPE_INT16,
+    IGNITE_SHADER_DATA_TYPE_UINT16,
+    IGNITE_SHADER_DATA_TYPE_INT,
+    IGNITE_SHADER_DATA_TYPE_UINT,
+    IGNITE_SHADER_DATA_TYPE_INT64,
+    IGNITE_SHADER_DATA_TYPE_UINT64,
+    IGNITE_SHADER_DATA_TYPE_HALF,
+    IGNITE_SHADER_DATA_TYPE_FLOAT,
+    IGNITE_SHADER_DATA_TYPE_DOUBLE,
+    IGNITE_SHADER_DATA_TYPE_STRUCT
+} IGNITE_ShaderDataType;
+
 typedef enum IGNITE_VertexElementFormat
 {
     IGNITE_VERTEX_ELEMENT_FORMAT_INVALID,
@@ -121,6 +196,144 @@ typedef enum IGNITE_VertexElementFormat
     IGNITE_VERTEX_ELEMENT_FORMAT_HALF4
 } IGNITE_VertexElementFormat;
 
+/* Memory layout of one vertex element format. */
+typedef struct IGNITE_VertexFormatInfo
+{
+    IGNITE_ShaderDataType componentType;
+    uint32_t componentCount;
+    uint32_t size; /* bytes per element */
+    int normalized;
+} IGNITE_VertexFormatInfo;
+
+/* Traits of every IGNITE_VertexElementFormat, indexed by the enum value (constexpr in C++). */
+static IGNITE_CONSTEXPR IGNITE_VertexFormatInfo IGNITE_VERTEX_FORMAT_INFO[] =
+{
+    { IGNITE_SHADER_DATA_TYPE_UNKNOWN, 0, 0, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_INT, 1, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_INT, 2, 8, 0 },
+    { IGNITE_SHADER_DATA_TYPE_INT, 3, 12, 0 },
+    { IGNITE_SHADER_DATA_TYPE_INT, 4, 16, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_UINT, 1, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_UINT, 2, 8, 0 },
+    { IGNITE_SHADER_DATA_TYPE_UINT, 3, 12, 0 },
+    { IGNITE_SHADER_DATA_TYPE_UINT, 4, 16, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_FLOAT, 1, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_FLOAT, 2, 8, 0 },
+    { IGNITE_SHADER_DATA_TYPE_FLOAT, 3, 12, 0 },
+    { IGNITE_SHADER_DATA_TYPE_FLOAT, 4, 16, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_INT8, 2, 2, 0 },
+    { IGNITE_SHADER_DATA_TYPE_INT8, 4, 4, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_UINT8, 2, 2, 0 },
+    { IGNITE_SHADER_DATA_TYPE_UINT8, 4, 4, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_INT8, 2, 2, 1 },
+    { IGNITE_SHADER_DATA_TYPE_INT8, 4, 4, 1 },
+
+    { IGNITE_SHADER_DATA_TYPE_UINT8, 2, 2, 1 },
+    { IGNITE_SHADER_DATA_TYPE_UINT8, 4, 4, 1 },
+
+    { IGNITE_SHADER_DATA_TYPE_INT16, 2, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_INT16, 4, 8, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_UINT16, 2, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_UINT16, 4, 8, 0 },
+
+    { IGNITE_SHADER_DATA_TYPE_INT16, 2, 4, 1 },
+    { IGNITE_SHADER_DATA_TYPE_INT16, 4, 8, 1 },
+
+    { IGNITE_SHADER_DATA_TYPE_UINT16, 2, 4, 1 },
+    { IGNITE_SHADER_DATA_TYPE_UINT16, 4, 8, 1 },
+
+    { IGNITE_SHADER_DATA_TYPE_HALF, 2, 4, 0 },
+    { IGNITE_SHADER_DATA_TYPE_HALF, 4, 8, 0 }
+};
+
+#ifdef __cplusplus
+static_assert(sizeof(IGNITE_VERTEX_FORMAT_INFO) / sizeof(IGNITE_VERTEX_FORMAT_INFO[0]) == IGNITE_VERTEX_ELEMENT_FORMAT_HALF4 + 1,
+    "IGNITE_VERTEX_FORMAT_INFO must cover every IGNITE_VertexElementFormat");
+#endif
+
+/* Returns the traits of a format; the INVALID entry for out-of-range values. */
+static IGNITE_VertexFormatInfo IGNITE_GetVertexFormatInfo(IGNITE_VertexElementFormat format)
+{
+    const int count = (int)(sizeof(IGNITE_VERTEX_FORMAT_INFO) / sizeof(IGNITE_VERTEX_FORMAT_INFO[0]));
+    return ((int)format >= 0 && (int)format < count) ? IGNITE_VERTEX_FORMAT_INFO[format] : IGNITE_VERTEX_FORMAT_INFO[0];
+}
+
+/* Picks the format holding componentCount components of componentType. 8- and 16-bit formats only exist
+   with 2 or 4 components, so 1 and 3 components widen to the next size (the shader ignores the extra data).
+   Returns INVALID for combinations without a format, such as normalized 32-bit data. */
+static IGNITE_VertexElementFormat IGNITE_SelectVertexFormat(IGNITE_ShaderDataType componentType, uint32_t componentCount, int normalized)
+{
+    if (componentCount < 1 || componentCount > 4)
+    {
+        return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+    }
+
+    const int index = (int)componentCount - 1;
+    const int wide = componentCount > 2;
+    switch (componentType)
+    {
+    case IGNITE_SHADER_DATA_TYPE_INT:
+        return normalized ? IGNITE_VERTEX_ELEMENT_FORMAT_INVALID : (IGNITE_VertexElementFormat)(IGNITE_VERTEX_ELEMENT_FORMAT_INT + index);
+    case IGNITE_SHADER_DATA_TYPE_UINT:
+        return normalized ? IGNITE_VERTEX_ELEMENT_FORMAT_INVALID : (IGNITE_VertexElementFormat)(IGNITE_VERTEX_ELEMENT_FORMAT_UINT + index);
+    case IGNITE_SHADER_DATA_TYPE_FLOAT:
+        return normalized ? IGNITE_VERTEX_ELEMENT_FORMAT_INVALID : (IGNITE_VertexElementFormat)(IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT + index);
+    case IGNITE_SHADER_DATA_TYPE_HALF:
+        return normalized ? IGNITE_VERTEX_ELEMENT_FORMAT_INVALID : (wide ? IGNITE_VERTEX_ELEMENT_FORMAT_HALF4 : IGNITE_VERTEX_ELEMENT_FORMAT_HALF2);
+    case IGNITE_SHADER_DATA_TYPE_INT8:
+        if (normalized)
+            return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_BYTE4_NORM : IGNITE_VERTEX_ELEMENT_FORMAT_BYTE2_NORM;
+        return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_BYTE4 : IGNITE_VERTEX_ELEMENT_FORMAT_BYTE2;
+    case IGNITE_SHADER_DATA_TYPE_UINT8:
+        if (normalized)
+            return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_UBYTE4_NORM : IGNITE_VERTEX_ELEMENT_FORMAT_UBYTE2_NORM;
+        return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_UBYTE4 : IGNITE_VERTEX_ELEMENT_FORMAT_UBYTE2;
+    case IGNITE_SHADER_DATA_TYPE_INT16:
+        if (normalized)
+            return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_SHORT4_NORM : IGNITE_VERTEX_ELEMENT_FORMAT_SHORT2_NORM;
+        return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_SHORT4 : IGNITE_VERTEX_ELEMENT_FORMAT_SHORT2;
+    case IGNITE_SHADER_DATA_TYPE_UINT16:
+        if (normalized)
+            return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_USHORT4_NORM : IGNITE_VERTEX_ELEMENT_FORMAT_USHORT2_NORM;
+        return wide ? IGNITE_VERTEX_ELEMENT_FORMAT_USHORT4 : IGNITE_VERTEX_ELEMENT_FORMAT_USHORT2;
+    default:
+        return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+    }
+}
+
+/* How often a vertex buffer advances: once per vertex or once per stepRate instances. */
+typedef enum IGNITE_VertexInputRate
+{
+    IGNITE_VERTEX_INPUT_RATE_VERTEX = 0,
+    IGNITE_VERTEX_INPUT_RATE_INSTANCE
+} IGNITE_VertexInputRate;
+
+/* What differs between two reflections of a shader (ShaderReflection::Diff); bits combine.
+   NONE means identical, CODE alone means only the bytecode changed and the module can be swapped. */
+typedef enum IGNITE_ReflectionChangeFlags
+{
+    IGNITE_REFLECTION_CHANGE_NONE = 0,
+    IGNITE_REFLECTION_CHANGE_CODE = 1 << 0, /* bytecode differs (only when blobs are compared) */
+    IGNITE_REFLECTION_CHANGE_NAMES = 1 << 1, /* resources, members or varyings renamed; layout unchanged */
+    IGNITE_REFLECTION_CHANGE_BINDING_ADDED = 1 << 2,
+    IGNITE_REFLECTION_CHANGE_BINDING_REMOVED = 1 << 3,
+    IGNITE_REFLECTION_CHANGE_BINDING_TYPE = 1 << 4, /* descriptor type or count changed at the same set/binding */
+    IGNITE_REFLECTION_CHANGE_BUFFER_LAYOUT = 1 << 5, /* uniform/storage buffer size or member layout */
+    IGNITE_REFLECTION_CHANGE_PUSH_CONSTANTS = 1 << 6,
+    IGNITE_REFLECTION_CHANGE_VERTEX_INPUT = 1 << 7, /* vertex attributes, formats or buffers */
+    IGNITE_REFLECTION_CHANGE_STAGE_IO = 1 << 8, /* varyings or render target outputs */
+    IGNITE_REFLECTION_CHANGE_SPECIALIZATION = 1 << 9, /* specialization constant ids, types or defaults */
+    IGNITE_REFLECTION_CHANGE_COMPUTE = 1 << 10, /* workgroup size or shared memory */
+    IGNITE_REFLECTION_CHANGE_SHADER_TYPE = 1 << 11
+} IGNITE_ReflectionChangeFlags;
+
 static const char *IGNITE_ShaderPlatformToString(IGNITE_ShaderPlatformType type)
 {
     switch (type)
@@ -144,6 +357,34 @@ static const char *IGNITE_ShaderPlatformExtension(IGNITE_ShaderPlatformType type
     }
 }
 
+/* Returns the name of a SPIR-V optimizer recipe for logs and reports. */
+static const char *IGNITE_SPIRVOptimizerRecipeToString(IGNITE_SPIRVOptimizerRecipe recipe)
+{
+    switch (recipe)
+    {
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_DEFAULT: return "default";
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE: return "none";
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE: return "legalize";
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_SIZE: return "size";
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE: return "performance";
+    case IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM: return "custom";
+    default: return "unknown";
+    }
+}
+
+/* Returns the file extension used for cross-compiled sources of a target. */
+static const char *IGNITE_CrossCompileTargetExtension(IGNITE_CrossCompileTarget target)
+{
+    switch (target)
+    {
+    case IGNITE_CROSS_COMPILE_TARGET_GLSL: return ".glsl";
+    case IGNITE_CROSS_COMPILE_TARGET_ESSL: return ".essl";
+    case IGNITE_CROSS_COMPILE_TARGET_HLSL: return ".hlsl";
+    case IGNITE_CROSS_COMPILE_TARGET_MSL: return ".metal";
+    default: return ".txt";
+    }
+}
+
 /* Returns executable name used by the selected shader compiler backend. */
  static const char *IGNITE_ShaderCompilerExecutablePath(IGNITE_ShaderCompilerType type)
 {
@@ -185,6 +426,7 @@ static const char* IGNITE_GetShaderTypeString(IGNITE_ShaderType type)
         case IGNITE_SHADER_TYPE_PIXEL: return "Pixel";
         case IGNITE_SHADER_TYPE_GEOMETRY: return "Geometry";
         case IGNITE_SHADER_TYPE_COMPUTE: return "Compute";
+        case IGNITE_SHADER_TYPE_TESSELLATION: return "Tessellation";
         default: return "Invalid";
     }
 }
@@ -1,11 +1,32 @@
 // Copyright (c) 2026 Evangelion Manuhutu
 
 #include "ShaderCompiler.h"
+#include "ShaderLog.h"
+#include "ShaderLayoutGenerator.h"
+#include "ShaderReflectionBinary.h"
+#include "ShaderUtils.h"
+#include "SPIRVLinker.h"
+#include "SPIRVModule.h"
+#include "SPIRVOptimizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
 
 #include <spirv_cross/spirv_cross_c.h>
 #include <shaderc/shaderc.h>
@@ -19,14 +40,94 @@ namespace ignite
         // Global callback state used by DispatchLog.
         LogCallback g_logCallback = nullptr;
         void* g_logUserData = nullptr;
+    }
+
+    // Centralized typed logging dispatch for compiler/reflection diagnostics.
+    void DispatchLog(IGNITE_LogType type, const std::string& message)
+    {
+        if (g_logCallback)
+        {
+            g_logCallback(type, message.c_str(), g_logUserData);
+        }
+    }
+
+    // MurmurHash64A: one multiply chain per 8-byte block, no allocations.
+    uint64_t HashBytes64(const void* data, size_t size, uint64_t seed)
+    {
+        constexpr uint64_t m = 0xc6a4a7935bd1e995ull;
+        constexpr int r = 47;
+
+        uint64_t h = seed ^ (static_cast<uint64_t>(size) * m);
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        const size_t blockCount = size / sizeof(uint64_t);
+
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            uint64_t k = 0;
+            std::memcpy(&k, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+
+        const uint8_t* tail = bytes + blockCount * sizeof(uint64_t);
+        switch (size & 7)
+        {
+        case 7: h ^= uint64_t(tail[6]) << 48; [[fallthrough]];
+        case 6: h ^= uint64_t(tail[5]) << 40; [[fallthrough]];
+        case 5: h ^= uint64_t(tail[4]) << 32; [[fallthrough]];
+        case 4: h ^= uint64_t(tail[3]) << 24; [[fallthrough]];
+        case 3: h ^= uint64_t(tail[2]) << 16; [[fallthrough]];
+        case 2: h ^= uint64_t(tail[1]) << 8; [[fallthrough]];
+        case 1: h ^= uint64_t(tail[0]);
+            h *= m;
+            break;
+        default:
+            break;
+        }
+
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+
+    namespace
+    {
+        // Output path shared by every artifact of one compile: <outputFilepath or source dir>/<name>.<platform ext>.
+        std::filesystem::path GetOutputFilePath(const CompilerOptions& options)
+        {
+            std::string outputExtension = IGNITE_ShaderPlatformExtension(options.platformType);
+            std::filesystem::path parentPath = options.filepath.parent_path();
+            if (!options.outputFilepath.empty())
+            {
+                parentPath = options.outputFilepath;
+            }
+
+            return parentPath / options.filepath.filename().replace_extension(outputExtension);
+        }
 
-        // Centralized typed logging dispatch for compiler/reflection diagnostics.
-        void DispatchLog(IGNITE_LogType type, const std::string& message)
+        // Writes a file derived from one compile (reflection, layout header) inline or through the output queue.
+        bool WriteCompanionFile(const CompilerOptions& options, const std::string& path, std::vector<uint8_t> data, bool textMode)
         {
-            if (g_logCallback)
+            if (options.outputQueue)
+            {
+                options.outputQueue->Enqueue(path, std::move(data), textMode);
+            }
+            else
             {
-                g_logCallback(type, message.c_str(), g_logUserData);
+                DataOutputContext context(path.c_str(), textMode);
+                if (!context.IsOpen() || !context.WriteDataAsBinary(data.data(), data.size()) || !context.Flush())
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to write: " + path);
+                    return false;
+                }
             }
+
+            DispatchLog(IGNITE_LOG_TYPE_INFO, (options.outputQueue ? "Queued " : "Writing ") + path);
+            return true;
         }
 
         // Converts wide strings (DXC messages on Windows) to UTF-8.
@@ -80,6 +181,135 @@ namespace ignite
             return true;
         }
 
+        // Precomputed "%u," spellings for every byte value, used by the header emitter.
+        struct DecimalEntry
+        {
+            char text[4];
+            uint8_t length;
+        };
+
+        constexpr std::array<DecimalEntry, 256> BuildDecimalTable()
+        {
+            std::array<DecimalEntry, 256> table = {};
+            for (uint32_t value = 0; value < 256; ++value)
+            {
+                DecimalEntry& entry = table[value];
+                uint8_t length = 0;
+                if (value >= 100)
+                {
+                    entry.text[length++] = static_cast<char>('0' + value / 100);
+                }
+                if (value >= 10)
+                {
+                    entry.text[length++] = static_cast<char>('0' + (value / 10) % 10);
+                }
+                entry.text[length++] = static_cast<char>('0' + value % 10);
+                entry.text[length++] = ',';
+                entry.length = length;
+            }
+            return table;
+        }
+
+        // Two lower-case hex digits for every byte value.
+        constexpr std::array<std::array<char, 2>, 256> BuildHexTable()
+        {
+            constexpr char digits[] = "0123456789abcdef";
+            std::array<std::array<char, 2>, 256> table = {};
+            for (uint32_t value = 0; value < 256; ++value)
+            {
+                table[value] = { digits[value >> 4], digits[value & 0xF] };
+            }
+            return table;
+        }
+
+        constexpr std::array<DecimalEntry, 256> kDecimalTable = BuildDecimalTable();
+        constexpr std::array<std::array<char, 2>, 256> kHexTable = BuildHexTable();
+
+        // Turns a shader file name into a valid C identifier for generated headers.
+        std::string MakeIdentifier(const std::string& name)
+        {
+            std::string identifier = name;
+            for (char& ch : identifier)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(ch)))
+                {
+                    ch = '_';
+                }
+            }
+
+            if (identifier.empty() || std::isdigit(static_cast<unsigned char>(identifier[0])))
+            {
+                identifier.insert(identifier.begin(), '_');
+            }
+            return identifier;
+        }
+
+        // Header for headerEmbed mode: pulls the binary in through #embed when the
+        // toolchain supports it, otherwise declares the symbols from the ".S" stub.
+        std::string BuildEmbedHeader(const std::string& symbol, const std::string& binaryName, const std::string& combinedDefines)
+        {
+            const std::string guard = "IGNITE_EMBED_" + symbol;
+
+            std::string text;
+            text += "// {" + combinedDefines + "}\n";
+            text += "// Embeds \"" + binaryName + "\" via #embed, or via the symbols defined in \"" + binaryName + ".S\"\n";
+            text += "// (assemble it with this directory on the assembler include path).\n";
+            text += "#pragma once\n\n";
+            text += "#include <stddef.h>\n";
+            text += "#include <stdint.h>\n\n";
+            text += "#if !defined(IGNITE_SHADER_NO_EMBED) && defined(__has_embed)\n";
+            text += "#   if __has_embed(\"" + binaryName + "\") == __STDC_EMBED_FOUND__\n";
+            text += "#       define " + guard + " 1\n";
+            text += "#   endif\n";
+            text += "#endif\n\n";
+            text += "#if defined(" + guard + ")\n";
+            text += "alignas(4) static const uint8_t " + symbol + "[] = {\n";
+            text += "#embed \"" + binaryName + "\"\n";
+            text += "};\n";
+            text += "#define " + symbol + "_size sizeof(" + symbol + ")\n";
+            text += "#else\n";
+            text += "#ifdef __cplusplus\n";
+            text += "extern \"C\" {\n";
+            text += "#endif\n";
+            text += "extern const uint8_t " + symbol + "[];\n";
+            text += "extern const uint8_t " + symbol + "_end[];\n";
+            text += "#ifdef __cplusplus\n";
+            text += "}\n";
+            text += "#endif\n";
+            text += "#define " + symbol + "_size ((size_t)(" + symbol + "_end - " + symbol + "))\n";
+            text += "#endif\n";
+            return text;
+        }
+
+        // Assembly stub for headerEmbed mode (GNU as / clang syntax, run through the C preprocessor).
+        std::string BuildIncbinStub(const std::string& symbol, const std::string& binaryName)
+        {
+            std::string text;
+            text += "/* Assembles \"" + binaryName + "\" into " + symbol + " / " + symbol + "_end. */\n";
+            text += "#if defined(__APPLE__) || (defined(_WIN32) && !defined(_WIN64))\n";
+            text += "#   define IGNITE_SYMBOL(name) _##name\n";
+            text += "#else\n";
+            text += "#   define IGNITE_SYMBOL(name) name\n";
+            text += "#endif\n\n";
+            text += "#if defined(__APPLE__)\n";
+            text += "    .const_data\n";
+            text += "#elif defined(_WIN32)\n";
+            text += "    .section .rdata,\"dr\"\n";
+            text += "#else\n";
+            text += "    .section .rodata\n";
+            text += "#endif\n";
+            text += "    .balign 4\n";
+            text += "    .globl IGNITE_SYMBOL(" + symbol + ")\n";
+            text += "IGNITE_SYMBOL(" + symbol + "):\n";
+            text += "    .incbin \"" + binaryName + "\"\n";
+            text += "    .globl IGNITE_SYMBOL(" + symbol + "_end)\n";
+            text += "IGNITE_SYMBOL(" + symbol + "_end):\n\n";
+            text += "#if defined(__ELF__)\n";
+            text += "    .section .note.GNU-stack,\"\",%progbits\n";
+            text += "#endif\n";
+            return text;
+        }
+
         struct ShadercCompileContext
         {
             shaderc_compiler* compiler = nullptr;
@@ -283,102 +513,220 @@ namespace ignite
             }
         }
 
-#ifdef _WIN32
-    // Maps D3D reflection component type to project vertex element format.
-        IGNITE_VertexElementFormat IGNITE_Map3DComponent(D3D_REGISTER_COMPONENT_TYPE componentType, uint32_t elementCount)
+        // Storage hints: a trailing "_<TOKEN>" on the input name (or HLSL semantic) selects a narrower
+        // buffer format for the attribute. Tokens carry no digits so HLSL semantic indices stay intact
+        // ("COLOR_UBYTEN0"). Normalized and half storage feeds float inputs; integer storage feeds
+        // integer inputs of the same signedness.
+        struct VertexStorageHint
         {
-            switch (componentType)
+            const char* token;
+            IGNITE_ShaderDataType componentType;
+            int normalized;
+        };
+
+        constexpr VertexStorageHint VERTEX_STORAGE_HINTS[] =
+        {
+            { "UBYTEN", IGNITE_SHADER_DATA_TYPE_UINT8, 1 },
+            { "BYTEN", IGNITE_SHADER_DATA_TYPE_INT8, 1 },
+            { "USHORTN", IGNITE_SHADER_DATA_TYPE_UINT16, 1 },
+            { "SHORTN", IGNITE_SHADER_DATA_TYPE_INT16, 1 },
+            { "UBYTE", IGNITE_SHADER_DATA_TYPE_UINT8, 0 },
+            { "BYTE", IGNITE_SHADER_DATA_TYPE_INT8, 0 },
+            { "USHORT", IGNITE_SHADER_DATA_TYPE_UINT16, 0 },
+            { "SHORT", IGNITE_SHADER_DATA_TYPE_INT16, 0 },
+            { "HALF", IGNITE_SHADER_DATA_TYPE_HALF, 0 },
+        };
+
+        bool IsSignedComponent(IGNITE_ShaderDataType type)
+        {
+            return type == IGNITE_SHADER_DATA_TYPE_INT || type == IGNITE_SHADER_DATA_TYPE_INT8 || type == IGNITE_SHADER_DATA_TYPE_INT16;
+        }
+
+        bool IsFloatComponent(IGNITE_ShaderDataType type)
+        {
+            return type == IGNITE_SHADER_DATA_TYPE_FLOAT || type == IGNITE_SHADER_DATA_TYPE_HALF;
+        }
+
+        // Returns the buffer format for a vertex input: the hinted storage format when the name carries
+        // a valid hint, the shader-visible format otherwise.
+        IGNITE_VertexElementFormat ResolveVertexStorageFormat(const std::string& name, IGNITE_VertexElementFormat shaderFormat)
+        {
+            size_t end = name.size();
+            while (end > 0 && std::isdigit(static_cast<unsigned char>(name[end - 1])))
             {
-                case D3D_REGISTER_COMPONENT_FLOAT32:
-                switch (elementCount)
-                {
-                    case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT;
-                    case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT2;
-                    case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT3;
-                    case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT4;
-                    default: break;
-                }
-                break;
-                case D3D_REGISTER_COMPONENT_SINT32:
-                switch (elementCount)
+                --end;
+            }
+
+            const size_t separator = end > 0 ? name.find_last_of('_', end - 1) : std::string::npos;
+            if (separator == std::string::npos)
+            {
+                return shaderFormat;
+            }
+
+            std::string token = name.substr(separator + 1, end - separator - 1);
+            std::transform(token.begin(), token.end(), token.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+            for (const VertexStorageHint& hint : VERTEX_STORAGE_HINTS)
+            {
+                if (token != hint.token)
                 {
-                    case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_INT;
-                    case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_INT2;
-                    case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_INT3;
-                    case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_INT4;
-                    default: break;
+                    continue;
                 }
-                break;
-                case D3D_REGISTER_COMPONENT_UINT32:
-                switch (elementCount)
+
+                const IGNITE_VertexFormatInfo shaderInfo = IGNITE_GetVertexFormatInfo(shaderFormat);
+                const bool floatStorage = hint.normalized || hint.componentType == IGNITE_SHADER_DATA_TYPE_HALF;
+                const bool matches = IsFloatComponent(shaderInfo.componentType)
+                    ? floatStorage
+                    : !floatStorage && IsSignedComponent(shaderInfo.componentType) == IsSignedComponent(hint.componentType);
+                if (!matches)
                 {
-                    case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT;
-                    case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT2;
-                    case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT3;
-                    case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT4;
-                    default: break;
+                    DispatchLog(IGNITE_LOG_TYPE_WARNING, "Vertex storage hint " + token + " does not match the shader type of " + name + "; using the shader format");
+                    return shaderFormat;
                 }
-                break;
+
+                return IGNITE_SelectVertexFormat(hint.componentType, shaderInfo.componentCount, hint.normalized);
             }
-            
-            return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+
+            return shaderFormat;
         }
-#endif
 
-    // Maps SPIRV-Cross types to project vertex element format.
-        IGNITE_VertexElementFormat IGNITE_MapSpvcType(spvc_type typeHandle)
+        constexpr uint32_t INSTANCE_STREAM_INDEX = 1;
+
+        bool IsInstanceAttributeName(const std::string& name)
+        {
+            std::string upper = name;
+            std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+            return upper.find("INSTANCE") != std::string::npos;
+        }
+
+        // Assigns attributes to buffers (through the map, or the naming convention without one), then
+        // packs each buffer's attributes back to back in declaration order. Each offset is aligned to the
+        // smaller of the format size and 4 bytes, as D3D12 and Vulkan fetch require; a buffer's stride
+        // rounds its end up to the largest alignment it uses.
+        void LayoutVertexStreams(std::vector<VertexAttribute>& attributes, std::vector<VertexBufferLayout>& buffers, const VertexStreamMap* map)
         {
-            if (!typeHandle)
+            buffers.clear();
+            for (VertexAttribute& attribute : attributes)
             {
-                return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
-            }
+                VertexBufferLayout stream = {};
+                if (map)
+                {
+                    for (const VertexStreamAssignment& assignment : map->assignments)
+                    {
+                        if (assignment.attribute == attribute.name)
+                        {
+                            stream.bufferIndex = assignment.bufferIndex;
+                            break;
+                        }
+                    }
 
-            const spvc_basetype baseType = spvc_type_get_basetype(typeHandle);
-            const uint32_t vecSize = spvc_type_get_vector_size(typeHandle);
-            const uint32_t columns = spvc_type_get_columns(typeHandle);
+                    for (const VertexBufferLayout& buffer : map->buffers)
+                    {
+                        if (buffer.bufferIndex == stream.bufferIndex)
+                        {
+                            stream.inputRate = buffer.inputRate;
+                            stream.stepRate = buffer.stepRate;
+                            break;
+                        }
+                    }
+                }
+                else if (IsInstanceAttributeName(attribute.name))
+                {
+                    stream.bufferIndex = INSTANCE_STREAM_INDEX;
+                    stream.inputRate = IGNITE_VERTEX_INPUT_RATE_INSTANCE;
+                }
 
-            if (columns != 1)
-            {
-                return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+                attribute.bufferIndex = stream.bufferIndex;
+                const bool known = std::any_of(buffers.begin(), buffers.end(), [&stream](const VertexBufferLayout& buffer) {
+                    return buffer.bufferIndex == stream.bufferIndex;
+                });
+                if (!known)
+                {
+                    buffers.push_back(stream);
+                }
             }
 
-            if (baseType == SPVC_BASETYPE_FP32)
+            std::sort(buffers.begin(), buffers.end(), [](const VertexBufferLayout& a, const VertexBufferLayout& b) {
+                return a.bufferIndex < b.bufferIndex;
+            });
+
+            for (VertexBufferLayout& buffer : buffers)
             {
-                switch (vecSize)
+                uint32_t offset = 0;
+                uint32_t maxAlignment = 1;
+                for (VertexAttribute& attribute : attributes)
                 {
-                case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT;
-                case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT2;
-                case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT3;
-                case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_FLOAT4;
-                default: return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+                    if (attribute.bufferIndex != buffer.bufferIndex)
+                    {
+                        continue;
+                    }
+
+                    const uint32_t size = IGNITE_GetVertexFormatInfo(attribute.format).size;
+                    const uint32_t alignment = std::max(1u, std::min(size, 4u));
+                    offset = (offset + alignment - 1) / alignment * alignment;
+                    attribute.offset = offset;
+                    offset += size;
+                    maxAlignment = std::max(maxAlignment, alignment);
                 }
-            }
 
-            if (baseType == SPVC_BASETYPE_INT32)
-            {
-                switch (vecSize)
+                buffer.stride = (offset + maxAlignment - 1) / maxAlignment * maxAlignment;
+                for (VertexAttribute& attribute : attributes)
                 {
-                case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_INT;
-                case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_INT2;
-                case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_INT3;
-                case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_INT4;
-                default: return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+                    if (attribute.bufferIndex == buffer.bufferIndex)
+                    {
+                        attribute.elementStride = buffer.stride;
+                    }
                 }
             }
+        }
+
+#ifdef _WIN32
+        // Unbounded register ranges ("Texture2D t[] : register(t0)") report a zero or all-ones BindCount.
+        bool IsUnboundedBindCount(UINT bindCount)
+        {
+            return bindCount == 0 || bindCount == UINT_MAX;
+        }
 
-            if (baseType == SPVC_BASETYPE_UINT32)
+    // Maps D3D reflection component type to project vertex element format.
+        IGNITE_VertexElementFormat IGNITE_Map3DComponent(D3D_REGISTER_COMPONENT_TYPE componentType, uint32_t elementCount)
+        {
+            switch (componentType)
             {
-                switch (vecSize)
-                {
-                case 1: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT;
-                case 2: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT2;
-                case 3: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT3;
-                case 4: return IGNITE_VERTEX_ELEMENT_FORMAT_UINT4;
-                default: return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
-                }
+            case D3D_REGISTER_COMPONENT_FLOAT32: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_FLOAT, elementCount, 0);
+            case D3D_REGISTER_COMPONENT_SINT32: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_INT, elementCount, 0);
+            case D3D_REGISTER_COMPONENT_UINT32: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_UINT, elementCount, 0);
+            // Native 16-bit types (-enable-16bit-types); min16 precision still reports 32-bit storage.
+            case D3D_REGISTER_COMPONENT_FLOAT16: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_HALF, elementCount, 0);
+            case D3D_REGISTER_COMPONENT_SINT16: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_INT16, elementCount, 0);
+            case D3D_REGISTER_COMPONENT_UINT16: return IGNITE_SelectVertexFormat(IGNITE_SHADER_DATA_TYPE_UINT16, elementCount, 0);
+            default: return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+            }
+        }
+#endif
+
+    // Maps SPIRV-Cross types to project vertex element format.
+        IGNITE_VertexElementFormat IGNITE_MapSpvcType(spvc_type typeHandle)
+        {
+            if (!typeHandle || spvc_type_get_columns(typeHandle) != 1)
+            {
+                return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
             }
 
-            return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+            IGNITE_ShaderDataType componentType = IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+            switch (spvc_type_get_basetype(typeHandle))
+            {
+            case SPVC_BASETYPE_INT8: componentType = IGNITE_SHADER_DATA_TYPE_INT8; break;
+            case SPVC_BASETYPE_UINT8: componentType = IGNITE_SHADER_DATA_TYPE_UINT8; break;
+            case SPVC_BASETYPE_INT16: componentType = IGNITE_SHADER_DATA_TYPE_INT16; break;
+            case SPVC_BASETYPE_UINT16: componentType = IGNITE_SHADER_DATA_TYPE_UINT16; break;
+            case SPVC_BASETYPE_INT32: componentType = IGNITE_SHADER_DATA_TYPE_INT; break;
+            case SPVC_BASETYPE_UINT32: componentType = IGNITE_SHADER_DATA_TYPE_UINT; break;
+            case SPVC_BASETYPE_FP16: componentType = IGNITE_SHADER_DATA_TYPE_HALF; break;
+            case SPVC_BASETYPE_FP32: componentType = IGNITE_SHADER_DATA_TYPE_FLOAT; break;
+            default: return IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
+            }
+
+            return IGNITE_SelectVertexFormat(componentType, spvc_type_get_vector_size(typeHandle), 0);
         }
 
         // Maps project shader type to shaderc stage kind.
@@ -395,20 +743,214 @@ namespace ignite
             }
         }
 
-        // Maps project optimization enum to shaderc optimization level.
-        shaderc_optimization_level IGNITE_ShaderToShaderCOptLevel(IGNITE_OptimizationLevel level)
+        // Maps the optimization level to the recipe of the SPIR-V optimizer stage, unless one is set explicitly.
+        // Levels 2 and 3 both optimize for performance, as they do in DXC and shaderc; SIZE is opt-in.
+        IGNITE_SPIRVOptimizerRecipe ResolveOptimizerRecipe(const CompilerOptions& options)
         {
-            switch (level)
+            if (options.spirvOptimizer != IGNITE_SPIRV_OPTIMIZER_RECIPE_DEFAULT)
+            {
+                return options.spirvOptimizer;
+            }
+
+            switch (options.shaderDesc.optLevel)
             {
-            case IGNITE_OPT_LEVEL_0: return shaderc_optimization_level_zero;
-            case IGNITE_OPT_LEVEL_1:
+            case IGNITE_OPT_LEVEL_0: return IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE;
+            case IGNITE_OPT_LEVEL_1: return IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE;
             case IGNITE_OPT_LEVEL_2:
             case IGNITE_OPT_LEVEL_3:
             default:
-                return shaderc_optimization_level_performance;
+                return IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE;
+            }
+        }
+
+        std::string FormatMilliseconds(double milliseconds)
+        {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), "%.2f ms", milliseconds);
+            return buffer;
+        }
+
+        // Runs the optimizer stage over front-end SPIR-V. The front ends emit unoptimized SPIR-V,
+        // so this is the only place it gets optimized. Returns false if the stage fails.
+        bool ApplySPIRVOptimizerStage(const CompilerOptions& options, std::vector<uint8_t>& code)
+        {
+            // Linked library calls are inlined and legalized even when the recipe would skip the optimizer.
+            IGNITE_SPIRVOptimizerRecipe recipe = ResolveOptimizerRecipe(options);
+            if (recipe == IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE && !options.spirvLibraries.empty())
+            {
+                recipe = IGNITE_SPIRV_OPTIMIZER_RECIPE_LEGALIZE;
+            }
+            const bool wantsReport = options.verbose || options.optimizerReport;
+
+            SPIRVOptimizerReport report;
+            std::vector<uint8_t> optimized = ShaderCompiler::OptimizeSPIRV(code, recipe, options.spirvOptimizerPasses, wantsReport ? &report : nullptr);
+            if (optimized.empty())
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, std::string("SPIR-V optimizer stage failed (") + IGNITE_SPIRVOptimizerRecipeToString(recipe)
+                    + " recipe): " + options.filepath.generic_string());
+                return false;
+            }
+
+            if (options.verbose && recipe != IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_INFO, std::string("SPIR-V optimizer (") + IGNITE_SPIRVOptimizerRecipeToString(report.recipe) + "): "
+                    + std::to_string(report.sizeBefore) + " -> " + std::to_string(report.sizeAfter) + " bytes in " + FormatMilliseconds(report.milliseconds));
+                for (const SPIRVOptimizerPassStats& pass : report.passes)
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_INFO, "  " + pass.pass + ": " + FormatMilliseconds(pass.milliseconds) + ", "
+                        + std::to_string(pass.sizeBefore) + " -> " + std::to_string(pass.sizeAfter) + " bytes");
+                }
+            }
+
+            if (options.optimizerReport)
+            {
+                *options.optimizerReport = std::move(report);
+            }
+            code = std::move(optimized);
+            return true;
+        }
+
+        // Options for one of options.spirvLibraries. Libraries are intermediates of the entry shader's
+        // compile: they write no outputs and keep the ids and names the link resolves against.
+        CompilerOptions MakeLibraryOptions(const CompilerOptions& options, const std::filesystem::path& library)
+        {
+            CompilerOptions libraryOptions = options;
+            libraryOptions.filepath = library;
+            libraryOptions.spirvLibrary = true;
+            libraryOptions.spirvLibraries.clear();
+            libraryOptions.crossCompileTargets.clear();
+            libraryOptions.vertexStreams = {};
+            libraryOptions.optimizerReport = nullptr;
+            libraryOptions.outputQueue = nullptr;
+            libraryOptions.binary = false;
+            libraryOptions.binaryBlob = false;
+            libraryOptions.header = false;
+            libraryOptions.headerBlob = false;
+            libraryOptions.headerEmbed = false;
+            libraryOptions.reflectionBinary = false;
+            libraryOptions.layoutHeader = false;
+            libraryOptions.remapIds = false;
+            libraryOptions.stripDebugInfo = false;
+            libraryOptions.debugSidecar = false;
+            libraryOptions.pdb = false;
+            return libraryOptions;
+        }
+
+        // Links options.spirvLibraries into freshly compiled code and always yields an executable module:
+        // the linkage decorations and capability go, and so do functions no entry point reaches. The
+        // optimizer stage that follows inlines the library calls.
+        bool LinkSPIRVLibraries(const CompilerOptions& options, std::vector<uint8_t>& code, std::shared_ptr<DXCInstance> instance)
+        {
+            std::vector<std::shared_ptr<const std::vector<uint8_t>>> libraries;
+            libraries.reserve(options.spirvLibraries.size());
+            for (const std::filesystem::path& library : options.spirvLibraries)
+            {
+                const CompilerOptions libraryOptions = MakeLibraryOptions(options, library);
+                std::shared_ptr<const std::vector<uint8_t>> module = options.libraryCache
+                    ? options.libraryCache->GetLibrary(libraryOptions, instance)
+                    : std::make_shared<const std::vector<uint8_t>>(ShaderCompiler::CompileLibrary(libraryOptions, instance));
+                if (!module || module->empty())
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to compile SPIR-V library: " + library.generic_string());
+                    return false;
+                }
+                libraries.push_back(std::move(module));
+            }
+
+            // Compiler output is a whole number of words; link it in place without copying the libraries.
+            std::vector<spirv::LinkInput> inputs;
+            inputs.reserve(libraries.size() + 1);
+            inputs.push_back({ reinterpret_cast<const uint32_t*>(code.data()), code.size() / sizeof(uint32_t) });
+            for (const std::shared_ptr<const std::vector<uint8_t>>& library : libraries)
+            {
+                inputs.push_back({ reinterpret_cast<const uint32_t*>(library->data()), library->size() / sizeof(uint32_t) });
+            }
+
+            std::vector<uint32_t> linked;
+            if (!spirv::LinkModules(inputs, /*createLibrary*/ false, linked))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to link SPIR-V libraries: " + options.filepath.generic_string());
+                return false;
             }
+
+            code.resize(linked.size() * sizeof(uint32_t));
+            std::memcpy(code.data(), linked.data(), code.size());
+            return true;
+        }
+
+        // Post-compile SPIR-V stages: library linking, optimizer, id remapping, then debug info
+        // stripping. The optimizer runs on the linked module so library calls are inlined and
+        // optimized together with the caller; only the library compiles are shared through the
+        // cache. Stripping comes last so the sidecar matches the shipped ids. debugModule
+        // receives the module before stripping. Returns false if a stage fails.
+        bool FinalizeSPIRV(const CompilerOptions& options, std::vector<uint8_t>& code, std::vector<uint8_t>* debugModule, std::shared_ptr<DXCInstance> instance)
+        {
+            if (!options.spirvLibraries.empty() && !LinkSPIRVLibraries(options, code, std::move(instance)))
+            {
+                return false;
+            }
+
+            if (!ApplySPIRVOptimizerStage(options, code))
+            {
+                return false;
+            }
+
+            if (options.remapIds)
+            {
+                std::vector<uint8_t> remapped = ShaderCompiler::RemapSPIRV(code);
+                if (remapped.empty())
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to remap SPIR-V ids: " + options.filepath.generic_string());
+                    return false;
+                }
+                code = std::move(remapped);
+            }
+
+            if (!options.stripDebugInfo)
+            {
+                return true;
+            }
+
+            std::vector<uint8_t> sidecar;
+            std::vector<uint8_t> stripped = ShaderCompiler::StripSPIRVDebugInfo(code, options.debugSidecar ? &sidecar : nullptr);
+            if (stripped.empty())
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to strip debug info: " + options.filepath.generic_string());
+                return false;
+            }
+
+            if (options.verbose)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_INFO, "Stripped debug info: " + std::to_string(code.size()) + " -> " + std::to_string(stripped.size()) + " bytes");
+            }
+
+            if (options.debugSidecar)
+            {
+                WriteCompanionFile(options, GetOutputFilePath(options).generic_string() + ".spvdbg", std::move(sidecar), false);
+            }
+
+            if (debugModule)
+            {
+                *debugModule = std::move(code);
+            }
+            code = std::move(stripped);
+            return true;
         }
 
+        // Debug sidecar layout (little-endian): SPIRVDebugSidecarHeader, then the original module.
+        constexpr uint32_t kDebugSidecarMagic = 0x47424449; // "IDBG"
+        constexpr uint32_t kDebugSidecarVersion = 1;
+
+        struct SPIRVDebugSidecarHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t strippedHash; // HashBytes64 of the stripped module
+            uint32_t strippedSize;
+            uint32_t moduleSize; // bytes of the original module that follows
+        };
+        static_assert(sizeof(SPIRVDebugSidecarHeader) == 24, "SPIRVDebugSidecarHeader layout changed");
+
         // Maps Vulkan version string to shaderc environment target.
         shaderc_env_version IGNITE_ShaderToVulkanEnvVersion(const char *version)
         {
@@ -434,6 +976,7 @@ namespace ignite
     }
 
     DataOutputContext::DataOutputContext(const char* file, bool textMode)
+        : m_buffer(new char[kBufferCapacity])
     {
         stream = fopen(file, textMode ? "w" : "wb");
         if (!stream)
@@ -442,57 +985,218 @@ namespace ignite
         }
     }
 
+    DataOutputContext::DataOutputContext()
+        : m_buffer(new char[size_t(64) << 10]), m_bufferCapacity(size_t(64) << 10), m_inMemory(true)
+    {
+    }
+
     DataOutputContext::~DataOutputContext()
     {
         if (stream)
         {
+            Flush();
             fclose(stream);
             stream = nullptr;
         }
     }
 
-    bool DataOutputContext::WriteDataAsText(const void* data, size_t size)
+    bool DataOutputContext::Flush()
     {
-        for (size_t i = 0; i < size; i++)
+        if (m_inMemory)
         {
-            uint8_t value = ((const uint8_t*)data)[i];
-
-            if (m_lineLength > 128)
-            {
-                fprintf(stream, "\n    ");
-                m_lineLength = 0;
-            }
+            return !m_failed;
+        }
 
-            fprintf(stream, "%u,", value);
+        if (m_bufferUsed == 0)
+        {
+            return !m_failed;
+        }
 
-            if (value < 10)
-                m_lineLength += 3;
-            else if (value < 100)
-                m_lineLength += 4;
-            else
-                m_lineLength += 5;
+        if (!stream || fwrite(m_buffer.get(), m_bufferUsed, 1, stream) != 1)
+        {
+            m_failed = true;
         }
 
-        return true;
+        m_bufferUsed = 0;
+        return !m_failed;
     }
 
-    void DataOutputContext::WriteTextPreamble(const char* shaderName, const std::string& combinedDefines)
+    char* DataOutputContext::Reserve(size_t size)
     {
-        fprintf(stream, "// {%s}\n", combinedDefines.c_str());
-        fprintf(stream, "const uint8_t %s[] = {", shaderName);
+        if (m_bufferUsed + size <= m_bufferCapacity)
+        {
+            return m_buffer.get() + m_bufferUsed;
+        }
+
+        if (m_inMemory)
+        {
+            const size_t capacity = std::max(m_bufferCapacity * 2, m_bufferUsed + size);
+            std::unique_ptr<char[]> buffer(new char[capacity]);
+            std::memcpy(buffer.get(), m_buffer.get(), m_bufferUsed);
+            m_buffer = std::move(buffer);
+            m_bufferCapacity = capacity;
+        }
+        else if (!Flush())
+        {
+            return nullptr;
+        }
+
+        return m_buffer.get() + m_bufferUsed;
     }
 
-    void DataOutputContext::WriteTextEpilog()
+    std::vector<uint8_t> DataOutputContext::TakeData()
     {
-        fprintf(stream, "\n};\n");
+        const uint8_t* begin = reinterpret_cast<const uint8_t*>(m_buffer.get());
+        std::vector<uint8_t> data(begin, begin + m_bufferUsed);
+        m_bufferUsed = 0;
+        return data;
     }
 
-    bool DataOutputContext::WriteDataAsBinary(const void* data, size_t size)
+    bool DataOutputContext::Append(const char* data, size_t size)
     {
-        if (size == 0)
+        while (size > 0)
+        {
+            const size_t chunk = std::min(size, kBufferCapacity);
+            char* out = Reserve(chunk);
+            if (!out)
+            {
+                return false;
+            }
+
+            std::memcpy(out, data, chunk);
+            m_bufferUsed += chunk;
+            data += chunk;
+            size -= chunk;
+        }
+
+        return true;
+    }
+
+    bool DataOutputContext::WriteDataAsText(const void* data, size_t size)
+    {
+        // Worst case per byte is a line break ("\n    ") plus "255,".
+        constexpr size_t kBytesPerBatch = 4096;
+        constexpr size_t kMaxCharsPerByte = 9;
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        while (size > 0)
+        {
+            const size_t batch = std::min(size, kBytesPerBatch);
+            char* out = Reserve(batch * kMaxCharsPerByte);
+            if (!out)
+            {
+                return false;
+            }
+
+            char* cursor = out;
+            for (size_t i = 0; i < batch; ++i)
+            {
+                if (m_lineLength > 128)
+                {
+                    std::memcpy(cursor, "\n    ", 5);
+                    cursor += 5;
+                    m_lineLength = 0;
+                }
+
+                const DecimalEntry& entry = kDecimalTable[bytes[i]];
+                std::memcpy(cursor, entry.text, sizeof(entry.text));
+                cursor += entry.length;
+                m_lineLength += entry.length + 1u;
+            }
+
+            m_bufferUsed += static_cast<size_t>(cursor - out);
+            bytes += batch;
+            size -= batch;
+        }
+
+        return true;
+    }
+
+    bool DataOutputContext::WriteDataAsWords(const void* data, size_t size)
+    {
+        if (size % sizeof(uint32_t) != 0)
+        {
+            return false;
+        }
+
+        // Each word is "0x%08x," (11 chars) plus an optional line break.
+        constexpr size_t kWordsPerBatch = 2048;
+        constexpr size_t kMaxCharsPerWord = 16;
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t wordCount = size / sizeof(uint32_t);
+        while (wordCount > 0)
+        {
+            const size_t batch = std::min(wordCount, kWordsPerBatch);
+            char* out = Reserve(batch * kMaxCharsPerWord);
+            if (!out)
+            {
+                return false;
+            }
+
+            char* cursor = out;
+            for (size_t i = 0; i < batch; ++i)
+            {
+                if (m_lineLength > 128)
+                {
+                    std::memcpy(cursor, "\n    ", 5);
+                    cursor += 5;
+                    m_lineLength = 0;
+                }
+
+                uint32_t word = 0;
+                std::memcpy(&word, bytes + i * sizeof(uint32_t), sizeof(uint32_t));
+
+                cursor[0] = '0';
+                cursor[1] = 'x';
+                std::memcpy(cursor + 2, kHexTable[(word >> 24) & 0xFF].data(), 2);
+                std::memcpy(cursor + 4, kHexTable[(word >> 16) & 0xFF].data(), 2);
+                std::memcpy(cursor + 6, kHexTable[(word >> 8) & 0xFF].data(), 2);
+                std::memcpy(cursor + 8, kHexTable[word & 0xFF].data(), 2);
+                cursor[10] = ',';
+                cursor += 11;
+                m_lineLength += 12;
+            }
+
+            m_bufferUsed += static_cast<size_t>(cursor - out);
+            bytes += batch * sizeof(uint32_t);
+            wordCount -= batch;
+        }
+
+        return true;
+    }
+
+    void DataOutputContext::WriteTextPreamble(const char* shaderName, const std::string& combinedDefines, bool words)
+    {
+        std::string preamble = "// {" + combinedDefines + "}\n";
+        preamble += words ? "alignas(4) const uint32_t " : "const uint8_t ";
+        preamble += shaderName;
+        preamble += "[] = {";
+        Append(preamble.data(), preamble.size());
+    }
+
+    void DataOutputContext::WriteTextEpilog()
+    {
+        Append("\n};\n", 4);
+    }
+
+    bool DataOutputContext::WriteDataAsBinary(const void* data, size_t size)
+    {
+        if (size == 0)
+            return true;
+
+        // Large blobs bypass the staging buffer entirely.
+        if (stream && size >= kBufferCapacity)
+        {
+            if (!Flush() || fwrite(data, size, 1, stream) != 1)
+            {
+                m_failed = true;
+                return false;
+            }
             return true;
+        }
 
-        return fwrite(data, size, 1, stream) == 1;
+        return Append(static_cast<const char*>(data), size);
     }
 
     // For use as a callback in "WriteFileHeader" and "WritePermutation" functions
@@ -501,6 +1205,11 @@ namespace ignite
         return ((DataOutputContext*)context)->WriteDataAsText(data, size);
     }
 
+    bool DataOutputContext::WriteDataAsWordsCallback(const void* data, size_t size, void* context)
+    {
+        return ((DataOutputContext*)context)->WriteDataAsWords(data, size);
+    }
+
     bool DataOutputContext::WriteDataAsBinaryCallback(const void* data, size_t size, void* context)
     {
         return ((DataOutputContext*)context)->WriteDataAsBinary(data, size);
@@ -530,7 +1239,7 @@ namespace ignite
         return instance;
     }
 
-    std::vector<uint8_t> ShaderCompiler::CompileDXC(std::shared_ptr<DXCInstance> instance, const CompilerOptions &options)
+    std::vector<uint8_t> ShaderCompiler::CompileDXC(std::shared_ptr<DXCInstance> instance, const CompilerOptions &options, std::vector<uint8_t>* debugModule)
     {
         using namespace Microsoft::WRL;
 
@@ -587,10 +1296,17 @@ namespace ignite
             args.push_back(wsourceFile); // Source file
             args.push_back(L"-T"); // Profile
 
-            std::string shaderProfile = std::string(IGNITE_ShaderTypeToProfile(options.shaderDesc.shaderType));
+            // Libraries use the lib profile and have no entry point; their exported functions are kept.
+            // A shader that links libraries uses it too, since only there may its imports lack a body;
+            // its entry point comes from a [shader("<stage>")] attribute.
+            const bool libraryProfile = options.spirvLibrary || (options.platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV && !options.spirvLibraries.empty());
+            std::string shaderProfile = libraryProfile ? "lib" : std::string(IGNITE_ShaderTypeToProfile(options.shaderDesc.shaderType));
             args.push_back(AnsiToWide(shaderProfile + "_" + options.shaderDesc.shaderModel));
-            args.push_back(L"-E"); // Entry Point
-            args.push_back(AnsiToWide(options.shaderDesc.entryPoint));
+            if (!libraryProfile)
+            {
+                args.push_back(L"-E"); // Entry Point
+                args.push_back(AnsiToWide(options.shaderDesc.entryPoint));
+            }
 
             // Defines
             for (const std::string& define : options.defines)
@@ -606,8 +1322,11 @@ namespace ignite
                 args.push_back(path.wstring());
             }
 
-            // Arguments
-            args.push_back(dxcOptimizationLevelRemap[static_cast<uint32_t>(options.shaderDesc.optLevel)]);
+            // Arguments. SPIR-V comes out legalized but unoptimized; the optimizer stage below takes it from there.
+            if (options.platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV)
+                args.push_back(DXC_ARG_OPTIMIZATION_LEVEL0);
+            else
+                args.push_back(dxcOptimizationLevelRemap[static_cast<uint32_t>(options.shaderDesc.optLevel)]);
 
             uint32_t shaderModelIndex = (options.shaderDesc.shaderModel[0] - '0') * 10 + (options.shaderDesc.shaderModel[2] - '0');
             if (shaderModelIndex >= 62)
@@ -745,29 +1464,29 @@ namespace ignite
             // Dump output
             if (isSucceeded)
             {
-                std::string outputExtension = IGNITE_ShaderPlatformExtension(options.platformType);
-                std::filesystem::path parentPath = options.filepath.parent_path();
-                if (!options.outputFilepath.empty())
-                {
-                    parentPath = options.outputFilepath;
-                }
-
-                std::filesystem::path filename = parentPath / options.filepath.filename().replace_extension(outputExtension);
+                std::filesystem::path filename = GetOutputFilePath(options);
 
                 size_t bufferSize = shaderBlob->GetBufferSize();
                 const void* bufferPtr = shaderBlob->GetBufferPointer();
                 resultCode.resize(bufferSize);
                 std::memcpy(resultCode.data(), bufferPtr, bufferSize);
 
-                DumpShader(options, resultCode, filename.generic_string());
-                DispatchLog(IGNITE_LOG_TYPE_INFO, "Compiled shader: " + filename.generic_string());
+                if (options.platformType == IGNITE_SHADER_PLATFORM_TYPE_SPIRV && !FinalizeSPIRV(options, resultCode, debugModule, instance))
+                {
+                    resultCode.clear();
+                }
+                else
+                {
+                    DumpShader(options, resultCode, filename.generic_string());
+                    DispatchLog(IGNITE_LOG_TYPE_INFO, "Compiled shader: " + filename.generic_string());
+                }
             }
         }
 
         return resultCode;
     }
 
-    std::vector<uint8_t> ShaderCompiler::CompileGLSL(const CompilerOptions& options)
+    std::vector<uint8_t> ShaderCompiler::CompileGLSL(const CompilerOptions& options, std::vector<uint8_t>* debugModule)
     {
         std::vector<uint8_t> resultCode;
 
@@ -777,6 +1496,12 @@ namespace ignite
             return resultCode;
         }
 
+        if (options.spirvLibrary)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "GLSL cannot be compiled into a SPIR-V library: glslang emits no linkage attributes.");
+            return resultCode;
+        }
+
         std::string source = ReadTextFile(options.filepath);
         if (source.empty())
         {
@@ -808,7 +1533,8 @@ namespace ignite
 
         shaderc_compile_options_set_source_language(shadercContext.compileOptions, shaderc_source_language_glsl);
         shaderc_compile_options_set_target_env(shadercContext.compileOptions, shaderc_target_env_vulkan, IGNITE_ShaderToVulkanEnvVersion(options.shaderDesc.vulkanVersion.c_str()));
-        shaderc_compile_options_set_optimization_level(shadercContext.compileOptions, IGNITE_ShaderToShaderCOptLevel(options.shaderDesc.optLevel));
+        // Optimization is left to the SPIR-V optimizer stage, which runs the recipe for options.shaderDesc.optLevel.
+        shaderc_compile_options_set_optimization_level(shadercContext.compileOptions, shaderc_optimization_level_zero);
 
         if (options.warningsAreErrors)
         {
@@ -869,546 +1595,2660 @@ namespace ignite
         resultCode.resize(byteCount);
         std::memcpy(resultCode.data(), shaderc_result_get_bytes(shadercContext.compilationResult), resultCode.size());
 
-        std::string outputExtension = IGNITE_ShaderPlatformExtension(options.platformType);
-        std::filesystem::path parentPath = options.filepath.parent_path();
-        if (!options.outputFilepath.empty())
+        if (!FinalizeSPIRV(options, resultCode, debugModule, nullptr))
         {
-            parentPath = options.outputFilepath;
+            return {};
         }
 
-        std::filesystem::path filename = parentPath / options.filepath.filename().replace_extension(outputExtension);
+        std::filesystem::path filename = GetOutputFilePath(options);
         DumpShader(options, resultCode, filename.generic_string());
         DispatchLog(IGNITE_LOG_TYPE_INFO, "Compiled GLSL shader: " + filename.generic_string());
 
         return resultCode;
     }
 
-    const char* ShaderCompiler::GetVersion()
+    CompiledShader ShaderCompiler::CompileAndReflect(const CompilerOptions& options, std::shared_ptr<DXCInstance> instance)
     {
-        return "1.0.0";
-    }
+        CompiledShader result = {};
+        result.reflection.shaderType = options.shaderDesc.shaderType;
 
-    void ShaderCompiler::DumpShader(const CompilerOptions& options, std::vector<uint8_t>& shaderCode, const std::string& outputPath)
-    {
-        std::string shaderPlatformStr = IGNITE_ShaderPlatformToString(options.platformType);
-        if (options.binary || options.binaryBlob || (options.headerBlob))
+        std::string extension = options.filepath.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::tolower(ch));
+        });
+
+        // With stripDebugInfo, reflection reads the module as it was before stripping, so names survive.
+        std::vector<uint8_t> debugModule;
+        if (extension == ".glsl")
+        {
+            result.code = CompileGLSL(options, &debugModule);
+        }
+        else
         {
-            DataOutputContext context(outputPath.c_str(), false);
-            if (!context.stream)
+#ifdef _WIN32
+            if (!instance)
             {
-                return;
+                instance = CreateDXCCompiler();
             }
-
-            context.WriteDataAsBinary(shaderCode.data(), shaderCode.size());
-            DispatchLog(IGNITE_LOG_TYPE_INFO, "Writing binary " +shaderPlatformStr+ ": " + outputPath);
+            if (!instance)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "CompileAndReflect: could not create DXC instance.");
+                return result;
+            }
+            result.code = CompileDXC(instance, options, &debugModule);
+#else
+            (void)instance;
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "CompileAndReflect: HLSL compilation requires DXC (Windows).");
+            return result;
+#endif
         }
 
-        if (options.header || options.headerBlob)
+        // A library has no entry point to reflect; it only becomes a shader once it is linked.
+        if (result.code.empty() || (options.spirvLibrary && options.spirvLibraries.empty()))
         {
-            std::string headerOutput = outputPath + ".h"; // .h extension
-        
-            DataOutputContext context(headerOutput.c_str(), true);
-            if (!context.stream)
-                return;
-
-            std::string shaderName = options.filepath.filename().generic_string();
-
-            context.WriteTextPreamble(shaderName.c_str(), options.shaderDesc.combinedDefines);
-            context.WriteDataAsText(shaderCode.data(), shaderCode.size());
-            context.WriteTextEpilog();
-
-            DispatchLog(IGNITE_LOG_TYPE_INFO, "Writing header [" + shaderPlatformStr + "]: " + headerOutput);
+            return result;
         }
-    }
-
-    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
-    {
-        ShaderReflectionInfo info = {};
-        info.shaderType = type;
 
-        if (shaderCode.size() % sizeof(uint32_t) != 0)
+        switch (options.platformType)
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: shader blob size is not aligned to 4 bytes.");
-            return info;
-        }
-
-        spvc_context context = nullptr;
-        spvc_parsed_ir ir = nullptr;
-        spvc_compiler compiler = nullptr;
-        spvc_resources resources = nullptr;
-
-        if (spvc_context_create(&context) != SPVC_SUCCESS)
+        case IGNITE_SHADER_PLATFORM_TYPE_SPIRV:
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create SPIRV-Cross context.");
-            return info;
-        }
-
-        const uint32_t* words = reinterpret_cast<const uint32_t*>(shaderCode.data());
-        const size_t wordCount = shaderCode.size() / sizeof(uint32_t);
+            const std::vector<uint8_t>& module = debugModule.empty() ? result.code : debugModule;
+            if (!options.crossCompileTargets.empty())
+            {
+                // One SPIRV-Cross parse feeds both the reflection and every target; the unstripped
+                // module keeps the names the generated sources bind by.
+                CrossCompileSPIRV(options.shaderDesc.shaderType, module, options.crossCompileTargets, result.crossCompiled, &result.reflection);
+                break;
+            }
 
-        if (spvc_context_parse_spirv(context, words, wordCount, &ir) != SPVC_SUCCESS)
-        {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not parse SPIRV blob.");
-            spvc_context_destroy(context);
-            return info;
+            // Compiler output is a whole number of words; reflect it in place without re-checking.
+            result.reflection = ShaderReflection::SPIRVReflect(options.shaderDesc.shaderType,
+                reinterpret_cast<const uint32_t*>(module.data()), module.size() / sizeof(uint32_t));
+            break;
         }
-
-        if (spvc_context_create_compiler(context, SPVC_BACKEND_NONE, ir, SPVC_CAPTURE_MODE_COPY, &compiler) != SPVC_SUCCESS)
-        {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create SPIRV-Cross compiler.");
-            spvc_context_destroy(context);
-            return info;
+        case IGNITE_SHADER_PLATFORM_TYPE_DXIL:
+            result.reflection = ShaderReflection::DXILReflect(options.shaderDesc.shaderType, result.code);
+            break;
+        default:
+            // DXBC carries no reflection path in this library.
+            break;
         }
 
-        if (spvc_compiler_create_shader_resources(compiler, &resources) != SPVC_SUCCESS)
+        if (!options.vertexStreams.empty())
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create shader resources.");
-            spvc_context_destroy(context);
-            return info;
+            ShaderReflection::AssignVertexStreams(result.reflection, options.vertexStreams);
         }
 
-        auto collectBindings = [&](spvc_resource_type resourceType, std::vector<ShaderResourceInfo>& outResources)
+        // DXBC carries no reflection, so there is nothing to describe next to it.
+        if (options.platformType != IGNITE_SHADER_PLATFORM_TYPE_DXBC)
         {
-            const spvc_reflected_resource* list = nullptr;
-            size_t count = 0;
-            if (spvc_resources_get_resource_list_for_type(resources, resourceType, &list, &count) != SPVC_SUCCESS)
-            {
-                return;
-            }
-
-            outResources.reserve(count);
-            for (size_t i = 0; i < count; ++i)
+            const std::string outputPath = GetOutputFilePath(options).generic_string();
+            if (options.reflectionBinary)
             {
-                ShaderResourceInfo item = {};
-                item.name = list[i].name ? list[i].name : "";
-                item.id = list[i].id;
-                item.set = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationDescriptorSet);
-                item.binding = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationBinding);
-                item.count = 1;
-                outResources.push_back(std::move(item));
+                WriteCompanionFile(options, outputPath + ".refl", SerializeReflection(result.reflection), false);
             }
-        };
-
-        collectBindings(SPVC_RESOURCE_TYPE_UNIFORM_BUFFER, info.uniformBuffers);
-        collectBindings(SPVC_RESOURCE_TYPE_SAMPLED_IMAGE, info.sampledImages);
-        collectBindings(SPVC_RESOURCE_TYPE_STORAGE_IMAGE, info.storageImages);
-        collectBindings(SPVC_RESOURCE_TYPE_STORAGE_BUFFER, info.storageBuffers);
-        collectBindings(SPVC_RESOURCE_TYPE_SEPARATE_SAMPLERS, info.separateSamplers);
-        collectBindings(SPVC_RESOURCE_TYPE_SEPARATE_IMAGE, info.separateImages);
-
-        info.numUniformBuffers = info.uniformBuffers.size();
-        info.numSamplers = info.sampledImages.size();
-        info.numStorageTextures = info.storageImages.size();
-        info.numStorageBuffers = info.storageBuffers.size();
-        info.numSeparateSamplers = info.separateSamplers.size();
-        info.numSeparateImages = info.separateImages.size();
 
-        {
-            const spvc_reflected_resource* pushConstantList = nullptr;
-            size_t pushConstantCount = 0;
-            if (spvc_resources_get_resource_list_for_type(resources, SPVC_RESOURCE_TYPE_PUSH_CONSTANT, &pushConstantList, &pushConstantCount) == SPVC_SUCCESS)
+            // A target listed more than once is told apart by its version ("<output>.330.glsl");
+            // entries that would still share a file are rejected instead of overwriting it.
+            std::set<std::string> crossPaths;
+            for (const CrossCompiledShader& crossCompiled : result.crossCompiled)
             {
-                info.pushConstants.reserve(pushConstantCount);
-                for (size_t i = 0; i < pushConstantCount; ++i)
+                if (!crossCompiled)
                 {
-                    ShaderPushConstantInfo pushConstant = {};
-                    pushConstant.name = pushConstantList[i].name ? pushConstantList[i].name : "";
-
-                    spvc_type typeHandle = spvc_compiler_get_type_handle(compiler, pushConstantList[i].base_type_id);
-                    size_t declaredSize = 0;
-                    if (typeHandle && spvc_compiler_get_declared_struct_size(compiler, typeHandle, &declaredSize) == SPVC_SUCCESS)
-                    {
-                        pushConstant.size = static_cast<uint32_t>(declaredSize);
-                    }
-
-                    info.pushConstants.push_back(std::move(pushConstant));
+                    continue;
                 }
-            }
-        }
-        info.numPushConstants = info.pushConstants.size();
 
-        auto collectStageIO = [&](spvc_resource_type stageType, std::vector<ShaderStageIOInfo>& outIO)
-        {
-            const spvc_reflected_resource* list = nullptr;
-            size_t count = 0;
-            if (spvc_resources_get_resource_list_for_type(resources, stageType, &list, &count) != SPVC_SUCCESS)
-            {
-                return;
+                const IGNITE_CrossCompileTarget target = crossCompiled.options.target;
+                const bool repeated = std::count_if(options.crossCompileTargets.begin(), options.crossCompileTargets.end(),
+                    [&](const CrossCompileOptions& other) { return other.target == target; }) > 1;
+                const std::string version = repeated && crossCompiled.options.version != 0 ? "." + std::to_string(crossCompiled.options.version) : "";
+                const std::string path = outputPath + version + IGNITE_CrossCompileTargetExtension(target);
+                if (!crossPaths.insert(path).second)
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_ERROR, "Cross-compile output " + path + " was not written: another target with the same version already writes it.");
+                    continue;
+                }
+                WriteCompanionFile(options, path, std::vector<uint8_t>(crossCompiled.source.begin(), crossCompiled.source.end()), true);
             }
 
-            outIO.reserve(count);
-            for (size_t i = 0; i < count; ++i)
+            if (options.layoutHeader)
             {
-                ShaderStageIOInfo io = {};
-                io.name = list[i].name ? list[i].name : "";
-                io.id = list[i].id;
-                io.location = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationLocation);
+                LayoutHeaderOptions headerOptions = {};
+                headerOptions.namespaceName = MakeIdentifier(options.filepath.stem().string() + "_" + IGNITE_ShaderPlatformToString(options.platformType));
+                headerOptions.sourceName = options.filepath.filename().generic_string();
 
-                spvc_type typeHandle = spvc_compiler_get_type_handle(compiler, list[i].type_id);
-                if (typeHandle)
+                const std::string header = GenerateLayoutHeader(result.reflection, headerOptions);
+                if (!header.empty())
                 {
-                    io.vecSize = spvc_type_get_vector_size(typeHandle);
-                    io.columns = spvc_type_get_columns(typeHandle);
-                    io.format = IGNITE_MapSpvcType(typeHandle);
+                    WriteCompanionFile(options, outputPath + ".layout.h", std::vector<uint8_t>(header.begin(), header.end()), true);
                 }
-
-                outIO.push_back(std::move(io));
             }
+        }
 
-            std::sort(outIO.begin(), outIO.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
-                return a.location < b.location;
-            });
-        };
+        return result;
+    }
 
-        collectStageIO(SPVC_RESOURCE_TYPE_STAGE_INPUT, info.stageInputs);
-        collectStageIO(SPVC_RESOURCE_TYPE_STAGE_OUTPUT, info.stageOutputs);
+    std::vector<uint8_t> ShaderCompiler::SpecializeSPIRV(const std::vector<uint8_t>& spirv, const std::vector<SpecializationConstantValue>& values, bool optimize)
+    {
+        if (spirv.size() % sizeof(uint32_t) != 0)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV specialization failed: shader blob size is not aligned to 4 bytes.");
+            return {};
+        }
 
-        info.numStageInputs = info.stageInputs.size();
-        info.numStageOutputs = info.stageOutputs.size();
+        std::vector<uint32_t> words(spirv.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), spirv.data(), spirv.size());
 
-        if (type == IGNITE_SHADER_TYPE_VERTEX)
-        {
-            uint32_t offset = 0;
-            for (const ShaderStageIOInfo& input : info.stageInputs)
+        std::vector<bool> known(values.size(), false);
+        spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+            if (instruction.opcode == SpvOpDecorate && instruction.Operand(1) == SpvDecorationSpecId)
             {
-                if (input.format == IGNITE_VERTEX_ELEMENT_FORMAT_INVALID)
+                for (size_t i = 0; i < values.size(); ++i)
                 {
-                    DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV reflection: unsupported vertex attribute format at location " + std::to_string(input.location));
-                    continue;
+                    known[i] = known[i] || values[i].constantId == instruction.Operand(2);
                 }
-
-                const uint32_t componentSize = 4;
-                const uint32_t elementCount = input.vecSize > 0 ? input.vecSize : 1;
-                const uint32_t attributeSize = componentSize * elementCount;
-
-                VertexAttribute attribute = {};
-                attribute.name = input.name;
-                attribute.format = input.format;
-                attribute.bufferIndex = 0;
-                attribute.offset = offset;
-
-                offset += attributeSize;
-                info.vertexAttributes.push_back(std::move(attribute));
             }
-
-            const uint32_t stride = offset;
-            for (VertexAttribute& attribute : info.vertexAttributes)
+            return instruction.opcode != SpvOpFunction;
+        });
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (!known[i])
             {
-                attribute.elementStride = stride;
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV specialization: module has no specialization constant with id " + std::to_string(values[i].constantId) + ".");
             }
         }
 
-        DispatchLog(IGNITE_LOG_TYPE_INFO, "SPIRV reflection complete: " + std::string(IGNITE_GetShaderTypeString(type))
-            + " | UBO=" + std::to_string(info.numUniformBuffers)
-            + " Sampled=" + std::to_string(info.numSamplers)
-            + " StorageTex=" + std::to_string(info.numStorageTextures)
-            + " StorageBuf=" + std::to_string(info.numStorageBuffers)
-            + " Inputs=" + std::to_string(info.numStageInputs)
-            + " Outputs=" + std::to_string(info.numStageOutputs));
+        // Values are patched into the spec constant defaults first, then spirv-opt freezes the
+        // defaults and folds everything derived from them.
+        if (!spirv::SetSpecConstantDefaults(words.data(), words.size(), values))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV specialization failed: malformed SPIR-V module.");
+            return {};
+        }
 
-        spvc_context_destroy(context);
-        return info;
+        std::vector<std::string> passes = {
+            "--freeze-spec-const",
+            "--fold-spec-const-op-composite",
+            "--unify-const",
+            "--eliminate-dead-const",
+        };
+        if (optimize)
+        {
+            passes.push_back("-O");
+        }
+
+        std::vector<uint32_t> specialized;
+        if (!spirv::RunOptimizer(words.data(), words.size(), passes, specialized))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV specialization failed.");
+            return {};
+        }
+
+        std::vector<uint8_t> result(specialized.size() * sizeof(uint32_t));
+        std::memcpy(result.data(), specialized.data(), result.size());
+        return result;
     }
 
-    ShaderReflectionInfo ShaderReflection::DXILReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
+    std::vector<uint8_t> ShaderCompiler::OptimizeSPIRV(const std::vector<uint8_t>& spirv, IGNITE_SPIRVOptimizerRecipe recipe,
+        const std::vector<std::string>& customPasses, SPIRVOptimizerReport* report)
     {
-        ShaderReflectionInfo info = {};
-        info.shaderType = type;
-
-#ifdef _WIN32
-        if (shaderCode.empty() || shaderCode.size() < 4)
+        if (spirv.size() % sizeof(uint32_t) != 0)
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed: shader blob is empty or too small.");
-            return info;
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV optimization failed: shader blob size is not aligned to 4 bytes.");
+            return {};
         }
 
-        Microsoft::WRL::ComPtr<ID3D12ShaderReflection> reflection;
-        HRESULT result = E_FAIL;
-
-        Microsoft::WRL::ComPtr<IDxcUtils> utils;
-        Microsoft::WRL::ComPtr<IDxcContainerReflection> containerReflection;
-        Microsoft::WRL::ComPtr<IDxcBlobEncoding> blob;
-        result = DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(utils.GetAddressOf()));
-        if (SUCCEEDED(result))
+        if (recipe == IGNITE_SPIRV_OPTIMIZER_RECIPE_DEFAULT)
         {
-            result = utils->CreateBlob(shaderCode.data(), static_cast<UINT32>(shaderCode.size()), CP_ACP, &blob);
+            recipe = IGNITE_SPIRV_OPTIMIZER_RECIPE_PERFORMANCE;
         }
-        if (SUCCEEDED(result))
+
+        if (report)
         {
-            result = DxcCreateInstance(CLSID_DxcContainerReflection, IID_PPV_ARGS(containerReflection.GetAddressOf()));
+            *report = {};
+            report->recipe = recipe;
+            report->sizeBefore = spirv.size();
+            report->sizeAfter = spirv.size();
         }
-        if (SUCCEEDED(result))
+
+        if (recipe == IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE || (recipe == IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM && customPasses.empty()))
         {
-            result = containerReflection->Load(blob.Get());
+            return spirv;
         }
-        if (SUCCEEDED(result))
+
+        std::vector<uint32_t> words(spirv.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), spirv.data(), spirv.size());
+
+        std::vector<uint32_t> optimized;
+        if (recipe != IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM)
         {
-            UINT32 partIndex = 0;
-            if (SUCCEEDED(containerReflection->FindFirstPartKind(DXC_PART_DXIL, &partIndex)))
+            // Built-in recipes take their pass list from the linked SPIRV-Tools and run as one
+            // pipeline, so the report has a single entry named after the recipe's flag.
+            const auto start = std::chrono::steady_clock::now();
+            if (!spirv::RunRecipe(words.data(), words.size(), recipe, optimized))
             {
-                result = containerReflection->GetPartReflection(partIndex, IID_PPV_ARGS(reflection.GetAddressOf()));
+                return {};
             }
-            else
+            if (report)
             {
-                result = E_FAIL;
+                const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                report->passes.push_back({ spirv::RecipeFlag(recipe), elapsed.count(), spirv.size(), optimized.size() * sizeof(uint32_t) });
+                report->milliseconds = elapsed.count();
             }
         }
-
-        if (FAILED(result) || !reflection)
+        else if (!report)
         {
-            result = D3DReflect(shaderCode.data(), shaderCode.size(), IID_PPV_ARGS(reflection.GetAddressOf()));
+            if (!spirv::RunOptimizer(words.data(), words.size(), customPasses, optimized))
+            {
+                return {};
+            }
         }
-
-        if (FAILED(result) || !reflection)
+        else
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed. HRESULT=" + std::to_string(static_cast<uint32_t>(result)));
-            return info;
-        }
+            // One optimizer run per custom pass, so every pass is measured on its own. Each run
+            // also parses and re-emits the module, which is included in the pass time.
+            report->passes.reserve(customPasses.size());
+            for (const std::string& pass : customPasses)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                if (!spirv::RunOptimizer(words.data(), words.size(), { pass }, optimized))
+                {
+                    return {};
+                }
+                const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+                report->passes.push_back({ pass, elapsed.count(), words.size() * sizeof(uint32_t), optimized.size() * sizeof(uint32_t) });
+                report->milliseconds += elapsed.count();
+                words.swap(optimized);
+            }
+            optimized.swap(words);
+        }
+
+        std::vector<uint8_t> result(optimized.size() * sizeof(uint32_t));
+        std::memcpy(result.data(), optimized.data(), result.size());
+        if (report)
+        {
+            report->sizeAfter = result.size();
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> ShaderCompiler::RemapSPIRV(const std::vector<uint8_t>& spirv)
+    {
+        if (spirv.size() % sizeof(uint32_t) != 0)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV remap failed: shader blob size is not aligned to 4 bytes.");
+            return {};
+        }
+
+        std::vector<uint32_t> words(spirv.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), spirv.data(), spirv.size());
+
+        static const std::string canonicalizeFlag = "--canonicalize-ids";
+        const bool canonicalize = spirv::IsPassAvailable(canonicalizeFlag);
+        if (!canonicalize)
+        {
+            static std::once_flag warned;
+            std::call_once(warned, [] {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV remap: this SPIRV-Tools build has no --canonicalize-ids pass; ids are compacted in declaration order instead.");
+            });
+        }
+
+        std::vector<uint32_t> renumbered;
+        if (!spirv::RunOptimizer(words.data(), words.size(), { canonicalize ? canonicalizeFlag : "--compact-ids" }, renumbered))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV remap failed.");
+            return {};
+        }
+
+        std::vector<uint32_t> sorted;
+        if (!spirv::SortDeclarations(renumbered.data(), renumbered.size(), sorted))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV remap failed: malformed SPIR-V module.");
+            return {};
+        }
+
+        // Without content-hashed ids, the order now defines them, so compact once more.
+        if (!canonicalize)
+        {
+            std::vector<uint32_t> compacted;
+            if (!spirv::RunOptimizer(sorted.data(), sorted.size(), { "--compact-ids" }, compacted))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV remap failed.");
+                return {};
+            }
+            sorted.swap(compacted);
+        }
+
+        std::vector<uint8_t> result(sorted.size() * sizeof(uint32_t));
+        std::memcpy(result.data(), sorted.data(), result.size());
+        return result;
+    }
+
+    std::vector<uint8_t> ShaderCompiler::StripSPIRVDebugInfo(const std::vector<uint8_t>& spirv, std::vector<uint8_t>* sidecar)
+    {
+        if (spirv.size() % sizeof(uint32_t) != 0)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV debug strip failed: shader blob size is not aligned to 4 bytes.");
+            return {};
+        }
+
+        std::vector<uint32_t> words(spirv.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), spirv.data(), spirv.size());
+
+        std::vector<uint32_t> strippedWords;
+        if (!spirv::StripDebugInstructions(words.data(), words.size(), strippedWords))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV debug strip failed: malformed SPIR-V module.");
+            return {};
+        }
+
+        std::vector<uint8_t> stripped(strippedWords.size() * sizeof(uint32_t));
+        std::memcpy(stripped.data(), strippedWords.data(), stripped.size());
+
+        if (sidecar)
+        {
+            SPIRVDebugSidecarHeader header = {};
+            header.magic = kDebugSidecarMagic;
+            header.version = kDebugSidecarVersion;
+            header.strippedHash = HashBytes64(stripped.data(), stripped.size());
+            header.strippedSize = static_cast<uint32_t>(stripped.size());
+            header.moduleSize = static_cast<uint32_t>(spirv.size());
+
+            sidecar->resize(sizeof(header) + spirv.size());
+            std::memcpy(sidecar->data(), &header, sizeof(header));
+            std::memcpy(sidecar->data() + sizeof(header), spirv.data(), spirv.size());
+        }
+
+        return stripped;
+    }
+
+    std::vector<uint8_t> ShaderCompiler::ReadSPIRVDebugSidecar(const std::vector<uint8_t>& spirv, const std::vector<uint8_t>& sidecar)
+    {
+        SPIRVDebugSidecarHeader header = {};
+        if (sidecar.size() < sizeof(header))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV debug sidecar is too small.");
+            return {};
+        }
+
+        std::memcpy(&header, sidecar.data(), sizeof(header));
+        if (header.magic != kDebugSidecarMagic || header.version != kDebugSidecarVersion
+            || header.moduleSize != sidecar.size() - sizeof(header) || header.moduleSize % sizeof(uint32_t) != 0)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV debug sidecar is malformed or has an unsupported version.");
+            return {};
+        }
+
+        if (header.strippedSize != spirv.size() || header.strippedHash != HashBytes64(spirv.data(), spirv.size()))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV debug sidecar belongs to a different module.");
+            return {};
+        }
+
+        return std::vector<uint8_t>(sidecar.begin() + sizeof(header), sidecar.end());
+    }
+
+    std::vector<uint8_t> ShaderCompiler::CompileLibrary(const CompilerOptions& options, std::shared_ptr<DXCInstance> instance)
+    {
+        if (options.platformType != IGNITE_SHADER_PLATFORM_TYPE_SPIRV)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Shader libraries are SPIR-V only: " + options.filepath.generic_string());
+            return {};
+        }
+
+        CompilerOptions libraryOptions = options;
+        libraryOptions.spirvLibrary = true;
+
+        std::string extension = options.filepath.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::tolower(ch));
+        });
+
+        if (extension == ".glsl")
+        {
+            return CompileGLSL(libraryOptions);
+        }
+
+#ifdef _WIN32
+        if (!instance)
+        {
+            instance = CreateDXCCompiler();
+        }
+        if (!instance)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "CompileLibrary: could not create DXC instance.");
+            return {};
+        }
+        return CompileDXC(instance, libraryOptions);
+#else
+        (void)instance;
+        DispatchLog(IGNITE_LOG_TYPE_ERROR, "CompileLibrary: HLSL compilation requires DXC (Windows).");
+        return {};
+#endif
+    }
+
+    std::vector<uint8_t> ShaderCompiler::LinkSPIRV(const std::vector<std::vector<uint8_t>>& modules, bool createLibrary)
+    {
+        std::vector<spirv::LinkInput> inputs;
+        inputs.reserve(modules.size());
+        for (const std::vector<uint8_t>& module : modules)
+        {
+            if (module.size() % sizeof(uint32_t) != 0)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV link failed: shader blob size is not aligned to 4 bytes.");
+                return {};
+            }
+            inputs.push_back({ reinterpret_cast<const uint32_t*>(module.data()), module.size() / sizeof(uint32_t) });
+        }
+
+        std::vector<uint32_t> linked;
+        if (!spirv::LinkModules(inputs, createLibrary, linked))
+        {
+            return {};
+        }
+
+        std::vector<uint8_t> result(linked.size() * sizeof(uint32_t));
+        std::memcpy(result.data(), linked.data(), result.size());
+        return result;
+    }
+
+    const char* ShaderCompiler::GetVersion()
+    {
+        return "1.0.0";
+    }
+
+    void ShaderCompiler::DumpShader(const CompilerOptions& options, std::vector<uint8_t>& shaderCode, const std::string& outputPath)
+    {
+        std::string shaderPlatformStr = IGNITE_ShaderPlatformToString(options.platformType);
+
+        // Both header modes name the array after the source file, so switching modes keeps the symbol.
+        const std::string shaderName = MakeIdentifier(options.filepath.filename().generic_string());
+
+        // Outputs are rendered into memory and handed to the writer thread when a queue is set.
+        auto openOutput = [&](const std::string& path, bool textMode)
+        {
+            return options.outputQueue
+                ? std::make_unique<DataOutputContext>()
+                : std::make_unique<DataOutputContext>(path.c_str(), textMode);
+        };
+
+        auto finishOutput = [&](DataOutputContext& context, const std::string& path, bool textMode)
+        {
+            if (options.outputQueue)
+            {
+                options.outputQueue->Enqueue(path, context.TakeData(), textMode);
+                return true;
+            }
+            return context.Flush();
+        };
+
+        // Queued outputs are written later by the queue, which reports its own failures.
+        const std::string writeAction = options.outputQueue ? "Queued " : "Writing ";
+
+        if (options.binary || options.binaryBlob || options.headerBlob || options.headerEmbed)
+        {
+            std::unique_ptr<DataOutputContext> context = openOutput(outputPath, false);
+            if (!context->IsOpen())
+            {
+                return;
+            }
+
+            if (!context->WriteDataAsBinary(shaderCode.data(), shaderCode.size()) || !finishOutput(*context, outputPath, false))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to write binary: " + outputPath);
+                return;
+            }
+            DispatchLog(IGNITE_LOG_TYPE_INFO, writeAction + "binary " + shaderPlatformStr + ": " + outputPath);
+        }
+
+        if (options.headerEmbed)
+        {
+            if (options.header || options.headerBlob)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "headerEmbed overrides header/headerBlob for: " + outputPath);
+            }
+
+            const std::string binaryName = std::filesystem::path(outputPath).filename().generic_string();
+            const std::string headerOutput = outputPath + ".h";
+            const std::string stubOutput = outputPath + ".S";
+
+            const std::string headerText = BuildEmbedHeader(shaderName, binaryName, options.shaderDesc.combinedDefines);
+            const std::string stubText = BuildIncbinStub(shaderName, binaryName);
+
+            std::unique_ptr<DataOutputContext> headerContext = openOutput(headerOutput, true);
+            std::unique_ptr<DataOutputContext> stubContext = openOutput(stubOutput, true);
+            if (!headerContext->IsOpen() || !stubContext->IsOpen())
+                return;
+
+            if (!headerContext->WriteDataAsBinary(headerText.data(), headerText.size()) || !finishOutput(*headerContext, headerOutput, true)
+                || !stubContext->WriteDataAsBinary(stubText.data(), stubText.size()) || !finishOutput(*stubContext, stubOutput, true))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to write embed header: " + headerOutput);
+                return;
+            }
+
+            DispatchLog(IGNITE_LOG_TYPE_INFO, writeAction + "embed header [" + shaderPlatformStr + "]: " + headerOutput);
+        }
+        else if (options.header || options.headerBlob)
+        {
+            std::string headerOutput = outputPath + ".h"; // .h extension
+        
+            std::unique_ptr<DataOutputContext> context = openOutput(headerOutput, true);
+            if (!context->IsOpen())
+                return;
+
+            const bool emitWords = options.headerWords && (shaderCode.size() % sizeof(uint32_t)) == 0;
+            if (options.headerWords && !emitWords)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "Shader blob size is not a multiple of 4, writing header as bytes: " + headerOutput);
+            }
+
+            context->WriteTextPreamble(shaderName.c_str(), options.shaderDesc.combinedDefines, emitWords);
+            if (emitWords)
+            {
+                context->WriteDataAsWords(shaderCode.data(), shaderCode.size());
+            }
+            else
+            {
+                context->WriteDataAsText(shaderCode.data(), shaderCode.size());
+            }
+            context->WriteTextEpilog();
+
+            if (!finishOutput(*context, headerOutput, true))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Failed to write header: " + headerOutput);
+                return;
+            }
+
+            DispatchLog(IGNITE_LOG_TYPE_INFO, writeAction + "header [" + shaderPlatformStr + "]: " + headerOutput);
+        }
+    }
+
+    struct ShaderOutputQueue::Impl
+    {
+        struct PendingWrite
+        {
+            std::string path;
+            std::vector<uint8_t> data;
+            bool textMode = false;
+            uint64_t sequence = 0; // enqueue order, so each Flush reports only the writes it waited for
+        };
+
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable progress;
+        std::deque<PendingWrite> queue;
+        size_t maxPendingBytes = 0;
+        size_t pendingBytes = 0;
+        uint64_t enqueuedCount = 0;
+        uint64_t completedCount = 0;
+        uint64_t flushedCount = 0; // writes below this sequence belong to a Flush that already started
+        bool stopping = false;
+        std::vector<uint64_t> failedSequences; // failed writes not yet reported by a Flush
+        std::thread thread;
+
+        void WorkerLoop()
+        {
+            std::vector<PendingWrite> batch;
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workAvailable.wait(lock, [this] { return stopping || !queue.empty(); });
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+
+                    batch.clear();
+                    batch.reserve(queue.size());
+                    for (PendingWrite& write : queue)
+                    {
+                        batch.push_back(std::move(write));
+                    }
+                    queue.clear();
+                }
+
+                // Coalesce: only the newest write to each path in the batch reaches the disk.
+                std::unordered_map<std::string, size_t> newestWrite;
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    newestWrite[batch[i].path] = i;
+                }
+
+                std::unordered_set<std::string> failedPaths;
+                size_t batchBytes = 0;
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    PendingWrite& write = batch[i];
+                    batchBytes += write.data.size();
+                    if (newestWrite[write.path] != i)
+                    {
+                        continue;
+                    }
+
+                    DataOutputContext context(write.path.c_str(), write.textMode);
+                    if (!context.stream || !context.WriteDataAsBinary(write.data.data(), write.data.size()) || !context.Flush())
+                    {
+                        DispatchLog(IGNITE_LOG_TYPE_ERROR, "Output queue: failed to write " + write.path);
+                        failedPaths.insert(write.path);
+                    }
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    pendingBytes -= batchBytes;
+                    completedCount += batch.size();
+
+                    // Writes coalesced into a failed one failed as well.
+                    for (const PendingWrite& write : batch)
+                    {
+                        if (failedPaths.count(write.path))
+                        {
+                            failedSequences.push_back(write.sequence);
+                        }
+                    }
+                }
+                progress.notify_all();
+            }
+        }
+    };
+
+    ShaderOutputQueue::ShaderOutputQueue(size_t maxPendingBytes)
+        : m_impl(std::make_unique<Impl>())
+    {
+        m_impl->maxPendingBytes = maxPendingBytes;
+        m_impl->thread = std::thread([impl = m_impl.get()] { impl->WorkerLoop(); });
+    }
+
+    ShaderOutputQueue::~ShaderOutputQueue()
+    {
+        Flush();
+        {
+            std::lock_guard<std::mutex> lock(m_impl->mutex);
+            m_impl->stopping = true;
+        }
+        m_impl->workAvailable.notify_one();
+        m_impl->thread.join();
+    }
+
+    void ShaderOutputQueue::Enqueue(std::string path, std::vector<uint8_t> data, bool textMode)
+    {
+        const size_t size = data.size();
+        {
+            std::unique_lock<std::mutex> lock(m_impl->mutex);
+
+            // Backpressure; a single oversized write is still accepted once the queue drains.
+            m_impl->progress.wait(lock, [&] {
+                return m_impl->pendingBytes == 0 || m_impl->pendingBytes + size <= m_impl->maxPendingBytes;
+            });
+
+            m_impl->queue.push_back({ std::move(path), std::move(data), textMode, m_impl->enqueuedCount });
+            m_impl->pendingBytes += size;
+            m_impl->enqueuedCount++;
+        }
+        m_impl->workAvailable.notify_one();
+    }
+
+    bool ShaderOutputQueue::Flush()
+    {
+        std::unique_lock<std::mutex> lock(m_impl->mutex);
+        const uint64_t first = m_impl->flushedCount;
+        const uint64_t target = m_impl->enqueuedCount;
+        m_impl->flushedCount = std::max(first, target);
+        m_impl->progress.wait(lock, [&] { return m_impl->completedCount >= target; });
+
+        // Concurrent flushes cover disjoint ranges of writes, so each failure is reported exactly once.
+        std::vector<uint64_t>& failed = m_impl->failedSequences;
+        const auto reported = std::remove_if(failed.begin(), failed.end(), [&](uint64_t sequence) {
+            return sequence >= first && sequence < target;
+        });
+        const bool succeeded = reported == failed.end();
+        failed.erase(reported, failed.end());
+        return succeeded;
+    }
+
+    namespace
+    {
+        std::atomic<IGNITE_SPIRVReflectionBackend> g_spirvReflectionBackend{ IGNITE_SPIRV_REFLECTION_BACKEND_NATIVE };
+
+        IGNITE_ShaderDataType MapSpvcDataType(spvc_type type)
+        {
+            switch (spvc_type_get_basetype(type))
+            {
+            case SPVC_BASETYPE_BOOLEAN: return IGNITE_SHADER_DATA_TYPE_BOOL;
+            case SPVC_BASETYPE_INT8: return IGNITE_SHADER_DATA_TYPE_INT8;
+            case SPVC_BASETYPE_UINT8: return IGNITE_SHADER_DATA_TYPE_UINT8;
+            case SPVC_BASETYPE_INT16: return IGNITE_SHADER_DATA_TYPE_INT16;
+            case SPVC_BASETYPE_UINT16: return IGNITE_SHADER_DATA_TYPE_UINT16;
+            case SPVC_BASETYPE_INT32: return IGNITE_SHADER_DATA_TYPE_INT;
+            case SPVC_BASETYPE_UINT32: return IGNITE_SHADER_DATA_TYPE_UINT;
+            case SPVC_BASETYPE_INT64: return IGNITE_SHADER_DATA_TYPE_INT64;
+            case SPVC_BASETYPE_UINT64: return IGNITE_SHADER_DATA_TYPE_UINT64;
+            case SPVC_BASETYPE_FP16: return IGNITE_SHADER_DATA_TYPE_HALF;
+            case SPVC_BASETYPE_FP32: return IGNITE_SHADER_DATA_TYPE_FLOAT;
+            case SPVC_BASETYPE_FP64: return IGNITE_SHADER_DATA_TYPE_DOUBLE;
+            case SPVC_BASETYPE_STRUCT: return IGNITE_SHADER_DATA_TYPE_STRUCT;
+            default: return IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+            }
+        }
+
+        // Matches Module::DescriptorCount: product of array dimensions, 0 plus unbounded for runtime arrays.
+        uint32_t SpvcDescriptorCount(spvc_compiler compiler, spvc_type type, bool* outUnbounded)
+        {
+            *outUnbounded = false;
+            if (!type)
+            {
+                return 1;
+            }
+
+            uint64_t count = 1;
+            const unsigned dimensions = spvc_type_get_num_array_dimensions(type);
+            for (unsigned dimension = 0; dimension < dimensions; ++dimension)
+            {
+                uint64_t length = spvc_type_get_array_dimension(type, dimension);
+                if (!spvc_type_array_dimension_is_literal(type, dimension))
+                {
+                    // Specialization constant length: use its default value.
+                    spvc_constant constant = spvc_compiler_get_constant_handle(compiler, static_cast<spvc_constant_id>(length));
+                    length = constant ? spvc_constant_get_scalar_u32(constant, 0, 0) : 1;
+                }
+                else if (length == 0)
+                {
+                    *outUnbounded = true;
+                    return 0;
+                }
+                count *= length;
+            }
+            return static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+        }
+
+        // Flattens a block's members depth-first, matching the native backend's naming and offsets.
+        void CollectSpvcMembers(spvc_compiler compiler, spvc_type_id structId, const std::string& prefix, uint32_t baseOffset, uint32_t depth, std::vector<ShaderBufferMember>& out)
+        {
+            spvc_type structType = spvc_compiler_get_type_handle(compiler, structId);
+            if (!structType || depth > 64)
+            {
+                return;
+            }
+
+            const unsigned memberCount = spvc_type_get_num_member_types(structType);
+            for (unsigned i = 0; i < memberCount; ++i)
+            {
+                spvc_type memberType = spvc_compiler_get_type_handle(compiler, spvc_type_get_member_type(structType, i));
+                if (!memberType)
+                {
+                    continue;
+                }
+
+                const char* memberName = spvc_compiler_get_member_name(compiler, structId, i);
+
+                ShaderBufferMember item = {};
+                item.name = prefix + (memberName && *memberName ? std::string(memberName) : "_m" + std::to_string(i));
+                item.type = MapSpvcDataType(memberType);
+                item.vecSize = spvc_type_get_vector_size(memberType);
+                item.columns = spvc_type_get_columns(memberType);
+                item.rowMajor = spvc_compiler_has_member_decoration(compiler, structId, i, SpvDecorationRowMajor) != 0;
+                item.depth = depth;
+
+                unsigned offset = 0;
+                if (spvc_compiler_type_struct_member_offset(compiler, structType, i, &offset) == SPVC_SUCCESS)
+                {
+                    item.offset = baseOffset + offset;
+                }
+
+                size_t size = 0;
+                if (spvc_compiler_get_declared_struct_member_size(compiler, structType, i, &size) == SPVC_SUCCESS)
+                {
+                    item.size = static_cast<uint32_t>(size);
+                }
+
+                unsigned matrixStride = 0;
+                if (item.columns > 1 && spvc_compiler_type_struct_member_matrix_stride(compiler, structType, i, &matrixStride) == SPVC_SUCCESS)
+                {
+                    item.matrixStride = matrixStride;
+                }
+
+                const unsigned dimensions = spvc_type_get_num_array_dimensions(memberType);
+                if (dimensions > 0)
+                {
+                    unsigned arrayStride = 0;
+                    if (spvc_compiler_type_struct_member_array_stride(compiler, structType, i, &arrayStride) == SPVC_SUCCESS)
+                    {
+                        item.arrayStride = arrayStride;
+                    }
+
+                    // SPIRV-Cross stores the outermost dimension last.
+                    const unsigned outer = dimensions - 1;
+                    const SpvId length = spvc_type_get_array_dimension(memberType, outer);
+                    if (spvc_type_array_dimension_is_literal(memberType, outer))
+                    {
+                        item.arraySize = length;
+                    }
+                    else if (spvc_constant constant = spvc_compiler_get_constant_handle(compiler, length))
+                    {
+                        item.arraySize = spvc_constant_get_scalar_u32(constant, 0, 0);
+                    }
+                }
+
+                const bool isStruct = item.type == IGNITE_SHADER_DATA_TYPE_STRUCT;
+                const std::string nestedPrefix = isStruct ? item.name + "." : std::string();
+                const uint32_t nestedOffset = item.offset;
+                out.push_back(std::move(item));
+
+                if (isStruct)
+                {
+                    CollectSpvcMembers(compiler, spvc_type_get_base_type_id(memberType), nestedPrefix, nestedOffset, depth + 1, out);
+                }
+            }
+        }
+
+#ifdef _WIN32
+        IGNITE_ShaderDataType MapD3DDataType(D3D_SHADER_VARIABLE_TYPE type)
+        {
+            switch (type)
+            {
+            case D3D_SVT_BOOL: return IGNITE_SHADER_DATA_TYPE_BOOL;
+            case D3D_SVT_UINT8: return IGNITE_SHADER_DATA_TYPE_UINT8;
+            case D3D_SVT_INT16: return IGNITE_SHADER_DATA_TYPE_INT16;
+            case D3D_SVT_UINT16: return IGNITE_SHADER_DATA_TYPE_UINT16;
+            case D3D_SVT_INT:
+            case D3D_SVT_MIN16INT:
+            case D3D_SVT_MIN12INT: return IGNITE_SHADER_DATA_TYPE_INT;
+            case D3D_SVT_UINT:
+            case D3D_SVT_MIN16UINT: return IGNITE_SHADER_DATA_TYPE_UINT;
+            case D3D_SVT_INT64: return IGNITE_SHADER_DATA_TYPE_INT64;
+            case D3D_SVT_UINT64: return IGNITE_SHADER_DATA_TYPE_UINT64;
+            case D3D_SVT_FLOAT16: return IGNITE_SHADER_DATA_TYPE_HALF;
+            case D3D_SVT_FLOAT:
+            case D3D_SVT_MIN16FLOAT:
+            case D3D_SVT_MIN10FLOAT: return IGNITE_SHADER_DATA_TYPE_FLOAT;
+            case D3D_SVT_DOUBLE: return IGNITE_SHADER_DATA_TYPE_DOUBLE;
+            default: return IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+            }
+        }
+
+        uint32_t D3DTypeSize(ID3D12ShaderReflectionType* type, uint32_t depth = 0);
+
+        // Size of one element under cbuffer packing: every matrix row/column and array element starts a 16-byte register.
+        uint32_t D3DElementSize(ID3D12ShaderReflectionType* type, const D3D12_SHADER_TYPE_DESC& desc, uint32_t depth)
+        {
+            uint32_t scalarSize = 4;
+            if (desc.Type == D3D_SVT_DOUBLE || desc.Type == D3D_SVT_INT64 || desc.Type == D3D_SVT_UINT64)
+            {
+                scalarSize = 8;
+            }
+            else if (desc.Type == D3D_SVT_FLOAT16 || desc.Type == D3D_SVT_INT16 || desc.Type == D3D_SVT_UINT16)
+            {
+                scalarSize = 2;
+            }
+
+            switch (desc.Class)
+            {
+            case D3D_SVC_SCALAR: return scalarSize;
+            case D3D_SVC_VECTOR: return desc.Columns * scalarSize;
+            case D3D_SVC_MATRIX_ROWS: return (desc.Rows - 1) * 16 + desc.Columns * scalarSize;
+            case D3D_SVC_MATRIX_COLUMNS: return (desc.Columns - 1) * 16 + desc.Rows * scalarSize;
+            case D3D_SVC_STRUCT:
+            {
+                uint32_t size = 0;
+                for (UINT m = 0; m < desc.Members; ++m)
+                {
+                    ID3D12ShaderReflectionType* memberType = type->GetMemberTypeByIndex(m);
+                    D3D12_SHADER_TYPE_DESC memberDesc = {};
+                    if (memberType && SUCCEEDED(memberType->GetDesc(&memberDesc)))
+                    {
+                        size = std::max(size, memberDesc.Offset + D3DTypeSize(memberType, depth + 1));
+                    }
+                }
+                return size;
+            }
+            default: return 0;
+            }
+        }
+
+        uint32_t D3DTypeSize(ID3D12ShaderReflectionType* type, uint32_t depth)
+        {
+            D3D12_SHADER_TYPE_DESC desc = {};
+            if (!type || depth > 64 || FAILED(type->GetDesc(&desc)))
+            {
+                return 0;
+            }
+
+            const uint32_t elementSize = D3DElementSize(type, desc, depth);
+            const uint32_t stride = (elementSize + 15u) & ~15u;
+            return desc.Elements > 1 ? (desc.Elements - 1) * stride + elementSize : elementSize;
+        }
+
+        // Flattens one cbuffer variable; D3D reports member offsets relative to the enclosing struct.
+        void CollectD3DMembers(ID3D12ShaderReflectionType* type, const std::string& name, uint32_t offset, uint32_t size, uint32_t depth, std::vector<ShaderBufferMember>& out)
+        {
+            D3D12_SHADER_TYPE_DESC desc = {};
+            if (!type || depth > 64 || FAILED(type->GetDesc(&desc)))
+            {
+                return;
+            }
+
+            ShaderBufferMember item = {};
+            item.name = name;
+            item.type = desc.Class == D3D_SVC_STRUCT ? IGNITE_SHADER_DATA_TYPE_STRUCT : MapD3DDataType(desc.Type);
+            item.offset = offset;
+            item.size = size;
+            item.depth = depth;
+            item.arraySize = desc.Elements;
+            if (desc.Elements > 0)
+            {
+                item.arrayStride = (D3DElementSize(type, desc, depth) + 15u) & ~15u;
+            }
+
+            switch (desc.Class)
+            {
+            case D3D_SVC_VECTOR:
+                item.vecSize = desc.Columns;
+                break;
+            case D3D_SVC_MATRIX_ROWS:
+                item.rowMajor = true;
+                [[fallthrough]];
+            case D3D_SVC_MATRIX_COLUMNS:
+                item.vecSize = desc.Rows;
+                item.columns = desc.Columns;
+                item.matrixStride = 16;
+                break;
+            default:
+                break;
+            }
+
+            out.push_back(item);
+
+            if (desc.Class == D3D_SVC_STRUCT)
+            {
+                for (UINT m = 0; m < desc.Members; ++m)
+                {
+                    ID3D12ShaderReflectionType* memberType = type->GetMemberTypeByIndex(m);
+                    D3D12_SHADER_TYPE_DESC memberDesc = {};
+                    if (!memberType || FAILED(memberType->GetDesc(&memberDesc)))
+                    {
+                        continue;
+                    }
+
+                    const char* memberName = type->GetMemberTypeName(m);
+                    CollectD3DMembers(memberType, name + "." + (memberName ? memberName : "_m" + std::to_string(m)),
+                        offset + memberDesc.Offset, D3DTypeSize(memberType, depth + 1), depth + 1, out);
+                }
+            }
+        }
+#endif
+
+        // std430 size and alignment of a type, matching spirv::Module::Std430Size.
+        uint32_t SpvcStd430Size(spvc_compiler compiler, spvc_type type, uint32_t* outAlignment, uint32_t depth = 0)
+        {
+            uint32_t size = 0;
+            uint32_t alignment = 1;
+            if (type && depth <= 64)
+            {
+                const spvc_basetype basetype = spvc_type_get_basetype(type);
+                if (basetype == SPVC_BASETYPE_STRUCT)
+                {
+                    const unsigned memberCount = spvc_type_get_num_member_types(type);
+                    for (unsigned i = 0; i < memberCount; ++i)
+                    {
+                        uint32_t memberAlignment = 1;
+                        spvc_type memberType = spvc_compiler_get_type_handle(compiler, spvc_type_get_member_type(type, i));
+                        const uint32_t memberSize = SpvcStd430Size(compiler, memberType, &memberAlignment, depth + 1);
+                        size = AlignUp(size, memberAlignment) + memberSize;
+                        alignment = std::max(alignment, memberAlignment);
+                    }
+                    size = AlignUp(size, alignment);
+                }
+                else if (MapSpvcDataType(type) != IGNITE_SHADER_DATA_TYPE_UNKNOWN)
+                {
+                    const uint32_t component = basetype == SPVC_BASETYPE_BOOLEAN ? 4 : spvc_type_get_bit_width(type) / 8;
+                    const uint32_t vecSize = spvc_type_get_vector_size(type);
+                    const uint32_t columns = spvc_type_get_columns(type);
+                    alignment = component * (vecSize == 3 ? 4 : vecSize);
+                    size = columns > 1 ? alignment * columns : component * vecSize;
+                }
+
+                // Array dimensions are stored innermost first.
+                const unsigned dimensions = spvc_type_get_num_array_dimensions(type);
+                for (unsigned d = 0; d < dimensions; ++d)
+                {
+                    uint32_t length = spvc_type_get_array_dimension(type, d);
+                    if (!spvc_type_array_dimension_is_literal(type, d))
+                    {
+                        spvc_constant constant = spvc_compiler_get_constant_handle(compiler, length);
+                        length = constant ? spvc_constant_get_scalar_u32(constant, 0, 0) : 0;
+                    }
+                    size = AlignUp(size, alignment) * length;
+                }
+            }
+
+            if (outAlignment)
+            {
+                *outAlignment = alignment ? alignment : 1;
+            }
+            return size;
+        }
+
+        // Reflects through a SPIRV-Cross compiler; the caller owns its context.
+        bool ReflectSpvcCompiler(spvc_compiler compiler, const uint32_t* words, size_t wordCount, ShaderReflectionInfo& info)
+        {
+            spvc_resources resources = nullptr;
+            if (spvc_compiler_create_shader_resources(compiler, &resources) != SPVC_SUCCESS)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create shader resources.");
+                return false;
+            }
+
+            auto collectBindings = [&](spvc_resource_type resourceType, std::vector<ShaderResourceInfo>& outResources, bool isBuffer = false)
+            {
+                const spvc_reflected_resource* list = nullptr;
+                size_t count = 0;
+                if (spvc_resources_get_resource_list_for_type(resources, resourceType, &list, &count) != SPVC_SUCCESS)
+                {
+                    return;
+                }
+
+                outResources.reserve(count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    ShaderResourceInfo item = {};
+                    item.name = list[i].name ? list[i].name : "";
+                    item.id = list[i].id;
+                    item.set = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationDescriptorSet);
+                    item.binding = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationBinding);
+                    item.count = SpvcDescriptorCount(compiler, spvc_compiler_get_type_handle(compiler, list[i].type_id), &item.unbounded);
+
+                    if (isBuffer)
+                    {
+                        spvc_type blockType = spvc_compiler_get_type_handle(compiler, list[i].base_type_id);
+                        size_t declaredSize = 0;
+                        if (blockType && spvc_compiler_get_declared_struct_size(compiler, blockType, &declaredSize) == SPVC_SUCCESS)
+                        {
+                            item.size = static_cast<uint32_t>(declaredSize);
+                        }
+                        CollectSpvcMembers(compiler, list[i].base_type_id, std::string(), 0, 0, item.members);
+                    }
+
+                    outResources.push_back(std::move(item));
+                }
+            };
+
+            collectBindings(SPVC_RESOURCE_TYPE_UNIFORM_BUFFER, info.uniformBuffers, true);
+            collectBindings(SPVC_RESOURCE_TYPE_SAMPLED_IMAGE, info.sampledImages);
+            collectBindings(SPVC_RESOURCE_TYPE_STORAGE_IMAGE, info.storageImages);
+            collectBindings(SPVC_RESOURCE_TYPE_STORAGE_BUFFER, info.storageBuffers, true);
+            collectBindings(SPVC_RESOURCE_TYPE_SEPARATE_SAMPLERS, info.separateSamplers);
+            collectBindings(SPVC_RESOURCE_TYPE_SEPARATE_IMAGE, info.separateImages);
+
+            {
+                const spvc_reflected_resource* pushConstantList = nullptr;
+                size_t pushConstantCount = 0;
+                if (spvc_resources_get_resource_list_for_type(resources, SPVC_RESOURCE_TYPE_PUSH_CONSTANT, &pushConstantList, &pushConstantCount) == SPVC_SUCCESS)
+                {
+                    info.pushConstants.reserve(pushConstantCount);
+                    for (size_t i = 0; i < pushConstantCount; ++i)
+                    {
+                        ShaderPushConstantInfo pushConstant = {};
+                        pushConstant.name = pushConstantList[i].name ? pushConstantList[i].name : "";
+
+                        spvc_type typeHandle = spvc_compiler_get_type_handle(compiler, pushConstantList[i].base_type_id);
+                        size_t declaredSize = 0;
+                        if (typeHandle && spvc_compiler_get_declared_struct_size(compiler, typeHandle, &declaredSize) == SPVC_SUCCESS)
+                        {
+                            pushConstant.size = static_cast<uint32_t>(declaredSize);
+                        }
+                        CollectSpvcMembers(compiler, pushConstantList[i].base_type_id, std::string(), 0, 0, pushConstant.members);
+
+                        info.pushConstants.push_back(std::move(pushConstant));
+                    }
+                }
+            }
+
+            auto collectStageIO = [&](spvc_resource_type stageType, std::vector<ShaderStageIOInfo>& outIO)
+            {
+                const spvc_reflected_resource* list = nullptr;
+                size_t count = 0;
+                if (spvc_resources_get_resource_list_for_type(resources, stageType, &list, &count) != SPVC_SUCCESS)
+                {
+                    return;
+                }
+
+                outIO.reserve(count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    ShaderStageIOInfo io = {};
+                    io.name = list[i].name ? list[i].name : "";
+                    io.id = list[i].id;
+                    io.location = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationLocation);
+                    io.component = spvc_compiler_get_decoration(compiler, list[i].id, SpvDecorationComponent);
+
+                    spvc_type typeHandle = spvc_compiler_get_type_handle(compiler, list[i].type_id);
+                    if (typeHandle)
+                    {
+                        io.vecSize = spvc_type_get_vector_size(typeHandle);
+                        io.columns = spvc_type_get_columns(typeHandle);
+                        io.format = IGNITE_MapSpvcType(typeHandle);
+                    }
+
+                    outIO.push_back(std::move(io));
+                }
+
+                std::sort(outIO.begin(), outIO.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
+                    return a.location != b.location ? a.location < b.location : a.component < b.component;
+                });
+            };
+
+            collectStageIO(SPVC_RESOURCE_TYPE_STAGE_INPUT, info.stageInputs);
+            collectStageIO(SPVC_RESOURCE_TYPE_STAGE_OUTPUT, info.stageOutputs);
+
+            {
+                spvc_specialization_constant specialized[3] = {};
+                const spvc_constant_id workgroupSize = spvc_compiler_get_work_group_size_specialization_constants(compiler, &specialized[0], &specialized[1], &specialized[2]);
+                spvc_constant workgroupConstant = workgroupSize ? spvc_compiler_get_constant_handle(compiler, workgroupSize) : nullptr;
+                for (unsigned dimension = 0; dimension < 3; ++dimension)
+                {
+                    spvc_constant constant = nullptr;
+                    if (specialized[dimension].id != 0)
+                    {
+                        constant = spvc_compiler_get_constant_handle(compiler, specialized[dimension].id);
+                        info.compute.localSizeSpecialized[dimension] = spvc_compiler_has_decoration(compiler, specialized[dimension].id, SpvDecorationSpecId) != 0;
+                        info.compute.localSizeSpecIds[dimension] = info.compute.localSizeSpecialized[dimension] ? specialized[dimension].constant_id : 0;
+                    }
+                    else if (const unsigned sizeId = workgroupConstant ? 0 : spvc_compiler_get_execution_mode_argument_by_index(compiler, SpvExecutionModeLocalSizeId, dimension))
+                    {
+                        constant = spvc_compiler_get_constant_handle(compiler, sizeId);
+                    }
+
+                    if (constant)
+                    {
+                        info.compute.localSize[dimension] = spvc_constant_get_scalar_u32(constant, 0, 0);
+                    }
+                    else if (workgroupConstant)
+                    {
+                        info.compute.localSize[dimension] = spvc_constant_get_scalar_u32(workgroupConstant, 0, dimension);
+                    }
+                    else
+                    {
+                        info.compute.localSize[dimension] = spvc_compiler_get_execution_mode_argument_by_index(compiler, SpvExecutionModeLocalSize, dimension);
+                    }
+                }
+
+                // SPIRV-Cross lists no Workgroup variables, so they are found in the words and sized through its types.
+                std::unordered_map<uint32_t, uint32_t> pointees;
+                const bool interfaceListsAll = words[1] >= 0x10400;
+                std::vector<uint32_t> interfaceIds;
+                spirv::ForEachInstruction(words, wordCount, [&](const spirv::Instruction& instruction) {
+                    if (instruction.opcode == SpvOpEntryPoint && interfaceIds.empty())
+                    {
+                        uint32_t nameWords = 0;
+                        spirv::ReadString(instruction, 3, &nameWords);
+                        interfaceIds.assign(instruction.words + std::min<uint32_t>(3 + nameWords, instruction.wordCount), instruction.words + instruction.wordCount);
+                    }
+                    else if (instruction.opcode == SpvOpTypePointer && instruction.Operand(1) == SpvStorageClassWorkgroup)
+                    {
+                        pointees[instruction.Operand(0)] = instruction.Operand(2);
+                    }
+                    else if (instruction.opcode == SpvOpVariable && instruction.Operand(2) == SpvStorageClassWorkgroup)
+                    {
+                        const bool used = !interfaceListsAll || std::find(interfaceIds.begin(), interfaceIds.end(), instruction.Operand(1)) != interfaceIds.end();
+                        auto pointee = pointees.find(instruction.Operand(0));
+                        if (used && pointee != pointees.end())
+                        {
+                            uint32_t alignment = 1;
+                            const uint32_t size = SpvcStd430Size(compiler, spvc_compiler_get_type_handle(compiler, pointee->second), &alignment);
+                            info.compute.sharedMemorySize = AlignUp(info.compute.sharedMemorySize, alignment) + size;
+                        }
+                    }
+                    return instruction.opcode != SpvOpFunction;
+                });
+            }
+
+            {
+                const spvc_specialization_constant* constants = nullptr;
+                size_t constantCount = 0;
+                if (spvc_compiler_get_specialization_constants(compiler, &constants, &constantCount) == SPVC_SUCCESS)
+                {
+                    info.specializationConstants.reserve(constantCount);
+                    for (size_t i = 0; i < constantCount; ++i)
+                    {
+                        ShaderSpecializationConstant item = {};
+                        const char* name = spvc_compiler_get_name(compiler, constants[i].id);
+                        item.name = name ? name : "";
+                        item.id = constants[i].id;
+                        item.constantId = constants[i].constant_id;
+
+                        spvc_constant constant = spvc_compiler_get_constant_handle(compiler, constants[i].id);
+                        spvc_type typeHandle = constant ? spvc_compiler_get_type_handle(compiler, spvc_constant_get_type(constant)) : nullptr;
+                        if (typeHandle)
+                        {
+                            item.type = MapSpvcDataType(typeHandle);
+                            item.defaultValue = spvc_type_get_bit_width(typeHandle) == 64
+                                ? spvc_constant_get_scalar_u64(constant, 0, 0)
+                                : spvc_constant_get_scalar_u32(constant, 0, 0);
+                        }
+
+                        info.specializationConstants.push_back(std::move(item));
+                    }
+
+                    std::sort(info.specializationConstants.begin(), info.specializationConstants.end(), [](const ShaderSpecializationConstant& a, const ShaderSpecializationConstant& b) {
+                        return a.constantId < b.constantId;
+                    });
+                }
+            }
+
+            return true;
+        }
+
+        // Reference backend: full SPIRV-Cross parse. Leaves counters and vertex attributes to the caller.
+        bool ReflectSPIRVCross(const uint32_t* words, size_t wordCount, ShaderReflectionInfo& info)
+        {
+            spvc_context context = nullptr;
+            spvc_parsed_ir ir = nullptr;
+            spvc_compiler compiler = nullptr;
+
+            if (spvc_context_create(&context) != SPVC_SUCCESS)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create SPIRV-Cross context.");
+                return false;
+            }
+
+            if (spvc_context_parse_spirv(context, words, wordCount, &ir) != SPVC_SUCCESS)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not parse SPIRV blob.");
+                spvc_context_destroy(context);
+                return false;
+            }
+
+            if (spvc_context_create_compiler(context, SPVC_BACKEND_NONE, ir, SPVC_CAPTURE_MODE_TAKE_OWNERSHIP, &compiler) != SPVC_SUCCESS)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: could not create SPIRV-Cross compiler.");
+                spvc_context_destroy(context);
+                return false;
+            }
+
+            const bool reflected = ReflectSpvcCompiler(compiler, words, wordCount, info);
+            spvc_context_destroy(context);
+            return reflected;
+        }
+
+        // Fills counters and the packed vertex layout shared by both SPIR-V backends.
+        void FinalizeSPIRVReflection(IGNITE_ShaderType type, ShaderReflectionInfo& info)
+        {
+            info.numUniformBuffers = info.uniformBuffers.size();
+            info.numSamplers = info.sampledImages.size();
+            info.numStorageTextures = info.storageImages.size();
+            info.numStorageBuffers = info.storageBuffers.size();
+            info.numSeparateSamplers = info.separateSamplers.size();
+            info.numSeparateImages = info.separateImages.size();
+            info.numPushConstants = info.pushConstants.size();
+            info.numStageInputs = info.stageInputs.size();
+            info.numStageOutputs = info.stageOutputs.size();
+            info.numSpecializationConstants = info.specializationConstants.size();
+
+            if (type == IGNITE_SHADER_TYPE_VERTEX)
+            {
+                for (const ShaderStageIOInfo& input : info.stageInputs)
+                {
+                    if (input.format == IGNITE_VERTEX_ELEMENT_FORMAT_INVALID)
+                    {
+                        DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV reflection: unsupported vertex attribute format at location " + std::to_string(input.location));
+                        continue;
+                    }
+
+                    VertexAttribute attribute = {};
+                    attribute.name = input.name;
+                    attribute.format = ResolveVertexStorageFormat(input.name, input.format);
+                    attribute.bufferIndex = 0;
+                    info.vertexAttributes.push_back(std::move(attribute));
+                }
+
+                LayoutVertexStreams(info.vertexAttributes, info.vertexBuffers, nullptr);
+            }
+
+            DispatchLog(IGNITE_LOG_TYPE_INFO, "SPIRV reflection complete: " + std::string(IGNITE_GetShaderTypeString(type))
+                + " | UBO=" + std::to_string(info.numUniformBuffers)
+                + " Sampled=" + std::to_string(info.numSamplers)
+                + " StorageTex=" + std::to_string(info.numStorageTextures)
+                + " StorageBuf=" + std::to_string(info.numStorageBuffers)
+                + " Inputs=" + std::to_string(info.numStageInputs)
+                + " Outputs=" + std::to_string(info.numStageOutputs));
+        }
+
+        const char* CrossCompileTargetName(IGNITE_CrossCompileTarget target)
+        {
+            switch (target)
+            {
+            case IGNITE_CROSS_COMPILE_TARGET_GLSL: return "GLSL";
+            case IGNITE_CROSS_COMPILE_TARGET_ESSL: return "ESSL";
+            case IGNITE_CROSS_COMPILE_TARGET_HLSL: return "HLSL";
+            case IGNITE_CROSS_COMPILE_TARGET_MSL: return "MSL";
+            default: return "unknown";
+            }
+        }
+
+        spvc_backend CrossCompileBackend(IGNITE_CrossCompileTarget target)
+        {
+            switch (target)
+            {
+            case IGNITE_CROSS_COMPILE_TARGET_HLSL: return SPVC_BACKEND_HLSL;
+            case IGNITE_CROSS_COMPILE_TARGET_MSL: return SPVC_BACKEND_MSL;
+            default: return SPVC_BACKEND_GLSL;
+            }
+        }
+
+        // Only the options of the target's own backend are set; SPIRV-Cross rejects the others.
+        bool InstallCrossCompileOptions(spvc_compiler compiler, const CrossCompileOptions& options)
+        {
+            spvc_compiler_options spvcOptions = nullptr;
+            if (spvc_compiler_create_compiler_options(compiler, &spvcOptions) != SPVC_SUCCESS)
+            {
+                return false;
+            }
+
+            bool valid = true;
+            auto setBool = [&](spvc_compiler_option option, bool value) {
+                valid = spvc_compiler_options_set_bool(spvcOptions, option, value ? SPVC_TRUE : SPVC_FALSE) == SPVC_SUCCESS && valid;
+            };
+            auto setUint = [&](spvc_compiler_option option, uint32_t value) {
+                valid = spvc_compiler_options_set_uint(spvcOptions, option, value) == SPVC_SUCCESS && valid;
+            };
+
+            setBool(SPVC_COMPILER_OPTION_FIXUP_DEPTH_CONVENTION, options.fixupClipSpace);
+            setBool(SPVC_COMPILER_OPTION_FLIP_VERTEX_Y, options.flipVertexY);
+
+            switch (options.target)
+            {
+            case IGNITE_CROSS_COMPILE_TARGET_HLSL:
+                setUint(SPVC_COMPILER_OPTION_HLSL_SHADER_MODEL, options.version ? options.version : 50);
+                break;
+            case IGNITE_CROSS_COMPILE_TARGET_MSL:
+                setUint(SPVC_COMPILER_OPTION_MSL_VERSION, options.version ? options.version : SPVC_MAKE_MSL_VERSION(2, 0, 0));
+                setUint(SPVC_COMPILER_OPTION_MSL_PLATFORM, options.mslIOS ? SPVC_MSL_PLATFORM_IOS : SPVC_MSL_PLATFORM_MACOS);
+                setBool(SPVC_COMPILER_OPTION_MSL_ARGUMENT_BUFFERS, options.mslArgumentBuffers);
+                break;
+            default:
+            {
+                const bool es = options.target == IGNITE_CROSS_COMPILE_TARGET_ESSL;
+                setUint(SPVC_COMPILER_OPTION_GLSL_VERSION, options.version ? options.version : (es ? 310 : 450));
+                setBool(SPVC_COMPILER_OPTION_GLSL_ES, es);
+                setBool(SPVC_COMPILER_OPTION_GLSL_VULKAN_SEMANTICS, options.vulkanSemantics);
+                setBool(SPVC_COMPILER_OPTION_GLSL_EMIT_UNIFORM_BUFFER_AS_PLAIN_UNIFORMS, options.plainUniforms);
+                break;
+            }
+            }
+
+            return valid && spvc_compiler_install_compiler_options(compiler, spvcOptions) == SPVC_SUCCESS;
+        }
+
+        // GL has no separate samplers: every image/sampler pair the shader uses together becomes one
+        // combined sampler, named "<image>_<sampler>" when both halves have names.
+        void CombineImageSamplers(spvc_compiler compiler)
+        {
+            spvc_variable_id dummySampler = 0;
+            spvc_compiler_build_dummy_sampler_for_combined_images(compiler, &dummySampler);
+            if (spvc_compiler_build_combined_image_samplers(compiler) != SPVC_SUCCESS)
+            {
+                return;
+            }
+
+            const spvc_combined_image_sampler* samplers = nullptr;
+            size_t samplerCount = 0;
+            if (spvc_compiler_get_combined_image_samplers(compiler, &samplers, &samplerCount) != SPVC_SUCCESS)
+            {
+                return;
+            }
+
+            for (size_t i = 0; i < samplerCount; ++i)
+            {
+                const char* imageName = spvc_compiler_get_name(compiler, samplers[i].image_id);
+                const char* samplerName = spvc_compiler_get_name(compiler, samplers[i].sampler_id);
+                if (imageName && *imageName && samplerName && *samplerName)
+                {
+                    spvc_compiler_set_name(compiler, samplers[i].combined_id, (std::string(imageName) + "_" + samplerName).c_str());
+                }
+            }
+        }
+
+        CrossCompiledShader CrossCompileSpvcCompiler(spvc_context context, spvc_compiler compiler, const CrossCompileOptions& options)
+        {
+            CrossCompiledShader result = {};
+            result.options = options;
+            const std::string targetName = CrossCompileTargetName(options.target);
+
+            if (!InstallCrossCompileOptions(compiler, options))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile to " + targetName + " failed: invalid options.");
+                return result;
+            }
+
+            const bool glsl = options.target == IGNITE_CROSS_COMPILE_TARGET_GLSL || options.target == IGNITE_CROSS_COMPILE_TARGET_ESSL;
+            if (glsl && !options.vulkanSemantics)
+            {
+                CombineImageSamplers(compiler);
+            }
+
+            const char* source = nullptr;
+            if (spvc_compiler_compile(compiler, &source) != SPVC_SUCCESS || !source)
+            {
+                const char* error = spvc_context_get_last_error_string(context);
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile to " + targetName + " failed: " + std::string(error ? error : "unknown error"));
+                return result;
+            }
+            result.source = source;
+
+            const spvc_entry_point* entryPoints = nullptr;
+            size_t entryPointCount = 0;
+            if (spvc_compiler_get_entry_points(compiler, &entryPoints, &entryPointCount) == SPVC_SUCCESS && entryPointCount > 0)
+            {
+                const char* cleansed = spvc_compiler_get_cleansed_entry_point_name(compiler, entryPoints[0].name, entryPoints[0].execution_model);
+                result.entryPoint = cleansed ? cleansed : entryPoints[0].name;
+            }
+
+            DispatchLog(IGNITE_LOG_TYPE_INFO, "SPIRV cross-compiled to " + targetName + " (" + std::to_string(result.source.size()) + " bytes)");
+            return result;
+        }
+    }
+
+    void ShaderReflection::SetSPIRVReflectionBackend(IGNITE_SPIRVReflectionBackend backend)
+    {
+        g_spirvReflectionBackend.store(backend, std::memory_order_relaxed);
+    }
+
+    IGNITE_SPIRVReflectionBackend ShaderReflection::GetSPIRVReflectionBackend()
+    {
+        return g_spirvReflectionBackend.load(std::memory_order_relaxed);
+    }
+
+    void ShaderReflection::AssignVertexStreams(ShaderReflectionInfo& info, const VertexStreamMap& map)
+    {
+        for (const VertexStreamAssignment& assignment : map.assignments)
+        {
+            const bool found = std::any_of(info.vertexAttributes.begin(), info.vertexAttributes.end(), [&assignment](const VertexAttribute& attribute) {
+                return attribute.name == assignment.attribute;
+            });
+            if (!found)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "AssignVertexStreams: no vertex attribute named " + assignment.attribute);
+            }
+        }
+
+        LayoutVertexStreams(info.vertexAttributes, info.vertexBuffers, &map);
+    }
+
+    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
+    {
+        return SPIRVReflect(type, shaderCode, GetSPIRVReflectionBackend());
+    }
+
+    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode, IGNITE_SPIRVReflectionBackend backend)
+    {
+        if (shaderCode.size() % sizeof(uint32_t) != 0)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV reflection failed: shader blob size is not aligned to 4 bytes.");
+            ShaderReflectionInfo info = {};
+            info.shaderType = type;
+            return info;
+        }
+
+        return SPIRVReflect(type, reinterpret_cast<const uint32_t*>(shaderCode.data()), shaderCode.size() / sizeof(uint32_t), backend);
+    }
+
+    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode, const std::vector<uint8_t>& debugSidecar)
+    {
+        // Stripping only removes instructions, so the original module reflects to the same ids plus names.
+        const std::vector<uint8_t> debugModule = ShaderCompiler::ReadSPIRVDebugSidecar(shaderCode, debugSidecar);
+        return SPIRVReflect(type, debugModule.empty() ? shaderCode : debugModule);
+    }
+
+    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const uint32_t* words, size_t wordCount)
+    {
+        return SPIRVReflect(type, words, wordCount, GetSPIRVReflectionBackend());
+    }
+
+    ShaderReflectionInfo ShaderReflection::SPIRVReflect(IGNITE_ShaderType type, const uint32_t* words, size_t wordCount, IGNITE_SPIRVReflectionBackend backend)
+    {
+        ShaderReflectionInfo info = {};
+        info.shaderType = type;
+
+        bool reflected = false;
+        if (backend == IGNITE_SPIRV_REFLECTION_BACKEND_NATIVE)
+        {
+            reflected = spirv::Reflect(words, wordCount, info);
+            if (!reflected)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_WARNING, "SPIRV reflection: native parser rejected the module, falling back to SPIRV-Cross.");
+                info = {};
+                info.shaderType = type;
+            }
+        }
+
+        if (!reflected && !ReflectSPIRVCross(words, wordCount, info))
+        {
+            info = {};
+            info.shaderType = type;
+            return info;
+        }
+
+        FinalizeSPIRVReflection(type, info);
+        return info;
+    }
+
+    bool ShaderCompiler::CrossCompileSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& spirv, const std::vector<CrossCompileOptions>& targets,
+        std::vector<CrossCompiledShader>& outResults, ShaderReflectionInfo* reflection)
+    {
+        outResults.clear();
+        const uint32_t* words = reinterpret_cast<const uint32_t*>(spirv.data());
+        const size_t wordCount = spirv.size() / sizeof(uint32_t);
+        if (spirv.size() % sizeof(uint32_t) != 0 || !spirv::HasValidHeader(words, wordCount))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile failed: input is not a SPIR-V module.");
+            return false;
+        }
+
+        spvc_context context = nullptr;
+        spvc_parsed_ir ir = nullptr;
+        if (spvc_context_create(&context) != SPVC_SUCCESS)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile failed: could not create SPIRV-Cross context.");
+            return false;
+        }
+
+        if (spvc_context_parse_spirv(context, words, wordCount, &ir) != SPVC_SUCCESS)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile failed: could not parse SPIRV blob.");
+            spvc_context_destroy(context);
+            return false;
+        }
+
+        // Every compiler copies the parsed IR except the last, which takes it over.
+        size_t compilersLeft = targets.size() + (reflection ? 1 : 0);
+        auto createCompiler = [&](spvc_backend backend) {
+            spvc_compiler compiler = nullptr;
+            const spvc_capture_mode mode = --compilersLeft == 0 ? SPVC_CAPTURE_MODE_TAKE_OWNERSHIP : SPVC_CAPTURE_MODE_COPY;
+            return spvc_context_create_compiler(context, backend, ir, mode, &compiler) == SPVC_SUCCESS ? compiler : nullptr;
+        };
+
+        if (reflection)
+        {
+            *reflection = {};
+            reflection->shaderType = type;
+
+            spvc_compiler compiler = createCompiler(SPVC_BACKEND_NONE);
+            if (compiler && ReflectSpvcCompiler(compiler, words, wordCount, *reflection))
+            {
+                FinalizeSPIRVReflection(type, *reflection);
+            }
+            else
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile: reflection failed.");
+                *reflection = {};
+                reflection->shaderType = type;
+            }
+        }
+
+        outResults.reserve(targets.size());
+        for (const CrossCompileOptions& options : targets)
+        {
+            spvc_compiler compiler = createCompiler(CrossCompileBackend(options.target));
+            if (!compiler)
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "SPIRV cross-compile to " + std::string(CrossCompileTargetName(options.target)) + " failed: could not create SPIRV-Cross compiler.");
+                CrossCompiledShader failed = {};
+                failed.options = options;
+                outResults.push_back(std::move(failed));
+                continue;
+            }
+            outResults.push_back(CrossCompileSpvcCompiler(context, compiler, options));
+        }
+
+        spvc_context_destroy(context);
+        return true;
+    }
+
+    CrossCompiledShader ShaderCompiler::CrossCompileSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& spirv, const CrossCompileOptions& options)
+    {
+        std::vector<CrossCompiledShader> results;
+        if (!CrossCompileSPIRV(type, spirv, std::vector<CrossCompileOptions>{ options }, results))
+        {
+            CrossCompiledShader failed = {};
+            failed.options = options;
+            return failed;
+        }
+        return std::move(results.front());
+    }
+
+    ShaderReflectionInfo ShaderReflection::DXILReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
+    {
+        ShaderReflectionInfo info = {};
+        info.shaderType = type;
+
+#ifdef _WIN32
+        if (shaderCode.empty() || shaderCode.size() < 4)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed: shader blob is empty or too small.");
+            return info;
+        }
+
+        Microsoft::WRL::ComPtr<ID3D12ShaderReflection> reflection;
+        HRESULT result = E_FAIL;
+
+        Microsoft::WRL::ComPtr<IDxcUtils> utils;
+        Microsoft::WRL::ComPtr<IDxcContainerReflection> containerReflection;
+        Microsoft::WRL::ComPtr<IDxcBlobEncoding> blob;
+        result = DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(utils.GetAddressOf()));
+        if (SUCCEEDED(result))
+        {
+            result = utils->CreateBlob(shaderCode.data(), static_cast<UINT32>(shaderCode.size()), CP_ACP, &blob);
+        }
+        if (SUCCEEDED(result))
+        {
+            result = DxcCreateInstance(CLSID_DxcContainerReflection, IID_PPV_ARGS(containerReflection.GetAddressOf()));
+        }
+        if (SUCCEEDED(result))
+        {
+            result = containerReflection->Load(blob.Get());
+        }
+        if (SUCCEEDED(result))
+        {
+            UINT32 partIndex = 0;
+            if (SUCCEEDED(containerReflection->FindFirstPartKind(DXC_PART_DXIL, &partIndex)))
+            {
+                result = containerReflection->GetPartReflection(partIndex, IID_PPV_ARGS(reflection.GetAddressOf()));
+            }
+            else
+            {
+                result = E_FAIL;
+            }
+        }
+
+        if (FAILED(result) || !reflection)
+        {
+            result = D3DReflect(shaderCode.data(), shaderCode.size(), IID_PPV_ARGS(reflection.GetAddressOf()));
+        }
+
+        if (FAILED(result) || !reflection)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed. HRESULT=" + std::to_string(static_cast<uint32_t>(result)));
+            return info;
+        }
+
+        D3D12_SHADER_DESC shaderDesc = {};
+        result = reflection->GetDesc(&shaderDesc);
+        if (FAILED(result))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed while reading shader description. HRESULT=" + std::to_string(static_cast<uint32_t>(result)));
+            return info;
+        }
+
+        DispatchLog(IGNITE_LOG_TYPE_INFO, std::string("DXIL reflection: ") + IGNITE_GetShaderTypeString(type));
+
+        // Zero for stages without [numthreads]. Groupshared usage is not part of D3D12 shader reflection.
+        UINT threadGroupSize[3] = {};
+        reflection->GetThreadGroupSize(&threadGroupSize[0], &threadGroupSize[1], &threadGroupSize[2]);
+        info.compute.localSize[0] = threadGroupSize[0];
+        info.compute.localSize[1] = threadGroupSize[1];
+        info.compute.localSize[2] = threadGroupSize[2];
+
+        info.uniformBuffers.reserve(shaderDesc.ConstantBuffers);
+        for (UINT i = 0; i < shaderDesc.ConstantBuffers; ++i)
+        {
+            ID3D12ShaderReflectionConstantBuffer* cbuffer = reflection->GetConstantBufferByIndex(i);
+            if (!cbuffer)
+            {
+                continue;
+            }
+
+            D3D12_SHADER_BUFFER_DESC cbufferDesc = {};
+            if (FAILED(cbuffer->GetDesc(&cbufferDesc)))
+            {
+                continue;
+            }
+
+            ShaderResourceInfo resource = {};
+            resource.name = cbufferDesc.Name ? cbufferDesc.Name : "";
+            resource.id = i;
+
+            for (UINT b = 0; b < shaderDesc.BoundResources; ++b)
+            {
+                D3D12_SHADER_INPUT_BIND_DESC bindDesc = {};
+                if (SUCCEEDED(reflection->GetResourceBindingDesc(b, &bindDesc)) && bindDesc.Type == D3D_SIT_CBUFFER && bindDesc.Name && resource.name == bindDesc.Name)
+                {
+                    resource.binding = bindDesc.BindPoint;
+                    resource.set = bindDesc.Space;
+                    resource.unbounded = IsUnboundedBindCount(bindDesc.BindCount);
+                    resource.count = resource.unbounded ? 0 : bindDesc.BindCount;
+                    break;
+                }
+            }
+
+            resource.size = cbufferDesc.Size;
+            for (UINT v = 0; v < cbufferDesc.Variables; ++v)
+            {
+                ID3D12ShaderReflectionVariable* variable = cbuffer->GetVariableByIndex(v);
+                D3D12_SHADER_VARIABLE_DESC variableDesc = {};
+                if (variable && SUCCEEDED(variable->GetDesc(&variableDesc)))
+                {
+                    CollectD3DMembers(variable->GetType(), variableDesc.Name ? variableDesc.Name : "_m" + std::to_string(v),
+                        variableDesc.StartOffset, variableDesc.Size, 0, resource.members);
+                }
+            }
+
+            info.uniformBuffers.push_back(std::move(resource));
+        }
+
+        for (UINT i = 0; i < shaderDesc.BoundResources; ++i)
+        {
+            D3D12_SHADER_INPUT_BIND_DESC bindDesc = {};
+            if (FAILED(reflection->GetResourceBindingDesc(i, &bindDesc)))
+            {
+                continue;
+            }
+
+            ShaderResourceInfo resource = {};
+            resource.name = bindDesc.Name ? bindDesc.Name : "";
+            resource.id = i;
+            resource.binding = bindDesc.BindPoint;
+            resource.set = bindDesc.Space;
+            resource.unbounded = IsUnboundedBindCount(bindDesc.BindCount);
+            resource.count = resource.unbounded ? 0 : bindDesc.BindCount;
+
+            switch (bindDesc.Type)
+            {
+            case D3D_SIT_TEXTURE:
+                info.sampledImages.push_back(std::move(resource));
+                break;
+            case D3D_SIT_SAMPLER:
+                info.separateSamplers.push_back(std::move(resource));
+                break;
+            case D3D_SIT_UAV_RWTYPED:
+            case D3D_SIT_UAV_RWSTRUCTURED:
+            case D3D_SIT_UAV_RWBYTEADDRESS:
+            case D3D_SIT_UAV_APPEND_STRUCTURED:
+            case D3D_SIT_UAV_CONSUME_STRUCTURED:
+            case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
+            case D3D_SIT_UAV_FEEDBACKTEXTURE:
+                info.storageBuffers.push_back(std::move(resource));
+                break;
+            default:
+                break;
+            }
+        }
+
+        info.numUniformBuffers = info.uniformBuffers.size();
+        info.numSamplers = info.sampledImages.size();
+        info.numStorageTextures = info.storageImages.size();
+        info.numStorageBuffers = info.storageBuffers.size();
+        info.numSeparateSamplers = info.separateSamplers.size();
+        info.numSeparateImages = info.separateImages.size();
+        info.numPushConstants = info.pushConstants.size();
+
+        struct InputAttribute
+        {
+            UINT registerIndex;
+            std::string semanticName;
+            UINT semanticIndex;
+            UINT mask;
+            D3D_REGISTER_COMPONENT_TYPE componentType;
+        };
+
+        std::vector<InputAttribute> inputs;
+        if (type == IGNITE_SHADER_TYPE_VERTEX)
+        {
+            inputs.reserve(shaderDesc.InputParameters);
+        }
+
+        for (UINT i = 0; i < shaderDesc.InputParameters; ++i)
+        {
+            D3D12_SIGNATURE_PARAMETER_DESC paramDesc = {};
+            if (FAILED(reflection->GetInputParameterDesc(i, &paramDesc)))
+            {
+                continue;
+            }
+
+            ShaderStageIOInfo stageInput = {};
+            stageInput.name = paramDesc.SemanticName ? paramDesc.SemanticName : "";
+            if (paramDesc.SemanticIndex > 0)
+            {
+                stageInput.name += std::to_string(paramDesc.SemanticIndex);
+            }
+            stageInput.id = i;
+            stageInput.location = paramDesc.Register;
+            stageInput.columns = 1;
+
+            UINT mask = paramDesc.Mask;
+            uint32_t elementCount = 0;
+            uint32_t firstComponent = 0;
+            while (mask != 0)
+            {
+                elementCount += (mask & 1u) ? 1u : 0u;
+                firstComponent += elementCount == 0 ? 1u : 0u;
+                mask >>= 1;
+            }
+            stageInput.component = elementCount > 0 ? firstComponent : 0u;
+            stageInput.vecSize = (elementCount > 0) ? elementCount : 1u;
+            stageInput.format = IGNITE_Map3DComponent(paramDesc.ComponentType, stageInput.vecSize);
+            info.stageInputs.push_back(stageInput);
+
+            if (type == IGNITE_SHADER_TYPE_VERTEX)
+            {
+                inputs.push_back({ paramDesc.Register, paramDesc.SemanticName ? paramDesc.SemanticName : "", paramDesc.SemanticIndex, paramDesc.Mask, paramDesc.ComponentType });
+            }
+        }
+
+        for (UINT i = 0; i < shaderDesc.OutputParameters; ++i)
+        {
+            D3D12_SIGNATURE_PARAMETER_DESC paramDesc = {};
+            if (FAILED(reflection->GetOutputParameterDesc(i, &paramDesc)))
+            {
+                continue;
+            }
+
+            ShaderStageIOInfo stageOutput = {};
+            stageOutput.name = paramDesc.SemanticName ? paramDesc.SemanticName : "";
+            if (paramDesc.SemanticIndex > 0)
+            {
+                stageOutput.name += std::to_string(paramDesc.SemanticIndex);
+            }
+            stageOutput.id = i;
+            stageOutput.location = paramDesc.Register;
+            stageOutput.columns = 1;
+
+            UINT mask = paramDesc.Mask;
+            uint32_t elementCount = 0;
+            uint32_t firstComponent = 0;
+            while (mask != 0)
+            {
+                elementCount += (mask & 1u) ? 1u : 0u;
+                firstComponent += elementCount == 0 ? 1u : 0u;
+                mask >>= 1;
+            }
+            stageOutput.component = elementCount > 0 ? firstComponent : 0u;
+            stageOutput.vecSize = (elementCount > 0) ? elementCount : 1u;
+            stageOutput.format = IGNITE_Map3DComponent(paramDesc.ComponentType, stageOutput.vecSize);
+            info.stageOutputs.push_back(stageOutput);
+        }
+
+        std::sort(info.stageInputs.begin(), info.stageInputs.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
+            return a.location != b.location ? a.location < b.location : a.component < b.component;
+        });
+        std::sort(info.stageOutputs.begin(), info.stageOutputs.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
+            return a.location != b.location ? a.location < b.location : a.component < b.component;
+        });
+
+        info.numStageInputs = info.stageInputs.size();
+        info.numStageOutputs = info.stageOutputs.size();
+
+        if (type == IGNITE_SHADER_TYPE_VERTEX && !inputs.empty())
+        {
+            std::sort(inputs.begin(), inputs.end(), [](const InputAttribute& a, const InputAttribute& b) {
+                return a.registerIndex < b.registerIndex;
+            });
+
+            auto countMask = [](UINT mask)
+            {
+                uint32_t count = 0;
+                while (mask != 0)
+                {
+                    count += (mask & 0x1u) ? 1u : 0u;
+                    mask >>= 1;
+                }
+                return (count > 0) ? count : 1u;
+            };
+
+            for (const auto& input : inputs)
+            {
+                const uint32_t elementCount = countMask(input.mask);
+                const IGNITE_VertexElementFormat elementFormat = IGNITE_Map3DComponent(input.componentType, elementCount);
+                if (elementFormat == IGNITE_VERTEX_ELEMENT_FORMAT_INVALID)
+                {
+                    DispatchLog(IGNITE_LOG_TYPE_WARNING, "DXIL reflection: unsupported vertex input format for semantic " + input.semanticName);
+                    continue;
+                }
+
+                std::string name = input.semanticName;
+                if (input.semanticIndex > 0)
+                {
+                    name += std::to_string(input.semanticIndex);
+                }
+
+                VertexAttribute attribute = {};
+                attribute.format = ResolveVertexStorageFormat(input.semanticName, elementFormat);
+                attribute.name = std::move(name);
+                attribute.bufferIndex = 0;
+                info.vertexAttributes.push_back(std::move(attribute));
+            }
+
+            LayoutVertexStreams(info.vertexAttributes, info.vertexBuffers, nullptr);
+        }
+
+        DispatchLog(IGNITE_LOG_TYPE_INFO, "DXIL reflection complete: " + std::string(IGNITE_GetShaderTypeString(type))
+            + " | UBO=" + std::to_string(info.numUniformBuffers)
+            + " Sampled=" + std::to_string(info.numSamplers)
+            + " StorageBuf=" + std::to_string(info.numStorageBuffers)
+            + " Inputs=" + std::to_string(info.numStageInputs)
+            + " Outputs=" + std::to_string(info.numStageOutputs));
+#else
+        DispatchLog(IGNITE_LOG_TYPE_WARNING, "DXIL reflection is only available on Windows platform");
+#endif
+
+        return info;
+    }
+
+    namespace
+    {
+        void AddChange(ShaderReflectionDiff& diff, IGNITE_ReflectionChangeFlags change, std::string detail)
+        {
+            diff.changes |= change;
+            diff.details.push_back(std::move(detail));
+        }
+
+        bool SameMemberLayout(const ShaderBufferMember& a, const ShaderBufferMember& b)
+        {
+            return a.type == b.type && a.offset == b.offset && a.size == b.size && a.vecSize == b.vecSize && a.columns == b.columns
+                && a.arraySize == b.arraySize && a.arrayStride == b.arrayStride && a.matrixStride == b.matrixStride
+                && a.depth == b.depth && a.rowMajor == b.rowMajor;
+        }
+
+        // False if the layouts differ; with equal layouts, renamed members are recorded as name changes.
+        bool DiffMembers(ShaderReflectionDiff& diff, const std::string& owner, const std::vector<ShaderBufferMember>& oldMembers, const std::vector<ShaderBufferMember>& newMembers)
+        {
+            if (oldMembers.size() != newMembers.size()
+                || !std::equal(oldMembers.begin(), oldMembers.end(), newMembers.begin(), SameMemberLayout))
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < oldMembers.size(); ++i)
+            {
+                if (oldMembers[i].name != newMembers[i].name)
+                {
+                    AddChange(diff, IGNITE_REFLECTION_CHANGE_NAMES, owner + ": member '" + oldMembers[i].name + "' renamed to '" + newMembers[i].name + "'");
+                }
+            }
+            return true;
+        }
+
+        struct DiffBinding
+        {
+            const char* kind = nullptr;
+            bool isBuffer = false;
+            const ShaderResourceInfo* resource = nullptr;
+        };
+
+        // Keyed by (set, binding, register class): DXIL reflection keeps D3D register numbers, so
+        // b0, t0, s0 and u0 are distinct bindings that share (set, binding).
+        using DiffBindingKey = std::tuple<uint32_t, uint32_t, char>;
+
+        std::map<DiffBindingKey, DiffBinding> CollectDiffBindings(const ShaderReflectionInfo& info)
+        {
+            struct BindingList
+            {
+                const char* kind;
+                IGNITE_DescriptorType type;
+                const std::vector<ShaderResourceInfo>* resources;
+            };
+            const BindingList lists[] = {
+                { "uniform buffer", IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER, &info.uniformBuffers },
+                { "storage buffer", IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER, &info.storageBuffers },
+                { "sampled image", IGNITE_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, &info.sampledImages },
+                { "storage image", IGNITE_DESCRIPTOR_TYPE_STORAGE_IMAGE, &info.storageImages },
+                { "sampler", IGNITE_DESCRIPTOR_TYPE_SAMPLER, &info.separateSamplers },
+                { "separate image", IGNITE_DESCRIPTOR_TYPE_SAMPLED_IMAGE, &info.separateImages },
+            };
+
+            std::map<DiffBindingKey, DiffBinding> bindings;
+            for (size_t list = 0; list < std::size(lists); ++list)
+            {
+                const char registerClass = DescriptorRegisterClass(lists[list].type);
+                for (const ShaderResourceInfo& resource : *lists[list].resources)
+                {
+                    bindings[std::make_tuple(resource.set, resource.binding, registerClass)] = { lists[list].kind, list < 2, &resource };
+                }
+            }
+            return bindings;
+        }
+
+        std::string DescribeBinding(const DiffBinding& binding)
+        {
+            return "set " + std::to_string(binding.resource->set) + " binding " + std::to_string(binding.resource->binding)
+                + " (" + binding.kind + " '" + binding.resource->name + "')";
+        }
+
+        bool SameStageIO(const ShaderStageIOInfo& a, const ShaderStageIOInfo& b)
+        {
+            return a.location == b.location && a.component == b.component && a.format == b.format && a.vecSize == b.vecSize && a.columns == b.columns;
+        }
+
+        void DiffStageIO(ShaderReflectionDiff& diff, IGNITE_ReflectionChangeFlags change, const char* what, const std::vector<ShaderStageIOInfo>& oldIO, const std::vector<ShaderStageIOInfo>& newIO)
+        {
+            if (oldIO.size() != newIO.size() || !std::equal(oldIO.begin(), oldIO.end(), newIO.begin(), SameStageIO))
+            {
+                AddChange(diff, change, std::string(what) + " changed (" + std::to_string(oldIO.size()) + " -> " + std::to_string(newIO.size()) + ")");
+                return;
+            }
+
+            for (size_t i = 0; i < oldIO.size(); ++i)
+            {
+                if (oldIO[i].name != newIO[i].name)
+                {
+                    AddChange(diff, IGNITE_REFLECTION_CHANGE_NAMES, std::string(what) + " at location " + std::to_string(oldIO[i].location)
+                        + " renamed from '" + oldIO[i].name + "' to '" + newIO[i].name + "'");
+                }
+            }
+        }
+    }
+
+    ShaderReflectionDiff ShaderReflection::Diff(const ShaderReflectionInfo& oldInfo, const ShaderReflectionInfo& newInfo)
+    {
+        ShaderReflectionDiff diff;
+        if (oldInfo.shaderType != newInfo.shaderType)
+        {
+            AddChange(diff, IGNITE_REFLECTION_CHANGE_SHADER_TYPE, std::string("shader type changed from ") + IGNITE_GetShaderTypeString(oldInfo.shaderType)
+                + " to " + IGNITE_GetShaderTypeString(newInfo.shaderType));
+        }
+
+        const auto oldBindings = CollectDiffBindings(oldInfo);
+        const auto newBindings = CollectDiffBindings(newInfo);
+        for (const auto& [key, oldBinding] : oldBindings)
+        {
+            auto it = newBindings.find(key);
+            if (it == newBindings.end())
+            {
+                AddChange(diff, IGNITE_REFLECTION_CHANGE_BINDING_REMOVED, "binding removed: " + DescribeBinding(oldBinding));
+                continue;
+            }
+
+            const DiffBinding& newBinding = it->second;
+            const ShaderResourceInfo& oldResource = *oldBinding.resource;
+            const ShaderResourceInfo& newResource = *newBinding.resource;
+            if (oldBinding.kind != newBinding.kind || oldResource.count != newResource.count || oldResource.unbounded != newResource.unbounded)
+            {
+                AddChange(diff, IGNITE_REFLECTION_CHANGE_BINDING_TYPE, "binding changed: " + DescribeBinding(oldBinding) + " -> " + newBinding.kind
+                    + (newResource.unbounded ? " (unbounded)" : " x" + std::to_string(newResource.count)));
+                continue;
+            }
+
+            if (newBinding.isBuffer && (oldResource.size != newResource.size || !DiffMembers(diff, DescribeBinding(newBinding), oldResource.members, newResource.members)))
+            {
+                AddChange(diff, IGNITE_REFLECTION_CHANGE_BUFFER_LAYOUT, "buffer layout changed: " + DescribeBinding(newBinding) + ", "
+                    + std::to_string(oldResource.size) + " -> " + std::to_string(newResource.size) + " bytes");
+            }
+            if (oldResource.name != newResource.name)
+            {
+                AddChange(diff, IGNITE_REFLECTION_CHANGE_NAMES, "binding renamed: " + DescribeBinding(oldBinding) + " is now '" + newResource.name + "'");
+            }
+        }
+        for (const auto& [key, newBinding] : newBindings)
+        {
+            if (!oldBindings.count(key))
+            {
+                AddChange(diff, IGNITE_REFLECTION_CHANGE_BINDING_ADDED, "binding added: " + DescribeBinding(newBinding));
+            }
+        }
+
+        if (oldInfo.pushConstants.size() != newInfo.pushConstants.size())
+        {
+            AddChange(diff, IGNITE_REFLECTION_CHANGE_PUSH_CONSTANTS, "push constant blocks changed (" + std::to_string(oldInfo.pushConstants.size())
+                + " -> " + std::to_string(newInfo.pushConstants.size()) + ")");
+        }
+        else
+        {
+            for (size_t i = 0; i < oldInfo.pushConstants.size(); ++i)
+            {
+                const ShaderPushConstantInfo& oldBlock = oldInfo.pushConstants[i];
+                const ShaderPushConstantInfo& newBlock = newInfo.pushConstants[i];
+                const std::string owner = "push constant '" + newBlock.name + "'";
+                if (oldBlock.size != newBlock.size || !DiffMembers(diff, owner, oldBlock.members, newBlock.members))
+                {
+                    AddChange(diff, IGNITE_REFLECTION_CHANGE_PUSH_CONSTANTS, owner + " layout changed, " + std::to_string(oldBlock.size)
+                        + " -> " + std::to_string(newBlock.size) + " bytes");
+                }
+                else if (oldBlock.name != newBlock.name)
+                {
+                    AddChange(diff, IGNITE_REFLECTION_CHANGE_NAMES, "push constant '" + oldBlock.name + "' renamed to '" + newBlock.name + "'");
+                }
+            }
+        }
+
+        // Input layouts match attributes by semantic, so a renamed attribute is a vertex input change.
+        const bool sameAttributes = oldInfo.vertexAttributes.size() == newInfo.vertexAttributes.size()
+            && std::equal(oldInfo.vertexAttributes.begin(), oldInfo.vertexAttributes.end(), newInfo.vertexAttributes.begin(), [](const VertexAttribute& a, const VertexAttribute& b) {
+                return a.name == b.name && a.format == b.format && a.bufferIndex == b.bufferIndex && a.offset == b.offset && a.elementStride == b.elementStride;
+            });
+        const bool sameBuffers = oldInfo.vertexBuffers.size() == newInfo.vertexBuffers.size()
+            && std::equal(oldInfo.vertexBuffers.begin(), oldInfo.vertexBuffers.end(), newInfo.vertexBuffers.begin(), [](const VertexBufferLayout& a, const VertexBufferLayout& b) {
+                return a.bufferIndex == b.bufferIndex && a.stride == b.stride && a.inputRate == b.inputRate && a.stepRate == b.stepRate;
+            });
+        if (!sameAttributes || !sameBuffers)
+        {
+            AddChange(diff, IGNITE_REFLECTION_CHANGE_VERTEX_INPUT, "vertex input layout changed (" + std::to_string(oldInfo.vertexAttributes.size())
+                + " -> " + std::to_string(newInfo.vertexAttributes.size()) + " attributes)");
+        }
+        else
+        {
+            const bool vertexStage = newInfo.shaderType == IGNITE_SHADER_TYPE_VERTEX;
+            DiffStageIO(diff, vertexStage ? IGNITE_REFLECTION_CHANGE_VERTEX_INPUT : IGNITE_REFLECTION_CHANGE_STAGE_IO, "stage inputs", oldInfo.stageInputs, newInfo.stageInputs);
+        }
+        DiffStageIO(diff, IGNITE_REFLECTION_CHANGE_STAGE_IO, "stage outputs", oldInfo.stageOutputs, newInfo.stageOutputs);
+
+        const bool sameConstants = oldInfo.specializationConstants.size() == newInfo.specializationConstants.size()
+            && std::equal(oldInfo.specializationConstants.begin(), oldInfo.specializationConstants.end(), newInfo.specializationConstants.begin(),
+                [](const ShaderSpecializationConstant& a, const ShaderSpecializationConstant& b) {
+                    return a.constantId == b.constantId && a.type == b.type && a.defaultValue == b.defaultValue;
+                });
+        if (!sameConstants)
+        {
+            AddChange(diff, IGNITE_REFLECTION_CHANGE_SPECIALIZATION, "specialization constants changed (" + std::to_string(oldInfo.specializationConstants.size())
+                + " -> " + std::to_string(newInfo.specializationConstants.size()) + ")");
+        }
+
+        const ShaderComputeInfo& oldCompute = oldInfo.compute;
+        const ShaderComputeInfo& newCompute = newInfo.compute;
+        if (!std::equal(std::begin(oldCompute.localSize), std::end(oldCompute.localSize), std::begin(newCompute.localSize))
+            || !std::equal(std::begin(oldCompute.localSizeSpecialized), std::end(oldCompute.localSizeSpecialized), std::begin(newCompute.localSizeSpecialized))
+            || !std::equal(std::begin(oldCompute.localSizeSpecIds), std::end(oldCompute.localSizeSpecIds), std::begin(newCompute.localSizeSpecIds))
+            || oldCompute.sharedMemorySize != newCompute.sharedMemorySize)
+        {
+            AddChange(diff, IGNITE_REFLECTION_CHANGE_COMPUTE, "workgroup changed: " + std::to_string(oldCompute.localSize[0]) + "x" + std::to_string(oldCompute.localSize[1])
+                + "x" + std::to_string(oldCompute.localSize[2]) + " -> " + std::to_string(newCompute.localSize[0]) + "x" + std::to_string(newCompute.localSize[1])
+                + "x" + std::to_string(newCompute.localSize[2]) + ", shared " + std::to_string(oldCompute.sharedMemorySize) + " -> "
+                + std::to_string(newCompute.sharedMemorySize) + " bytes");
+        }
+
+        return diff;
+    }
+
+    ShaderReflectionDiff ShaderReflection::Diff(const CompiledShader& oldShader, const CompiledShader& newShader)
+    {
+        ShaderReflectionDiff diff = Diff(oldShader.reflection, newShader.reflection);
+        if (oldShader.code != newShader.code)
+        {
+            diff.changes |= IGNITE_REFLECTION_CHANGE_CODE;
+            diff.details.insert(diff.details.begin(), "bytecode changed (" + std::to_string(oldShader.code.size()) + " -> " + std::to_string(newShader.code.size()) + " bytes)");
+        }
+        return diff;
+    }
+
+    struct ShaderReflectionCache::Impl
+    {
+        struct Key
+        {
+            uint64_t hash = 0;
+            uint64_t check = 0; // second, differently seeded hash of the blob; a hit must match it too
+            size_t size = 0;
+            IGNITE_ShaderPlatformType platform = IGNITE_SHADER_PLATFORM_TYPE_SPIRV;
+            IGNITE_ShaderType type = IGNITE_SHADER_TYPE_VERTEX;
+            IGNITE_SPIRVReflectionBackend backend = IGNITE_SPIRV_REFLECTION_BACKEND_NATIVE; // backend that produced a SPIR-V reflection
+            bool crossCompiled = false; // entry holds cross-compiled source rather than reflection
+            CrossCompileOptions crossOptions;
+
+            bool operator==(const Key& other) const
+            {
+                return hash == other.hash && check == other.check && size == other.size && platform == other.platform && type == other.type
+                    && backend == other.backend && crossCompiled == other.crossCompiled && (!crossCompiled || crossOptions == other.crossOptions);
+            }
+        };
+
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const
+            {
+                if (!key.crossCompiled)
+                {
+                    return static_cast<size_t>(key.hash);
+                }
+
+                const uint32_t options[] = {
+                    uint32_t(key.crossOptions.target), key.crossOptions.version,
+                    uint32_t(key.crossOptions.vulkanSemantics) | uint32_t(key.crossOptions.plainUniforms) << 1
+                        | uint32_t(key.crossOptions.fixupClipSpace) << 2 | uint32_t(key.crossOptions.flipVertexY) << 3
+                        | uint32_t(key.crossOptions.mslIOS) << 4 | uint32_t(key.crossOptions.mslArgumentBuffers) << 5
+                };
+                return static_cast<size_t>(HashBytes64(options, sizeof(options), key.hash));
+            }
+        };
+
+        struct Entry
+        {
+            std::shared_ptr<const ShaderReflectionInfo> info;
+            std::shared_ptr<const CrossCompiledShader> crossCompiled;
+            std::list<Key>::iterator lruPosition;
+        };
+
+        mutable std::mutex mutex;
+        size_t maxEntries = 0;
+        std::list<Key> lru; // front = most recently used
+        std::unordered_map<Key, Entry, KeyHasher> entries;
+
+        static Key MakeKey(IGNITE_ShaderPlatformType platform, IGNITE_ShaderType type, IGNITE_SPIRVReflectionBackend backend, const std::vector<uint8_t>& shaderCode)
+        {
+            constexpr uint64_t kCheckSeed = 0x9e3779b97f4a7c15ull;
+
+            Key key = {};
+            key.hash = HashBytes64(shaderCode.data(), shaderCode.size(), (uint64_t(backend) << 16) | (uint64_t(platform) << 8) | uint64_t(type));
+            key.check = HashBytes64(shaderCode.data(), shaderCode.size(), kCheckSeed);
+            key.size = shaderCode.size();
+            key.platform = platform;
+            key.type = type;
+            key.backend = backend;
+            return key;
+        }
 
-        D3D12_SHADER_DESC shaderDesc = {};
-        result = reflection->GetDesc(&shaderDesc);
-        if (FAILED(result))
+        // Failed reflections come back empty. They are not cached, so a later call retries them;
+        // a shader with no interface at all is cheap to reflect again.
+        static bool IsEmpty(const ShaderReflectionInfo& info)
         {
-            DispatchLog(IGNITE_LOG_TYPE_ERROR, "DXIL reflection failed while reading shader description. HRESULT=" + std::to_string(static_cast<uint32_t>(result)));
-            return info;
+            return info.uniformBuffers.empty() && info.sampledImages.empty() && info.storageImages.empty() && info.storageBuffers.empty()
+                && info.separateSamplers.empty() && info.separateImages.empty() && info.pushConstants.empty() && info.stageInputs.empty()
+                && info.stageOutputs.empty() && info.vertexAttributes.empty() && info.specializationConstants.empty()
+                && info.compute.localSize[0] == 0 && info.compute.localSize[1] == 0 && info.compute.localSize[2] == 0;
         }
 
-        DispatchLog(IGNITE_LOG_TYPE_INFO, std::string("DXIL reflection: ") + IGNITE_GetShaderTypeString(type));
+        // Caller holds the mutex.
+        const Entry* Find(const Key& key)
+        {
+            auto it = entries.find(key);
+            if (it == entries.end())
+            {
+                return nullptr;
+            }
 
-        info.uniformBuffers.reserve(shaderDesc.ConstantBuffers);
-        for (UINT i = 0; i < shaderDesc.ConstantBuffers; ++i)
+            lru.splice(lru.begin(), lru, it->second.lruPosition);
+            return &it->second;
+        }
+
+        // Caller holds the mutex. Returns the entry already cached under key, if another thread won the race.
+        Entry Insert(const Key& key, Entry entry)
         {
-            ID3D12ShaderReflectionConstantBuffer* cbuffer = reflection->GetConstantBufferByIndex(i);
-            if (!cbuffer)
+            auto it = entries.find(key);
+            if (it != entries.end())
             {
-                continue;
+                return it->second;
             }
 
-            D3D12_SHADER_BUFFER_DESC cbufferDesc = {};
-            if (FAILED(cbuffer->GetDesc(&cbufferDesc)))
+            if (maxEntries == 0)
             {
-                continue;
+                return entry;
             }
 
-            ShaderResourceInfo resource = {};
-            resource.name = cbufferDesc.Name ? cbufferDesc.Name : "";
-            resource.id = i;
+            while (entries.size() >= maxEntries)
+            {
+                entries.erase(lru.back());
+                lru.pop_back();
+            }
+
+            lru.push_front(key);
+            entry.lruPosition = lru.begin();
+            return entries.emplace(key, std::move(entry)).first->second;
+        }
+
+        template<typename ReflectFn>
+        std::shared_ptr<const ShaderReflectionInfo> Get(IGNITE_ShaderPlatformType platform, IGNITE_ShaderType type, IGNITE_SPIRVReflectionBackend backend,
+            const std::vector<uint8_t>& shaderCode, ReflectFn&& reflect)
+        {
+            const Key key = MakeKey(platform, type, backend, shaderCode);
 
-            for (UINT b = 0; b < shaderDesc.BoundResources; ++b)
             {
-                D3D12_SHADER_INPUT_BIND_DESC bindDesc = {};
-                if (SUCCEEDED(reflection->GetResourceBindingDesc(b, &bindDesc)) && bindDesc.Type == D3D_SIT_CBUFFER && bindDesc.Name && resource.name == bindDesc.Name)
+                std::lock_guard<std::mutex> lock(mutex);
+                if (const Entry* entry = Find(key))
                 {
-                    resource.binding = bindDesc.BindPoint;
-                    resource.set = bindDesc.Space;
-                    resource.count = bindDesc.BindCount;
-                    break;
+                    return entry->info;
                 }
             }
 
-            info.uniformBuffers.push_back(std::move(resource));
+            // Reflect outside the lock so concurrent misses on different blobs do not serialize.
+            Entry entry = {};
+            entry.info = std::make_shared<const ShaderReflectionInfo>(reflect());
+            if (IsEmpty(*entry.info))
+            {
+                return entry.info;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            return Insert(key, std::move(entry)).info;
         }
+    };
 
-        for (UINT i = 0; i < shaderDesc.BoundResources; ++i)
+    ShaderReflectionCache::ShaderReflectionCache(size_t maxEntries)
+        : m_impl(std::make_unique<Impl>())
+    {
+        m_impl->maxEntries = maxEntries;
+    }
+
+    ShaderReflectionCache::~ShaderReflectionCache() = default;
+
+    std::shared_ptr<const ShaderReflectionInfo> ShaderReflectionCache::GetSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
+    {
+        // Read the backend once so the entry is keyed by the backend that actually reflected it.
+        const IGNITE_SPIRVReflectionBackend backend = ShaderReflection::GetSPIRVReflectionBackend();
+        return m_impl->Get(IGNITE_SHADER_PLATFORM_TYPE_SPIRV, type, backend, shaderCode, [&] {
+            return ShaderReflection::SPIRVReflect(type, shaderCode, backend);
+        });
+    }
+
+    std::shared_ptr<const ShaderReflectionInfo> ShaderReflectionCache::GetDXIL(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode)
+    {
+        return m_impl->Get(IGNITE_SHADER_PLATFORM_TYPE_DXIL, type, IGNITE_SPIRV_REFLECTION_BACKEND_NATIVE, shaderCode, [&] {
+            return ShaderReflection::DXILReflect(type, shaderCode);
+        });
+    }
+
+    std::vector<std::shared_ptr<const CrossCompiledShader>> ShaderReflectionCache::GetCrossCompiled(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode,
+        const std::vector<CrossCompileOptions>& targets)
+    {
+        // The cross-compile parse reflects through SPIRV-Cross, so its reflection is only worth
+        // caching when that is the selected backend.
+        const bool spirvCrossReflection = ShaderReflection::GetSPIRVReflectionBackend() == IGNITE_SPIRV_REFLECTION_BACKEND_SPIRV_CROSS;
+        const Impl::Key reflectionKey = Impl::MakeKey(IGNITE_SHADER_PLATFORM_TYPE_SPIRV, type, IGNITE_SPIRV_REFLECTION_BACKEND_SPIRV_CROSS, shaderCode);
+        auto crossKey = [&](const CrossCompileOptions& options) {
+            Impl::Key key = reflectionKey;
+            key.crossCompiled = true;
+            key.crossOptions = options;
+            return key;
+        };
+
+        std::vector<std::shared_ptr<const CrossCompiledShader>> results(targets.size());
+        std::vector<CrossCompileOptions> missing;
+        std::vector<size_t> missingIndices;
+        bool reflect = false;
         {
-            D3D12_SHADER_INPUT_BIND_DESC bindDesc = {};
-            if (FAILED(reflection->GetResourceBindingDesc(i, &bindDesc)))
+            std::lock_guard<std::mutex> lock(m_impl->mutex);
+            for (size_t i = 0; i < targets.size(); ++i)
             {
-                continue;
+                if (const Impl::Entry* entry = m_impl->Find(crossKey(targets[i])))
+                {
+                    results[i] = entry->crossCompiled;
+                }
+                else
+                {
+                    missing.push_back(targets[i]);
+                    missingIndices.push_back(i);
+                }
             }
+            reflect = spirvCrossReflection && !missing.empty() && !m_impl->Find(reflectionKey);
+        }
 
-            ShaderResourceInfo resource = {};
-            resource.name = bindDesc.Name ? bindDesc.Name : "";
-            resource.id = i;
-            resource.binding = bindDesc.BindPoint;
-            resource.set = bindDesc.Space;
-            resource.count = bindDesc.BindCount;
+        if (missing.empty())
+        {
+            return results;
+        }
 
-            switch (bindDesc.Type)
+        // Compile outside the lock; the parse that serves the missing targets also reflects the blob.
+        ShaderReflectionInfo reflection = {};
+        std::vector<CrossCompiledShader> compiled;
+        const bool parsed = ShaderCompiler::CrossCompileSPIRV(type, shaderCode, missing, compiled, reflect ? &reflection : nullptr);
+
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        if (reflect && parsed && !Impl::IsEmpty(reflection))
+        {
+            Impl::Entry entry = {};
+            entry.info = std::make_shared<const ShaderReflectionInfo>(std::move(reflection));
+            m_impl->Insert(reflectionKey, std::move(entry));
+        }
+
+        for (size_t i = 0; i < missing.size(); ++i)
+        {
+            Impl::Entry entry = {};
+            if (i < compiled.size())
             {
-            case D3D_SIT_TEXTURE:
-                info.sampledImages.push_back(std::move(resource));
-                break;
-            case D3D_SIT_SAMPLER:
-                info.separateSamplers.push_back(std::move(resource));
-                break;
-            case D3D_SIT_UAV_RWTYPED:
-            case D3D_SIT_UAV_RWSTRUCTURED:
-            case D3D_SIT_UAV_RWBYTEADDRESS:
-            case D3D_SIT_UAV_APPEND_STRUCTURED:
-            case D3D_SIT_UAV_CONSUME_STRUCTURED:
-            case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
-            case D3D_SIT_UAV_FEEDBACKTEXTURE:
-                info.storageBuffers.push_back(std::move(resource));
-                break;
-            default:
-                break;
+                entry.crossCompiled = std::make_shared<const CrossCompiledShader>(std::move(compiled[i]));
+            }
+            else
+            {
+                CrossCompiledShader failed = {};
+                failed.options = missing[i];
+                entry.crossCompiled = std::make_shared<const CrossCompiledShader>(std::move(failed));
             }
+
+            results[missingIndices[i]] = *entry.crossCompiled ? m_impl->Insert(crossKey(missing[i]), std::move(entry)).crossCompiled : entry.crossCompiled;
         }
 
-        info.numUniformBuffers = info.uniformBuffers.size();
-        info.numSamplers = info.sampledImages.size();
-        info.numStorageTextures = info.storageImages.size();
-        info.numStorageBuffers = info.storageBuffers.size();
-        info.numSeparateSamplers = info.separateSamplers.size();
-        info.numSeparateImages = info.separateImages.size();
-        info.numPushConstants = info.pushConstants.size();
+        return results;
+    }
 
-        struct InputAttribute
+    std::shared_ptr<const CrossCompiledShader> ShaderReflectionCache::GetCrossCompiled(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode,
+        const CrossCompileOptions& options)
+    {
+        return GetCrossCompiled(type, shaderCode, std::vector<CrossCompileOptions>{ options }).front();
+    }
+
+    void ShaderReflectionCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        m_impl->entries.clear();
+        m_impl->lru.clear();
+    }
+
+    size_t ShaderReflectionCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        return m_impl->entries.size();
+    }
+
+    struct ShaderLibraryCache::Impl
+    {
+        using Module = std::shared_ptr<const std::vector<uint8_t>>;
+
+        // The library file as an entry saw it. The source is compared only when the timestamp or
+        // size changed, so hits do not read the file.
+        struct SourceStamp
         {
-            UINT registerIndex;
-            std::string semanticName;
-            UINT semanticIndex;
-            UINT mask;
-            D3D_REGISTER_COMPONENT_TYPE componentType;
+            std::filesystem::file_time_type writeTime = {};
+            uintmax_t size = 0;
+            bool valid = false;
+
+            bool operator==(const SourceStamp& other) const { return valid && other.valid && writeTime == other.writeTime && size == other.size; }
         };
 
-        std::vector<InputAttribute> inputs;
-        if (type == IGNITE_SHADER_TYPE_VERTEX)
+        struct Entry
         {
-            inputs.reserve(shaderDesc.InputParameters);
-        }
+            std::shared_future<Module> module;
+            std::list<std::string>::iterator lruPosition;
+            SourceStamp stamp;
+            std::string source;
+            uint64_t generation = 0; // tells a failed compile's entry from a newer one under the same key
+        };
 
-        for (UINT i = 0; i < shaderDesc.InputParameters; ++i)
+        mutable std::mutex mutex;
+        size_t maxEntries = 0;
+        uint64_t nextGeneration = 0;
+        std::list<std::string> lru; // front = most recently used
+        std::unordered_map<std::string, Entry> entries;
+
+        // Serializes the library path with every option that changes its code, which includes
+        // everything CompileDXC turns into a compiler argument. The whole string is the key, so
+        // different libraries or options never share an entry.
+        static std::string MakeKey(const CompilerOptions& options)
         {
-            D3D12_SIGNATURE_PARAMETER_DESC paramDesc = {};
-            if (FAILED(reflection->GetInputParameterDesc(i, &paramDesc)))
+            std::string key = options.filepath.generic_string();
+            auto append = [&key](char tag, const std::string& value) {
+                key += '\n';
+                key += tag;
+                key += value;
+            };
+
+            for (const std::string& define : options.defines)
             {
-                continue;
+                append('D', define);
             }
-
-            ShaderStageIOInfo stageInput = {};
-            stageInput.name = paramDesc.SemanticName ? paramDesc.SemanticName : "";
-            if (paramDesc.SemanticIndex > 0)
+            for (const std::filesystem::path& path : options.includeDirectories)
             {
-                stageInput.name += std::to_string(paramDesc.SemanticIndex);
+                append('I', path.generic_string());
             }
-            stageInput.id = i;
-            stageInput.location = paramDesc.Register;
-            stageInput.columns = 1;
-
-            UINT mask = paramDesc.Mask;
-            uint32_t elementCount = 0;
-            while (mask != 0)
+            for (const std::filesystem::path& path : options.relaxedIncludes)
             {
-                elementCount += (mask & 1u) ? 1u : 0u;
-                mask >>= 1;
+                append('R', path.generic_string());
             }
-            stageInput.vecSize = (elementCount > 0) ? elementCount : 1u;
-            stageInput.format = IGNITE_Map3DComponent(paramDesc.ComponentType, stageInput.vecSize);
-            info.stageInputs.push_back(stageInput);
-
-            if (type == IGNITE_SHADER_TYPE_VERTEX)
+            for (const std::string& extension : options.spirvExtensions)
             {
-                inputs.push_back({ paramDesc.Register, paramDesc.SemanticName ? paramDesc.SemanticName : "", paramDesc.SemanticIndex, paramDesc.Mask, paramDesc.ComponentType });
+                append('X', extension);
             }
-        }
-
-        for (UINT i = 0; i < shaderDesc.OutputParameters; ++i)
-        {
-            D3D12_SIGNATURE_PARAMETER_DESC paramDesc = {};
-            if (FAILED(reflection->GetOutputParameterDesc(i, &paramDesc)))
+            for (const std::string& option : options.compilerOptions)
             {
-                continue;
+                append('O', option);
+            }
+            for (const std::string& pass : options.spirvOptimizerPasses)
+            {
+                append('P', pass);
             }
+            append('M', options.shaderDesc.shaderModel);
+            append('V', options.shaderDesc.vulkanVersion);
+            append('L', options.shaderDesc.vulkanMemoryLayout);
+
+            const uint32_t settings[] = {
+                uint32_t(options.compilerType), uint32_t(options.platformType), uint32_t(options.shaderDesc.optLevel), uint32_t(options.spirvOptimizer),
+                options.tRegShift, options.sRegShift, options.bRegShift, options.uRegShift,
+                uint32_t(options.matrixRowMajor) | uint32_t(options.hlsl2021) << 1 | uint32_t(options.warningsAreErrors) << 2
+                    | uint32_t(options.allResourcesBound) << 3 | uint32_t(options.noRegShifts) << 4 | uint32_t(options.embedPdb) << 5
+                    | uint32_t(options.stripReflection) << 6
+            };
+            for (uint32_t setting : settings)
+            {
+                append('S', std::to_string(setting));
+            }
+            return key;
+        }
 
-            ShaderStageIOInfo stageOutput = {};
-            stageOutput.name = paramDesc.SemanticName ? paramDesc.SemanticName : "";
-            if (paramDesc.SemanticIndex > 0)
+        static SourceStamp ReadStamp(const std::filesystem::path& path)
+        {
+            std::error_code error;
+            SourceStamp stamp;
+            stamp.writeTime = std::filesystem::last_write_time(path, error);
+            if (!error)
             {
-                stageOutput.name += std::to_string(paramDesc.SemanticIndex);
+                stamp.size = std::filesystem::file_size(path, error);
             }
-            stageOutput.id = i;
-            stageOutput.location = paramDesc.Register;
-            stageOutput.columns = 1;
+            stamp.valid = !error;
+            return stamp;
+        }
 
-            UINT mask = paramDesc.Mask;
-            uint32_t elementCount = 0;
-            while (mask != 0)
+        // Caller holds the mutex.
+        void Erase(const std::string& key, uint64_t generation)
+        {
+            auto it = entries.find(key);
+            if (it != entries.end() && it->second.generation == generation)
             {
-                elementCount += (mask & 1u) ? 1u : 0u;
-                mask >>= 1;
+                lru.erase(it->second.lruPosition);
+                entries.erase(it);
             }
-            stageOutput.vecSize = (elementCount > 0) ? elementCount : 1u;
-            stageOutput.format = IGNITE_Map3DComponent(paramDesc.ComponentType, stageOutput.vecSize);
-            info.stageOutputs.push_back(stageOutput);
         }
+    };
 
-        std::sort(info.stageInputs.begin(), info.stageInputs.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
-            return a.location < b.location;
-        });
-        std::sort(info.stageOutputs.begin(), info.stageOutputs.end(), [](const ShaderStageIOInfo& a, const ShaderStageIOInfo& b) {
-            return a.location < b.location;
-        });
+    ShaderLibraryCache::ShaderLibraryCache(size_t maxEntries)
+        : m_impl(std::make_unique<Impl>())
+    {
+        m_impl->maxEntries = maxEntries;
+    }
 
-        info.numStageInputs = info.stageInputs.size();
-        info.numStageOutputs = info.stageOutputs.size();
+    ShaderLibraryCache::~ShaderLibraryCache() = default;
 
-        if (type == IGNITE_SHADER_TYPE_VERTEX && !inputs.empty())
+    std::shared_ptr<const std::vector<uint8_t>> ShaderLibraryCache::GetLibrary(const CompilerOptions& options, std::shared_ptr<DXCInstance> instance)
+    {
+        const std::string key = Impl::MakeKey(options);
+        const Impl::SourceStamp stamp = Impl::ReadStamp(options.filepath);
+
+        // The source is read outside the lock, and only when the stamp cannot settle a hit or an
+        // entry is about to be created; the lookup then runs again.
+        std::string source;
+        bool haveSource = false;
+        std::promise<Impl::Module> promise;
+        uint64_t generation = 0;
+        for (;;)
         {
-            std::sort(inputs.begin(), inputs.end(), [](const InputAttribute& a, const InputAttribute& b) {
-                return a.registerIndex < b.registerIndex;
-            });
-
-            auto countMask = [](UINT mask)
+            std::unique_lock<std::mutex> lock(m_impl->mutex);
+            auto it = m_impl->entries.find(key);
+            if (it != m_impl->entries.end() && !(it->second.stamp == stamp))
             {
-                uint32_t count = 0;
-                while (mask != 0)
+                if (!haveSource)
                 {
-                    count += (mask & 0x1u) ? 1u : 0u;
-                    mask >>= 1;
+                    lock.unlock();
+                    source = ReadTextFile(options.filepath);
+                    haveSource = true;
+                    continue;
                 }
-                return (count > 0) ? count : 1u;
-            };
 
-            uint32_t offset = 0;
-            for (const auto& input : inputs)
-            {
-                const uint32_t elementCount = countMask(input.mask);
-                const IGNITE_VertexElementFormat elementFormat = IGNITE_Map3DComponent(input.componentType, elementCount);
-                if (elementFormat == IGNITE_VERTEX_ELEMENT_FORMAT_INVALID)
+                // The file was touched; it is the same library only if its contents are unchanged.
+                if (it->second.source == source)
                 {
-                    DispatchLog(IGNITE_LOG_TYPE_WARNING, "DXIL reflection: unsupported vertex input format for semantic " + input.semanticName);
-                    continue;
+                    it->second.stamp = stamp;
                 }
-
-                std::string name = input.semanticName;
-                if (input.semanticIndex > 0)
+                else
                 {
-                    name += std::to_string(input.semanticIndex);
+                    m_impl->Erase(key, it->second.generation);
+                    it = m_impl->entries.end();
                 }
+            }
 
-                VertexAttribute attribute = {};
-                attribute.name = name;
-                attribute.format = elementFormat;
-                attribute.offset = offset;
-                attribute.bufferIndex = 0;
+            if (it != m_impl->entries.end())
+            {
+                m_impl->lru.splice(m_impl->lru.begin(), m_impl->lru, it->second.lruPosition);
+                std::shared_future<Impl::Module> module = it->second.module;
+                lock.unlock();
 
-                const uint32_t componentSize = 4;
-                const uint32_t attributeSize = componentSize * elementCount;
-                offset += attributeSize;
-                info.vertexAttributes.push_back(std::move(attribute));
+                // Waits while another thread compiles the same library.
+                return module.get();
             }
 
-            const uint32_t stride = offset;
-            for (auto& attribute : info.vertexAttributes)
+            if (m_impl->maxEntries > 0)
             {
-                attribute.elementStride = stride;
+                if (!haveSource)
+                {
+                    lock.unlock();
+                    source = ReadTextFile(options.filepath);
+                    haveSource = true;
+                    continue;
+                }
+
+                while (m_impl->entries.size() >= m_impl->maxEntries)
+                {
+                    m_impl->entries.erase(m_impl->lru.back());
+                    m_impl->lru.pop_back();
+                }
+
+                generation = ++m_impl->nextGeneration;
+                m_impl->lru.push_front(key);
+                m_impl->entries.emplace(key, Impl::Entry{ promise.get_future().share(), m_impl->lru.begin(), stamp, std::move(source), generation });
             }
+            break;
         }
 
-        DispatchLog(IGNITE_LOG_TYPE_INFO, "DXIL reflection complete: " + std::string(IGNITE_GetShaderTypeString(type))
-            + " | UBO=" + std::to_string(info.numUniformBuffers)
-            + " Sampled=" + std::to_string(info.numSamplers)
-            + " StorageBuf=" + std::to_string(info.numStorageBuffers)
-            + " Inputs=" + std::to_string(info.numStageInputs)
-            + " Outputs=" + std::to_string(info.numStageOutputs));
-#else
-        DispatchLog(IGNITE_LOG_TYPE_WARNING, "DXIL reflection is only available on Windows platform");
-#endif
+        // Compile outside the lock; concurrent requests for this library wait on the entry's future.
+        Impl::Module module;
+        try
+        {
+            module = std::make_shared<const std::vector<uint8_t>>(ShaderCompiler::CompileLibrary(options, std::move(instance)));
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(m_impl->mutex);
+            m_impl->Erase(key, generation);
+            throw;
+        }
 
-        return info;
+        promise.set_value(module);
+        if (module->empty())
+        {
+            // Waiters still see the failure, but the next request compiles again.
+            std::lock_guard<std::mutex> lock(m_impl->mutex);
+            m_impl->Erase(key, generation);
+        }
+        return module;
     }
 
+    void ShaderLibraryCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        m_impl->entries.clear();
+        m_impl->lru.clear();
+    }
 
-}
\ No newline at end of file
+    size_t ShaderLibraryCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        return m_impl->entries.size();
+    }
+}
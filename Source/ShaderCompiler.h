@@ -54,6 +54,52 @@ namespace ignite
         uint32_t elementStride = 0;
     };
 
+    // One vertex buffer of the reflected input layout.
+    struct VertexBufferLayout
+    {
+        uint32_t bufferIndex = 0;
+        uint32_t stride = 0; // computed from the attributes; ignored in VertexStreamMap::buffers
+        IGNITE_VertexInputRate inputRate = IGNITE_VERTEX_INPUT_RATE_VERTEX;
+        uint32_t stepRate = 1; // instances per element for per-instance buffers
+    };
+
+    // Places the vertex attribute with this name (GLSL variable or HLSL semantic plus index) in a buffer.
+    struct VertexStreamAssignment
+    {
+        std::string attribute;
+        uint32_t bufferIndex = 0;
+    };
+
+    // Explicit split of vertex inputs into buffers. Unlisted attributes go to buffer 0 and
+    // unlisted buffers advance per vertex. Without a map, reflection applies the naming
+    // convention instead: attributes whose name contains "instance" (any case) read
+    // per-instance data from buffer 1, all others per-vertex data from buffer 0.
+    struct VertexStreamMap
+    {
+        std::vector<VertexStreamAssignment> assignments;
+        std::vector<VertexBufferLayout> buffers;
+
+        bool empty() const { return assignments.empty() && buffers.empty(); }
+    };
+
+    // One member of a buffer block, flattened depth-first: a struct member is followed by its
+    // own members with dotted names ("light.color"). Offsets are absolute within the block and
+    // address the first element of every enclosing array.
+    struct ShaderBufferMember
+    {
+        std::string name;
+        IGNITE_ShaderDataType type = IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+        uint32_t offset = 0;
+        uint32_t size = 0; // declared size including array elements, 0 for runtime arrays
+        uint32_t vecSize = 1; // rows for matrices
+        uint32_t columns = 1;
+        uint32_t arraySize = 0; // outermost array length; 0 if not an array or runtime-sized (arrayStride != 0)
+        uint32_t arrayStride = 0;
+        uint32_t matrixStride = 0;
+        uint32_t depth = 0; // 0 for direct block members
+        bool rowMajor = false;
+    };
+
     // Generic descriptor-like resource information from reflection output.
     struct ShaderResourceInfo
     {
@@ -61,7 +107,10 @@ namespace ignite
         uint32_t id = 0;
         uint32_t set = 0;
         uint32_t binding = 0;
-        uint32_t count = 1;
+        uint32_t count = 1; // product of array dimensions; 0 when unbounded
+        bool unbounded = false; // runtime-sized descriptor array (descriptor indexing / unbounded register range)
+        uint32_t size = 0; // declared block size, uniform/storage buffers only
+        std::vector<ShaderBufferMember> members; // uniform/storage buffers only
     };
 
     // Stage input/output metadata (location/format/vector width).
@@ -70,16 +119,94 @@ namespace ignite
         std::string name;
         uint32_t id = 0;
         uint32_t location = 0;
+        uint32_t component = 0; // first component within the location (SPIR-V Component, DXIL register mask)
         IGNITE_VertexElementFormat format = IGNITE_VERTEX_ELEMENT_FORMAT_INVALID;
         uint32_t vecSize = 0;
         uint32_t columns = 0;
     };
 
-    // Push constant metadata (name/size) extracted from shader bytecode.
+    // Push constant metadata (name/size/member layout) extracted from shader bytecode.
     struct ShaderPushConstantInfo
     {
         std::string name;
         uint32_t size = 0;
+        std::vector<ShaderBufferMember> members;
+    };
+
+    // Scalar specialization constant (OpSpecConstant* decorated with SpecId).
+    struct ShaderSpecializationConstant
+    {
+        std::string name;
+        uint32_t id = 0; // result id in the module
+        uint32_t constantId = 0; // SpecId, as used by VkSpecializationMapEntry::constantID
+        IGNITE_ShaderDataType type = IGNITE_SHADER_DATA_TYPE_UNKNOWN;
+        uint64_t defaultValue = 0; // raw bits of the default; booleans are 0/1
+    };
+
+    // Compute dispatch metadata; left zeroed for other stages.
+    struct ShaderComputeInfo
+    {
+        uint32_t localSize[3] = {}; // workgroup size; the default values where specializable
+        bool localSizeSpecialized[3] = {}; // dimension comes from a specialization constant (SPIR-V)
+        uint32_t localSizeSpecIds[3] = {}; // SpecId per specialized dimension
+        uint32_t sharedMemorySize = 0; // bytes of Workgroup variables, std430-sized; not reported for DXIL
+    };
+
+    // Value to bake into a specialization constant, given as raw bits of the constant's type.
+    struct SpecializationConstantValue
+    {
+        uint32_t constantId = 0;
+        uint64_t value = 0;
+    };
+
+    // Time and module size of one spirv-opt pass.
+    struct SPIRVOptimizerPassStats
+    {
+        std::string pass; // spirv-opt flag
+        double milliseconds = 0.0;
+        size_t sizeBefore = 0; // bytes
+        size_t sizeAfter = 0;
+    };
+
+    // Outcome of the SPIR-V optimizer stage. passes is filled only when stats were requested: one entry
+    // per custom pass, or a single entry named after the flag of a built-in recipe ("-O", "-Os", ...).
+    struct SPIRVOptimizerReport
+    {
+        IGNITE_SPIRVOptimizerRecipe recipe = IGNITE_SPIRV_OPTIMIZER_RECIPE_NONE;
+        double milliseconds = 0.0;
+        size_t sizeBefore = 0;
+        size_t sizeAfter = 0;
+        std::vector<SPIRVOptimizerPassStats> passes;
+    };
+
+    // Per-target options for SPIR-V cross-compilation. Options of other targets are ignored.
+    struct CrossCompileOptions
+    {
+        IGNITE_CrossCompileTarget target = IGNITE_CROSS_COMPILE_TARGET_GLSL;
+        uint32_t version = 0; // GLSL/ESSL #version (450, 310, ...), HLSL shader model (50, 60, ...), MSL major * 10000 + minor * 100; 0 = default
+        bool vulkanSemantics = false; // GLSL: emit Vulkan GLSL (set/binding, push constants, separate samplers)
+        bool plainUniforms = false; // GLSL/ESSL: emit uniform buffers as plain uniforms (GL ES 2 / WebGL 1 style)
+        bool fixupClipSpace = false; // convert clip-space depth from [0, w] to [-w, w] (GL targets)
+        bool flipVertexY = false; // negate gl_Position.y in vertex-like stages
+        bool mslIOS = false; // MSL: target iOS instead of macOS
+        bool mslArgumentBuffers = false; // MSL: put each descriptor set in an argument buffer
+
+        bool operator==(const CrossCompileOptions& other) const
+        {
+            return target == other.target && version == other.version && vulkanSemantics == other.vulkanSemantics
+                && plainUniforms == other.plainUniforms && fixupClipSpace == other.fixupClipSpace && flipVertexY == other.flipVertexY
+                && mslIOS == other.mslIOS && mslArgumentBuffers == other.mslArgumentBuffers;
+        }
+    };
+
+    // Source emitted for one cross-compile target. source is empty when the target failed.
+    struct CrossCompiledShader
+    {
+        CrossCompileOptions options;
+        std::string source;
+        std::string entryPoint; // entry point name in source; MSL renames "main" to "main0"
+
+        explicit operator bool() const { return !source.empty(); }
     };
 
     // Unified reflection model returned by both SPIR-V and DXIL reflection paths.
@@ -96,6 +223,7 @@ namespace ignite
         size_t numPushConstants = 0;
         size_t numStageInputs = 0;
         size_t numStageOutputs = 0;
+        size_t numSpecializationConstants = 0;
 
         std::vector<ShaderResourceInfo> uniformBuffers;
         std::vector<ShaderResourceInfo> sampledImages;
@@ -107,6 +235,28 @@ namespace ignite
         std::vector<ShaderStageIOInfo> stageInputs;
         std::vector<ShaderStageIOInfo> stageOutputs;
         std::vector<VertexAttribute> vertexAttributes;
+        std::vector<VertexBufferLayout> vertexBuffers; // one per buffer used by vertexAttributes, sorted by bufferIndex
+        std::vector<ShaderSpecializationConstant> specializationConstants; // sorted by constantId, SPIR-V only
+        ShaderComputeInfo compute;
+    };
+
+    // How a shader's interface changed between two reflections (ShaderReflection::Diff).
+    struct ShaderReflectionDiff
+    {
+        uint32_t changes = IGNITE_REFLECTION_CHANGE_NONE; // IGNITE_ReflectionChangeFlags
+        std::vector<std::string> details; // one line per difference
+
+        bool IsIdentical() const { return changes == IGNITE_REFLECTION_CHANGE_NONE; }
+
+        // Same interface, new bytecode: swap the module, keep layouts and descriptor sets.
+        bool IsCodeOnly() const { return changes == IGNITE_REFLECTION_CHANGE_CODE; }
+
+        // Descriptor set layouts and push constant ranges can be reused (bindings, types, counts and push constants unchanged).
+        bool KeepsPipelineLayout() const
+        {
+            return (changes & (IGNITE_REFLECTION_CHANGE_BINDING_ADDED | IGNITE_REFLECTION_CHANGE_BINDING_REMOVED | IGNITE_REFLECTION_CHANGE_BINDING_TYPE
+                | IGNITE_REFLECTION_CHANGE_PUSH_CONSTANTS | IGNITE_REFLECTION_CHANGE_SHADER_TYPE)) == 0;
+        }
     };
 
 #ifdef _WIN32
@@ -177,6 +327,9 @@ namespace ignite
         return uint32_t(hash) ^ (uint32_t(hash >> 32));
     }
 
+    // Fast 64-bit content hash used for archive keys and blob caches.
+    IGNITECOMPILER_API uint64_t HashBytes64(const void* data, size_t size, uint64_t seed = 0);
+
     // Converts a filesystem path to normalized preferred string representation.
     static std::string PathToString(std::filesystem::path path)
     {
@@ -219,6 +372,9 @@ namespace ignite
         IGNITE_OptimizationLevel optLevel = IGNITE_OPT_LEVEL_3;
     };
 
+    class ShaderOutputQueue;
+    class ShaderLibraryCache;
+
     // Full compiler configuration for a single compile operation.
     struct CompilerOptions
     {
@@ -251,6 +407,21 @@ namespace ignite
         bool header = false;
         bool binaryBlob = true;
         bool headerBlob = false;
+        bool headerWords = false; // emit headers as 32-bit words (alignas(4) const uint32_t[]) when the blob size allows it
+        bool headerEmbed = false; // emit a #embed/.incbin stub header (plus ".S" file) referencing the binary instead of literals; the .S needs GCC or Clang
+        bool reflectionBinary = false; // CompileAndReflect also writes the encoded reflection next to the binary (".refl")
+        bool layoutHeader = false; // CompileAndReflect also writes C++ structs for its buffer layouts (".layout.h")
+        VertexStreamMap vertexStreams; // CompileAndReflect lays out vertex inputs with this map when it is not empty
+        IGNITE_SPIRVOptimizerRecipe spirvOptimizer = IGNITE_SPIRV_OPTIMIZER_RECIPE_DEFAULT; // pass pipeline run on SPIR-V output
+        std::vector<std::string> spirvOptimizerPasses; // spirv-opt flags for IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM
+        SPIRVOptimizerReport* optimizerReport = nullptr; // optional: receives the optimizer stage's per-pass stats
+        bool remapIds = false; // SPIR-V: canonical ids and declaration/function order, so similar variants compress together
+        bool stripDebugInfo = false; // SPIR-V: drop names, source, line and NonSemantic debug info after optimization
+        bool debugSidecar = false; // with stripDebugInfo, also write the removed debug info next to the binary (".spvdbg")
+        bool spirvLibrary = false; // SPIR-V: compile a library module (lib_<shaderModel> profile, no entry point) whose exported functions keep their LinkageAttributes
+        std::vector<std::filesystem::path> spirvLibraries; // SPIR-V: library sources linked into the output before the optimizer stage; the shader then compiles with the lib profile and names its entry point with [shader("<stage>")]
+        ShaderLibraryCache* libraryCache = nullptr; // optional: spirvLibraries are compiled once through this cache
+        std::vector<CrossCompileOptions> crossCompileTargets; // SPIR-V: CompileAndReflect also emits these sources (".glsl", ".essl", ".hlsl", ".metal"; ".<version>.glsl" when a target repeats)
         bool continueOnError = false;
         bool warningsAreErrors = false;
         bool allResourcesBound = false;
@@ -265,27 +436,82 @@ namespace ignite
         bool slangHlsl = false;
         bool noRegShifts = false;
         int retryCount = 10; // default 10 retries for compilation task sub-process failures
+
+        ShaderOutputQueue* outputQueue = nullptr; // optional: hand outputs to a background writer instead of writing inline
     };
 
     // Helper for writing text or binary shader outputs to disk.
+    // Output is staged in a large buffer and written in chunks; text output is
+    // produced from precomputed digit tables instead of per-byte fprintf calls.
     class DataOutputContext
     {
     public:
         FILE* stream = nullptr;
 
         DataOutputContext(const char* file, bool textMode);
+        DataOutputContext(); // in-memory target, see TakeData()
         ~DataOutputContext();
+        bool IsOpen() const { return stream != nullptr || m_inMemory; }
         bool WriteDataAsText(const void* data, size_t size);
-        void WriteTextPreamble(const char* shaderName, const std::string& combinedDefines);
+        bool WriteDataAsWords(const void* data, size_t size);
+        void WriteTextPreamble(const char* shaderName, const std::string& combinedDefines, bool words = false);
         void WriteTextEpilog();
         bool WriteDataAsBinary(const void* data, size_t size);
+        bool Flush();
+        std::vector<uint8_t> TakeData();
         static bool WriteDataAsTextCallback(const void* data, size_t size, void* context);
+        static bool WriteDataAsWordsCallback(const void* data, size_t size, void* context);
         static bool WriteDataAsBinaryCallback(const void* data, size_t size, void* context);
 
     private:
+        char* Reserve(size_t size);
+        bool Append(const char* data, size_t size);
+
+        static constexpr size_t kBufferCapacity = 1u << 20;
+
+        std::unique_ptr<char[]> m_buffer;
+        size_t m_bufferCapacity = kBufferCapacity;
+        size_t m_bufferUsed = 0;
+        bool m_inMemory = false;
+        bool m_failed = false;
         uint32_t m_lineLength = 129;
     };
 
+    // Bounded background writer for compiled outputs. Compile workers hand over
+    // finished files and continue; a dedicated I/O thread drains the queue in
+    // batches, dropping writes superseded by a newer write to the same path.
+    class IGNITECOMPILER_API ShaderOutputQueue
+    {
+    public:
+        explicit ShaderOutputQueue(size_t maxPendingBytes = size_t(64) << 20);
+        ~ShaderOutputQueue(); // flushes and joins the I/O thread
+
+        ShaderOutputQueue(const ShaderOutputQueue&) = delete;
+        ShaderOutputQueue& operator=(const ShaderOutputQueue&) = delete;
+
+        // Queues a file write; blocks while the pending bytes exceed the budget.
+        void Enqueue(std::string path, std::vector<uint8_t> data, bool textMode = false);
+
+        // Waits until every write queued before the call has completed. Returns false if a
+        // write failed that no earlier Flush covered; concurrent calls split the writes, so
+        // each failure is reported by one of them.
+        bool Flush();
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+
+    // Compiled blob together with its reflection.
+    struct CompiledShader
+    {
+        std::vector<uint8_t> code;
+        ShaderReflectionInfo reflection;
+        std::vector<CrossCompiledShader> crossCompiled; // one per CompilerOptions::crossCompileTargets entry
+
+        explicit operator bool() const { return !code.empty(); }
+    };
+
     class IGNITECOMPILER_API ShaderCompiler
     {
     public:
@@ -298,15 +524,69 @@ namespace ignite
         // Creates DXC toolchain instance (Windows).
         static std::shared_ptr<DXCInstance> CreateDXCCompiler();
 
-        // Compiles HLSL source using DXC for DXIL/SPIR-V targets.
-        static std::vector<uint8_t> CompileDXC(std::shared_ptr<DXCInstance> instance, const CompilerOptions &options);
+        // Compiles HLSL source using DXC for DXIL/SPIR-V targets. With stripDebugInfo, debugModule
+        // receives the SPIR-V as it was before stripping.
+        static std::vector<uint8_t> CompileDXC(std::shared_ptr<DXCInstance> instance, const CompilerOptions &options, std::vector<uint8_t>* debugModule = nullptr);
 
-        // Compiles GLSL source to SPIR-V using shaderc.
-        static std::vector<uint8_t> CompileGLSL(const CompilerOptions &options);
+        // Compiles GLSL source to SPIR-V using shaderc. debugModule as for CompileDXC.
+        static std::vector<uint8_t> CompileGLSL(const CompilerOptions &options, std::vector<uint8_t>* debugModule = nullptr);
 
         // Writes compiled output bytes to disk according to options.
         static void DumpShader(const CompilerOptions &options, std::vector<uint8_t> &shaderCode, const std::string &outputPath);
 
+        // Compiles according to options (GLSL via shaderc, HLSL via DXC) and reflects the
+        // in-memory result. A null DXC instance is created on demand for HLSL input.
+        static CompiledShader CompileAndReflect(const CompilerOptions &options, std::shared_ptr<DXCInstance> instance = nullptr);
+
+        // Bakes specialization constant values into a SPIR-V blob: the constants become plain
+        // constants, dependent OpSpecConstantOp expressions are folded and, if optimize is set,
+        // the performance passes run over the result. Constants without a value keep their
+        // default. Returns an empty vector on failure.
+        static std::vector<uint8_t> SpecializeSPIRV(const std::vector<uint8_t>& spirv, const std::vector<SpecializationConstantValue>& values, bool optimize = true);
+
+        // Runs a spirv-opt recipe in process (DEFAULT means PERFORMANCE here; CUSTOM runs customPasses).
+        // Built-in recipes use the pass lists the linked SPIRV-Tools registers. With a report, custom
+        // passes run one at a time so each gets its own time and size delta. Returns an empty vector
+        // if a pass fails or a custom flag is unknown.
+        static std::vector<uint8_t> OptimizeSPIRV(const std::vector<uint8_t>& spirv, IGNITE_SPIRVOptimizerRecipe recipe,
+            const std::vector<std::string>& customPasses = {}, SPIRVOptimizerReport* report = nullptr);
+
+        // Canonicalizes a SPIR-V module for compression and deduplication, like spirv-remap: ids are
+        // renumbered from content hashes (spirv-opt --canonicalize-ids; --compact-ids where the
+        // linked SPIRV-Tools lacks it), then functions, types, constants and global variables are
+        // put in an order that depends only on their content. Returns an empty vector on failure.
+        static std::vector<uint8_t> RemapSPIRV(const std::vector<uint8_t>& spirv);
+
+        // Removes names, source text, line info and NonSemantic debug info from a SPIR-V module.
+        // Ids are kept, so the stripped module lines up with the original. If sidecar is set, it
+        // receives the original module behind a small header holding HashBytes64 of the stripped
+        // one. Returns an empty vector on a malformed module.
+        static std::vector<uint8_t> StripSPIRVDebugInfo(const std::vector<uint8_t>& spirv, std::vector<uint8_t>* sidecar = nullptr);
+
+        // Returns the original module stored in a debug sidecar, or an empty vector if the sidecar is
+        // malformed or was written for a different module.
+        static std::vector<uint8_t> ReadSPIRVDebugSidecar(const std::vector<uint8_t>& spirv, const std::vector<uint8_t>& sidecar);
+
+        // Compiles options.filepath into a SPIR-V library module (spirvLibrary is implied). Returns an
+        // empty vector on failure or for GLSL, whose front end emits no linkage attributes.
+        static std::vector<uint8_t> CompileLibrary(const CompilerOptions& options, std::shared_ptr<DXCInstance> instance = nullptr);
+
+        // Links SPIR-V modules in process, like spirv-link: every Import LinkageAttributes declaration
+        // is resolved against the Export of the same name and type, and duplicate types are folded.
+        // Unless createLibrary is set, unresolved imports are errors, linkage decorations are removed
+        // and functions no entry point reaches are dropped. The result is not optimized; OptimizeSPIRV
+        // inlines the library calls. Returns an empty vector on failure.
+        static std::vector<uint8_t> LinkSPIRV(const std::vector<std::vector<uint8_t>>& modules, bool createLibrary = false);
+
+        // Emits GLSL, ESSL, HLSL or MSL from a SPIR-V blob with SPIRV-Cross. The blob is parsed once
+        // and every target, plus the reflection if requested, is built from that parsed IR; the
+        // reflection then always comes from the SPIRV-Cross backend. Fills one result per target;
+        // returns false, with no results, only when the blob cannot be parsed, so a call with no
+        // targets that just reflects still succeeds.
+        static bool CrossCompileSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& spirv, const std::vector<CrossCompileOptions>& targets,
+            std::vector<CrossCompiledShader>& outResults, ShaderReflectionInfo* reflection = nullptr);
+        static CrossCompiledShader CrossCompileSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& spirv, const CrossCompileOptions& options);
+
         // Returns project version string.
         static const char* GetVersion();
     };
@@ -315,11 +595,98 @@ namespace ignite
     class IGNITECOMPILER_API ShaderReflection
     {
     public:
-        // Reflects SPIR-V binary into ShaderReflectionInfo.
+        // Reflects SPIR-V binary into ShaderReflectionInfo using the default backend.
         static ShaderReflectionInfo SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t> &shaderCode);
 
+        // Reflects SPIR-V with an explicit backend. The native parser falls back
+        // to SPIRV-Cross for modules it does not handle.
+        static ShaderReflectionInfo SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode, IGNITE_SPIRVReflectionBackend backend);
+
+        // Reflects SPIR-V words directly, skipping the byte-size alignment check.
+        static ShaderReflectionInfo SPIRVReflect(IGNITE_ShaderType type, const uint32_t* words, size_t wordCount);
+        static ShaderReflectionInfo SPIRVReflect(IGNITE_ShaderType type, const uint32_t* words, size_t wordCount, IGNITE_SPIRVReflectionBackend backend);
+
+        // Reflects a stripped module with the names from its debug sidecar. Without a matching
+        // sidecar the stripped module is reflected as is, and its names stay empty.
+        static ShaderReflectionInfo SPIRVReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode, const std::vector<uint8_t>& debugSidecar);
+
+        // Selects the backend used by SPIRVReflect (native by default).
+        static void SetSPIRVReflectionBackend(IGNITE_SPIRVReflectionBackend backend);
+        static IGNITE_SPIRVReflectionBackend GetSPIRVReflectionBackend();
+
         // Reflects DXIL binary into ShaderReflectionInfo.
         static ShaderReflectionInfo DXILReflect(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode);
+
+        // Reassigns info.vertexAttributes to buffers with an explicit map and recomputes
+        // offsets, strides and info.vertexBuffers.
+        static void AssignVertexStreams(ShaderReflectionInfo& info, const VertexStreamMap& map);
+
+        // Classifies how the interface of a recompiled shader differs from the previous reflection.
+        // Result ids are ignored, since they change with unrelated code edits.
+        static ShaderReflectionDiff Diff(const ShaderReflectionInfo& oldInfo, const ShaderReflectionInfo& newInfo);
+
+        // Same, plus IGNITE_REFLECTION_CHANGE_CODE when the blobs differ.
+        static ShaderReflectionDiff Diff(const CompiledShader& oldShader, const CompiledShader& newShader);
+    };
+
+    // Thread-safe, size-bounded (LRU) cache of reflection and cross-compile results keyed by two
+    // hashes and the size of the blob, plus the selected SPIR-V reflection backend. Repeat
+    // reflections of the same bytes become lookups. Failed (empty) reflections are not cached.
+    class IGNITECOMPILER_API ShaderReflectionCache
+    {
+    public:
+        explicit ShaderReflectionCache(size_t maxEntries = 256);
+        ~ShaderReflectionCache();
+
+        ShaderReflectionCache(const ShaderReflectionCache&) = delete;
+        ShaderReflectionCache& operator=(const ShaderReflectionCache&) = delete;
+
+        // Returns the shared reflection for this blob, reflecting it on a miss.
+        std::shared_ptr<const ShaderReflectionInfo> GetSPIRV(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode);
+        std::shared_ptr<const ShaderReflectionInfo> GetDXIL(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode);
+
+        // Returns the cross-compiled sources for this SPIR-V blob, one per target. Only the missing
+        // targets are compiled, from a single parse that also fills the blob's reflection entry
+        // when SPIRV-Cross is the selected reflection backend and the entry is not cached yet.
+        // Failed targets are returned but not cached.
+        std::vector<std::shared_ptr<const CrossCompiledShader>> GetCrossCompiled(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode,
+            const std::vector<CrossCompileOptions>& targets);
+        std::shared_ptr<const CrossCompiledShader> GetCrossCompiled(IGNITE_ShaderType type, const std::vector<uint8_t>& shaderCode,
+            const CrossCompileOptions& options);
+
+        void Clear();
+        size_t GetSize() const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+
+    // Thread-safe, size-bounded (LRU) cache of compiled SPIR-V library modules, keyed by the library
+    // path and the options that affect its code. An entry remembers the source it was compiled from;
+    // when the file's timestamp or size changes, the source is read again and a changed one compiles
+    // anew. Each library compiles once however many entry shaders link it; concurrent requests for one
+    // library wait for a single compile. Files the library includes are not checked, so call Clear
+    // after editing them.
+    class IGNITECOMPILER_API ShaderLibraryCache
+    {
+    public:
+        explicit ShaderLibraryCache(size_t maxEntries = 64);
+        ~ShaderLibraryCache();
+
+        ShaderLibraryCache(const ShaderLibraryCache&) = delete;
+        ShaderLibraryCache& operator=(const ShaderLibraryCache&) = delete;
+
+        // Returns the library module compiled from options.filepath, compiling it on a miss.
+        // The module is empty when compilation failed; failures are not cached.
+        std::shared_ptr<const std::vector<uint8_t>> GetLibrary(const CompilerOptions& options, std::shared_ptr<DXCInstance> instance = nullptr);
+
+        void Clear();
+        size_t GetSize() const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
     };
 }
 
@@ -1,7 +1,10 @@
 // Copyright (c) 2026 Evangelion Manuhutu
 
 #include "ShaderCompiler.h"
+#include "ShaderArchive.h"
 #include "ShaderCompilerCAPI.h"
+#include "ShaderLinker.h"
+#include "ShaderPipelineLayout.h"
 
 #include <exception>
 #include <algorithm>
@@ -11,6 +14,23 @@
 #include <cstdlib>
 
 
+// Backing object for the opaque C archive handle.
+struct IgniteShaderArchive
+{
+    ignite::ShaderArchiveReader reader;
+};
+
+// Backing object for the opaque C library cache handle.
+struct IgniteShaderLibraryCache
+{
+    explicit IgniteShaderLibraryCache(size_t maxEntries)
+        : cache(maxEntries)
+    {
+    }
+
+    ignite::ShaderLibraryCache cache;
+};
+
 namespace
 {
     // Holds current C callback wiring used by bridge callback.
@@ -22,20 +42,6 @@ namespace
 
     CLogBridgeContext g_logBridge = {};
 
-    // Duplicates std::string into malloc-allocated C string.
-    char* DuplicateCString(const std::string& value)
-    {
-        const size_t len = value.size();
-        char* result = static_cast<char*>(std::malloc(len + 1));
-        if (!result)
-        {
-            return nullptr;
-        }
-
-        std::memcpy(result, value.c_str(), len + 1);
-        return result;
-    }
-
     // Bridges C++ log callback invocation to C callback signature.
     void CLogBridge(IGNITE_LogType type, const char* message, void* userData)
     {
@@ -63,199 +69,624 @@ namespace
         return ToLower(path.extension().string()) == ".glsl";
     }
 
-    // Release helpers for nested reflection arrays.
-    void FreeResourceArray(IgniteShaderResourceInfo* array, size_t count)
+    ignite::CrossCompileOptions ToCrossCompileOptions(const IgniteCrossCompileOptions& in)
+    {
+        ignite::CrossCompileOptions options = {};
+        options.target = in.target;
+        options.version = in.version;
+        options.vulkanSemantics = in.vulkanSemantics != 0;
+        options.plainUniforms = in.plainUniforms != 0;
+        options.fixupClipSpace = in.fixupClipSpace != 0;
+        options.flipVertexY = in.flipVertexY != 0;
+        options.mslIOS = in.mslIOS != 0;
+        options.mslArgumentBuffers = in.mslArgumentBuffers != 0;
+        return options;
+    }
+
+    // Maps a C compile request onto C++ compiler options (defaults for missing strings).
+    ignite::CompilerOptions BuildCompilerOptions(const IgniteCompileRequest* request)
     {
-        if (!array)
+        ignite::CompilerOptions options = {};
+        options.compilerType = IGNITE_SHADER_COMPILER_TYPE_DXC;
+        options.platformType = request->platformType;
+        options.filepath = request->inputPath;
+
+        if (request->outputDirectory != nullptr && request->outputDirectory[0] != '\0')
         {
-            return;
+            options.outputFilepath = request->outputDirectory;
+        }
+
+        options.shaderDesc.entryPoint = (request->entryPoint != nullptr && request->entryPoint[0] != '\0')
+            ? request->entryPoint
+            : "main";
+
+        options.shaderDesc.shaderModel = (request->shaderModel != nullptr && request->shaderModel[0] != '\0')
+            ? request->shaderModel
+            : "6_5";
+
+        options.shaderDesc.vulkanVersion = (request->vulkanVersion != nullptr && request->vulkanVersion[0] != '\0')
+            ? request->vulkanVersion
+            : "1.3";
+
+        if (request->vulkanMemoryLayout != nullptr)
+        {
+            options.shaderDesc.vulkanMemoryLayout = request->vulkanMemoryLayout;
+        }
+
+        options.shaderDesc.shaderType = request->shaderType;
+        options.shaderDesc.optLevel = request->optimizationLevel;
+
+        options.tRegShift = request->tRegShift;
+        options.sRegShift = request->sRegShift;
+        options.bRegShift = request->bRegShift;
+        options.uRegShift = request->uRegShift;
+
+        options.warningsAreErrors = request->warningsAreErrors != 0;
+        options.allResourcesBound = request->allResourcesBound != 0;
+        options.stripReflection = request->stripReflection != 0;
+        options.matrixRowMajor = request->matrixRowMajor != 0;
+        options.hlsl2021 = request->hlsl2021 != 0;
+        options.embedPdb = request->embedPdb != 0;
+        options.pdb = request->pdb != 0;
+        options.verbose = request->verbose != 0;
+
+        options.remapIds = request->remapIds != 0;
+        options.stripDebugInfo = request->stripDebugInfo != 0;
+        options.debugSidecar = request->debugSidecar != 0;
+
+        for (size_t i = 0; request->crossCompileTargets && i < request->crossCompileTargetCount; ++i)
+        {
+            options.crossCompileTargets.push_back(ToCrossCompileOptions(request->crossCompileTargets[i]));
+        }
+
+        options.spirvLibrary = request->spirvLibrary != 0;
+        for (size_t i = 0; request->spirvLibraries && i < request->spirvLibraryCount; ++i)
+        {
+            if (request->spirvLibraries[i])
+            {
+                options.spirvLibraries.emplace_back(request->spirvLibraries[i]);
+            }
         }
+        options.libraryCache = request->libraryCache ? &request->libraryCache->cache : nullptr;
 
-        for (size_t i = 0; i < count; ++i)
+        options.spirvOptimizer = request->spirvOptimizer;
+        for (size_t i = 0; request->spirvOptimizerPasses && i < request->spirvOptimizerPassCount; ++i)
         {
-            std::free(array[i].name);
+            if (request->spirvOptimizerPasses[i])
+            {
+                options.spirvOptimizerPasses.push_back(request->spirvOptimizerPasses[i]);
+            }
         }
-        std::free(array);
+
+        return options;
     }
 
-    void FreeStageIOArray(IgniteShaderStageIOInfo* array, size_t count)
+    // Bump allocator over one reflection block: arrays first, then a string pool.
+    // Constructed with a null base it only measures, so packing is size-then-write.
+    class ReflectionArena
     {
-        if (!array)
+    public:
+        ReflectionArena() = default;
+
+        ReflectionArena(uint8_t* base, size_t arraysSize)
+            : m_base(base), m_stringBase(arraysSize)
         {
-            return;
         }
 
-        for (size_t i = 0; i < count; ++i)
+        template<typename T>
+        T* AllocateArray(size_t count)
         {
-            std::free(array[i].name);
+            if (count == 0)
+            {
+                return nullptr;
+            }
+
+            m_arrayOffset = AlignUp(m_arrayOffset, alignof(T));
+            T* result = m_base ? reinterpret_cast<T*>(m_base + m_arrayOffset) : nullptr;
+            m_arrayOffset += sizeof(T) * count;
+            return result;
         }
-        std::free(array);
-    }
 
-    void FreePushConstantArray(IgniteShaderPushConstantInfo* array, size_t count)
+        char* CopyString(const std::string& value)
+        {
+            char* result = m_base ? reinterpret_cast<char*>(m_base + m_stringBase + m_stringOffset) : nullptr;
+            if (result)
+            {
+                std::memcpy(result, value.c_str(), value.size() + 1);
+            }
+            m_stringOffset += value.size() + 1;
+            return result;
+        }
+
+        size_t GetArraysSize() const { return AlignUp(m_arrayOffset, alignof(void*)); }
+        size_t GetTotalSize() const { return GetArraysSize() + m_stringOffset; }
+
+    private:
+        static size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        uint8_t* m_base = nullptr;
+        size_t m_stringBase = 0;
+        size_t m_arrayOffset = 0;
+        size_t m_stringOffset = 0;
+    };
+
+    // Conversion helpers from C++ reflection vectors to arena-backed C arrays.
+    IgniteShaderBufferMember* PackMemberArray(ReflectionArena& arena, const std::vector<ignite::ShaderBufferMember>& source)
     {
-        if (!array)
+        IgniteShaderBufferMember* array = arena.AllocateArray<IgniteShaderBufferMember>(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
         {
-            return;
+            char* name = arena.CopyString(source[i].name);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].type = source[i].type;
+                array[i].offset = source[i].offset;
+                array[i].size = source[i].size;
+                array[i].vecSize = source[i].vecSize;
+                array[i].columns = source[i].columns;
+                array[i].arraySize = source[i].arraySize;
+                array[i].arrayStride = source[i].arrayStride;
+                array[i].matrixStride = source[i].matrixStride;
+                array[i].depth = source[i].depth;
+                array[i].rowMajor = source[i].rowMajor ? 1 : 0;
+            }
         }
+        return array;
+    }
 
-        for (size_t i = 0; i < count; ++i)
+    IgniteShaderResourceInfo* PackResourceArray(ReflectionArena& arena, const std::vector<ignite::ShaderResourceInfo>& source)
+    {
+        IgniteShaderResourceInfo* array = arena.AllocateArray<IgniteShaderResourceInfo>(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
         {
-            std::free(array[i].name);
+            char* name = arena.CopyString(source[i].name);
+            IgniteShaderBufferMember* members = PackMemberArray(arena, source[i].members);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].id = source[i].id;
+                array[i].set = source[i].set;
+                array[i].binding = source[i].binding;
+                array[i].count = source[i].count;
+                array[i].unbounded = source[i].unbounded ? 1 : 0;
+                array[i].size = source[i].size;
+                array[i].memberCount = source[i].members.size();
+                array[i].members = members;
+            }
         }
-        std::free(array);
+        return array;
     }
 
-    void FreeVertexAttributeArray(IgniteVertexAttribute* array, size_t count)
+    IgniteShaderStageIOInfo* PackStageIOArray(ReflectionArena& arena, const std::vector<ignite::ShaderStageIOInfo>& source)
     {
-        if (!array)
+        IgniteShaderStageIOInfo* array = arena.AllocateArray<IgniteShaderStageIOInfo>(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
         {
-            return;
+            char* name = arena.CopyString(source[i].name);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].id = source[i].id;
+                array[i].location = source[i].location;
+                array[i].component = source[i].component;
+                array[i].format = source[i].format;
+                array[i].vecSize = source[i].vecSize;
+                array[i].columns = source[i].columns;
+            }
         }
+        return array;
+    }
 
-        for (size_t i = 0; i < count; ++i)
+    IgniteShaderPushConstantInfo* PackPushConstantArray(ReflectionArena& arena, const std::vector<ignite::ShaderPushConstantInfo>& source)
+    {
+        IgniteShaderPushConstantInfo* array = arena.AllocateArray<IgniteShaderPushConstantInfo>(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
         {
-            std::free(array[i].name);
+            char* name = arena.CopyString(source[i].name);
+            IgniteShaderBufferMember* members = PackMemberArray(arena, source[i].members);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].size = source[i].size;
+                array[i].memberCount = source[i].members.size();
+                array[i].members = members;
+            }
         }
-        std::free(array);
+        return array;
     }
 
-    // Conversion helpers from C++ reflection vectors to C arrays.
-    bool FillResourceArray(const std::vector<ignite::ShaderResourceInfo>& source, IgniteShaderResourceInfo** outArray)
+    IgniteVertexAttribute* PackVertexArray(ReflectionArena& arena, const std::vector<ignite::VertexAttribute>& source)
     {
-        *outArray = nullptr;
-        if (source.empty())
+        IgniteVertexAttribute* array = arena.AllocateArray<IgniteVertexAttribute>(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
         {
-            return true;
+            char* name = arena.CopyString(source[i].name);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].format = source[i].format;
+                array[i].bufferIndex = source[i].bufferIndex;
+                array[i].offset = source[i].offset;
+                array[i].elementStride = source[i].elementStride;
+            }
         }
+        return array;
+    }
 
-        IgniteShaderResourceInfo* array = static_cast<IgniteShaderResourceInfo*>(std::calloc(source.size(), sizeof(IgniteShaderResourceInfo)));
-        if (!array)
+    // Sized for one buffer per attribute so IgniteCompiler_AssignVertexStreams can relayout in place.
+    IgniteVertexBufferLayout* PackVertexBufferArray(ReflectionArena& arena, const std::vector<ignite::VertexBufferLayout>& source, size_t capacity)
+    {
+        IgniteVertexBufferLayout* array = arena.AllocateArray<IgniteVertexBufferLayout>(std::max(source.size(), capacity));
+        if (array)
         {
-            return false;
+            std::memset(array, 0, sizeof(IgniteVertexBufferLayout) * std::max(source.size(), capacity));
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                array[i].bufferIndex = source[i].bufferIndex;
+                array[i].stride = source[i].stride;
+                array[i].inputRate = source[i].inputRate;
+                array[i].stepRate = source[i].stepRate;
+            }
         }
+        return array;
+    }
 
+    IgniteShaderSpecializationConstant* PackSpecializationConstantArray(ReflectionArena& arena, const std::vector<ignite::ShaderSpecializationConstant>& source)
+    {
+        IgniteShaderSpecializationConstant* array = arena.AllocateArray<IgniteShaderSpecializationConstant>(source.size());
         for (size_t i = 0; i < source.size(); ++i)
         {
-            array[i].name = DuplicateCString(source[i].name);
-            array[i].id = source[i].id;
-            array[i].set = source[i].set;
-            array[i].binding = source[i].binding;
-            array[i].count = source[i].count;
+            char* name = arena.CopyString(source[i].name);
+            if (array)
+            {
+                array[i].name = name;
+                array[i].id = source[i].id;
+                array[i].constantId = source[i].constantId;
+                array[i].type = source[i].type;
+                array[i].defaultValue = source[i].defaultValue;
+            }
         }
+        return array;
+    }
+
+    // Lays out every array and name of the C reflection object through one arena.
+    void PackReflection(ReflectionArena& arena, const ignite::ShaderReflectionInfo& reflection, IgniteShaderReflectionInfo* out)
+    {
+        out->uniformBuffers = PackResourceArray(arena, reflection.uniformBuffers);
+        out->sampledImages = PackResourceArray(arena, reflection.sampledImages);
+        out->storageImages = PackResourceArray(arena, reflection.storageImages);
+        out->storageBuffers = PackResourceArray(arena, reflection.storageBuffers);
+        out->separateSamplers = PackResourceArray(arena, reflection.separateSamplers);
+        out->separateImages = PackResourceArray(arena, reflection.separateImages);
+        out->pushConstants = PackPushConstantArray(arena, reflection.pushConstants);
+        out->stageInputs = PackStageIOArray(arena, reflection.stageInputs);
+        out->stageOutputs = PackStageIOArray(arena, reflection.stageOutputs);
+        out->vertexAttributes = PackVertexArray(arena, reflection.vertexAttributes);
+        out->vertexBuffers = PackVertexBufferArray(arena, reflection.vertexBuffers, reflection.vertexAttributes.size());
+        out->specializationConstants = PackSpecializationConstantArray(arena, reflection.specializationConstants);
+    }
+
+    void FillCReflectionCounts(const ignite::ShaderReflectionInfo& reflection, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        outReflectionInfo->shaderType = reflection.shaderType;
+        outReflectionInfo->numUniformBuffers = reflection.numUniformBuffers;
+        outReflectionInfo->numSamplers = reflection.numSamplers;
+        outReflectionInfo->numStorageTextures = reflection.numStorageTextures;
+        outReflectionInfo->numStorageBuffers = reflection.numStorageBuffers;
+        outReflectionInfo->numSeparateSamplers = reflection.numSeparateSamplers;
+        outReflectionInfo->numSeparateImages = reflection.numSeparateImages;
+        outReflectionInfo->numPushConstants = reflection.numPushConstants;
+        outReflectionInfo->numStageInputs = reflection.numStageInputs;
+        outReflectionInfo->numStageOutputs = reflection.numStageOutputs;
+        outReflectionInfo->numSpecializationConstants = reflection.numSpecializationConstants;
+        outReflectionInfo->vertexAttributeCount = reflection.vertexAttributes.size();
+        outReflectionInfo->vertexBufferCount = reflection.vertexBuffers.size();
 
-        *outArray = array;
-        return true;
+        for (int dimension = 0; dimension < 3; ++dimension)
+        {
+            outReflectionInfo->compute.localSize[dimension] = reflection.compute.localSize[dimension];
+            outReflectionInfo->compute.localSizeSpecialized[dimension] = reflection.compute.localSizeSpecialized[dimension] ? 1 : 0;
+            outReflectionInfo->compute.localSizeSpecIds[dimension] = reflection.compute.localSizeSpecIds[dimension];
+        }
+        outReflectionInfo->compute.sharedMemorySize = reflection.compute.sharedMemorySize;
     }
 
-    bool FillStageIOArray(const std::vector<ignite::ShaderStageIOInfo>& source, IgniteShaderStageIOInfo** outArray)
+    // Inverse of the Pack* helpers, for C entry points that hand reflection back to the C++ API.
+    std::vector<ignite::ShaderBufferMember> UnpackMemberArray(const IgniteShaderBufferMember* source, size_t count)
     {
-        *outArray = nullptr;
-        if (source.empty())
+        std::vector<ignite::ShaderBufferMember> members(source ? count : 0);
+        for (size_t i = 0; i < members.size(); ++i)
         {
-            return true;
+            members[i].name = source[i].name ? source[i].name : "";
+            members[i].type = source[i].type;
+            members[i].offset = source[i].offset;
+            members[i].size = source[i].size;
+            members[i].vecSize = source[i].vecSize;
+            members[i].columns = source[i].columns;
+            members[i].arraySize = source[i].arraySize;
+            members[i].arrayStride = source[i].arrayStride;
+            members[i].matrixStride = source[i].matrixStride;
+            members[i].depth = source[i].depth;
+            members[i].rowMajor = source[i].rowMajor != 0;
         }
+        return members;
+    }
 
-        IgniteShaderStageIOInfo* array = static_cast<IgniteShaderStageIOInfo*>(std::calloc(source.size(), sizeof(IgniteShaderStageIOInfo)));
-        if (!array)
+    std::vector<ignite::ShaderResourceInfo> UnpackResourceArray(const IgniteShaderResourceInfo* source, size_t count)
+    {
+        std::vector<ignite::ShaderResourceInfo> resources(source ? count : 0);
+        for (size_t i = 0; i < resources.size(); ++i)
         {
-            return false;
+            resources[i].name = source[i].name ? source[i].name : "";
+            resources[i].id = source[i].id;
+            resources[i].set = source[i].set;
+            resources[i].binding = source[i].binding;
+            resources[i].count = source[i].count;
+            resources[i].unbounded = source[i].unbounded != 0;
+            resources[i].size = source[i].size;
+            resources[i].members = UnpackMemberArray(source[i].members, source[i].memberCount);
         }
+        return resources;
+    }
 
-        for (size_t i = 0; i < source.size(); ++i)
+    std::vector<ignite::ShaderPushConstantInfo> UnpackPushConstantArray(const IgniteShaderPushConstantInfo* source, size_t count)
+    {
+        std::vector<ignite::ShaderPushConstantInfo> blocks(source ? count : 0);
+        for (size_t i = 0; i < blocks.size(); ++i)
         {
-            array[i].name = DuplicateCString(source[i].name);
-            array[i].id = source[i].id;
-            array[i].location = source[i].location;
-            array[i].format = source[i].format;
-            array[i].vecSize = source[i].vecSize;
-            array[i].columns = source[i].columns;
+            blocks[i].name = source[i].name ? source[i].name : "";
+            blocks[i].size = source[i].size;
+            blocks[i].members = UnpackMemberArray(source[i].members, source[i].memberCount);
         }
+        return blocks;
+    }
 
-        *outArray = array;
-        return true;
+    // Descriptor bindings and push constants of a C reflection.
+    ignite::ShaderReflectionInfo UnpackReflectionBindings(const IgniteShaderReflectionInfo& source)
+    {
+        ignite::ShaderReflectionInfo reflection;
+        reflection.shaderType = source.shaderType;
+        reflection.uniformBuffers = UnpackResourceArray(source.uniformBuffers, source.numUniformBuffers);
+        reflection.sampledImages = UnpackResourceArray(source.sampledImages, source.numSamplers);
+        reflection.storageImages = UnpackResourceArray(source.storageImages, source.numStorageTextures);
+        reflection.storageBuffers = UnpackResourceArray(source.storageBuffers, source.numStorageBuffers);
+        reflection.separateSamplers = UnpackResourceArray(source.separateSamplers, source.numSeparateSamplers);
+        reflection.separateImages = UnpackResourceArray(source.separateImages, source.numSeparateImages);
+        reflection.pushConstants = UnpackPushConstantArray(source.pushConstants, source.numPushConstants);
+        return reflection;
     }
 
-    bool FillPushConstantArray(const std::vector<ignite::ShaderPushConstantInfo>& source, IgniteShaderPushConstantInfo** outArray)
+    std::vector<ignite::ShaderStageIOInfo> UnpackStageIOArray(const IgniteShaderStageIOInfo* source, size_t count)
     {
-        *outArray = nullptr;
-        if (source.empty())
+        std::vector<ignite::ShaderStageIOInfo> entries(source ? count : 0);
+        for (size_t i = 0; i < entries.size(); ++i)
         {
-            return true;
+            entries[i].name = source[i].name ? source[i].name : "";
+            entries[i].id = source[i].id;
+            entries[i].location = source[i].location;
+            entries[i].component = source[i].component;
+            entries[i].format = source[i].format;
+            entries[i].vecSize = source[i].vecSize;
+            entries[i].columns = source[i].columns;
         }
+        return entries;
+    }
 
-        IgniteShaderPushConstantInfo* array = static_cast<IgniteShaderPushConstantInfo*>(std::calloc(source.size(), sizeof(IgniteShaderPushConstantInfo)));
-        if (!array)
+    // Every section of a C reflection.
+    ignite::ShaderReflectionInfo UnpackReflection(const IgniteShaderReflectionInfo& source)
+    {
+        ignite::ShaderReflectionInfo reflection = UnpackReflectionBindings(source);
+        reflection.stageInputs = UnpackStageIOArray(source.stageInputs, source.numStageInputs);
+        reflection.stageOutputs = UnpackStageIOArray(source.stageOutputs, source.numStageOutputs);
+
+        reflection.vertexAttributes.resize(source.vertexAttributes ? source.vertexAttributeCount : 0);
+        for (size_t i = 0; i < reflection.vertexAttributes.size(); ++i)
         {
-            return false;
+            const IgniteVertexAttribute& attribute = source.vertexAttributes[i];
+            reflection.vertexAttributes[i].name = attribute.name ? attribute.name : "";
+            reflection.vertexAttributes[i].format = attribute.format;
+            reflection.vertexAttributes[i].bufferIndex = attribute.bufferIndex;
+            reflection.vertexAttributes[i].offset = attribute.offset;
+            reflection.vertexAttributes[i].elementStride = attribute.elementStride;
         }
 
-        for (size_t i = 0; i < source.size(); ++i)
+        reflection.vertexBuffers.resize(source.vertexBuffers ? source.vertexBufferCount : 0);
+        for (size_t i = 0; i < reflection.vertexBuffers.size(); ++i)
+        {
+            reflection.vertexBuffers[i].bufferIndex = source.vertexBuffers[i].bufferIndex;
+            reflection.vertexBuffers[i].stride = source.vertexBuffers[i].stride;
+            reflection.vertexBuffers[i].inputRate = source.vertexBuffers[i].inputRate;
+            reflection.vertexBuffers[i].stepRate = source.vertexBuffers[i].stepRate;
+        }
+
+        reflection.specializationConstants.resize(source.specializationConstants ? source.numSpecializationConstants : 0);
+        for (size_t i = 0; i < reflection.specializationConstants.size(); ++i)
+        {
+            const IgniteShaderSpecializationConstant& constant = source.specializationConstants[i];
+            reflection.specializationConstants[i].name = constant.name ? constant.name : "";
+            reflection.specializationConstants[i].id = constant.id;
+            reflection.specializationConstants[i].constantId = constant.constantId;
+            reflection.specializationConstants[i].type = constant.type;
+            reflection.specializationConstants[i].defaultValue = constant.defaultValue;
+        }
+
+        for (int dimension = 0; dimension < 3; ++dimension)
         {
-            array[i].name = DuplicateCString(source[i].name);
-            array[i].size = source[i].size;
+            reflection.compute.localSize[dimension] = source.compute.localSize[dimension];
+            reflection.compute.localSizeSpecialized[dimension] = source.compute.localSizeSpecialized[dimension] != 0;
+            reflection.compute.localSizeSpecIds[dimension] = source.compute.localSizeSpecIds[dimension];
         }
+        reflection.compute.sharedMemorySize = source.compute.sharedMemorySize;
+        return reflection;
+    }
 
-        *outArray = array;
-        return true;
+    IGNITE_ResultCode FillShaderBlob(const std::vector<uint8_t>& bytes, IgniteShaderBlob* outBlob)
+    {
+        outBlob->data = static_cast<uint8_t*>(std::malloc(bytes.size()));
+        if (!outBlob->data)
+        {
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+        std::memcpy(outBlob->data, bytes.data(), bytes.size());
+        outBlob->size = bytes.size();
+        return IGNITE_RESULT_OK;
     }
 
-    bool FillVertexArray(const std::vector<ignite::VertexAttribute>& source, IgniteVertexAttribute** outArray)
+    void PackPipelineLayout(ReflectionArena& arena, const ignite::PipelineLayout& layout, IgnitePipelineLayout* out)
     {
-        *outArray = nullptr;
-        if (source.empty())
+        out->sets = arena.AllocateArray<IgnitePipelineDescriptorSet>(layout.sets.size());
+        for (size_t i = 0; i < layout.sets.size(); ++i)
+        {
+            const ignite::PipelineDescriptorSet& set = layout.sets[i];
+            IgnitePipelineBinding* bindings = arena.AllocateArray<IgnitePipelineBinding>(set.bindings.size());
+            for (size_t j = 0; j < set.bindings.size(); ++j)
+            {
+                char* name = arena.CopyString(set.bindings[j].name);
+                if (bindings)
+                {
+                    bindings[j].name = name;
+                    bindings[j].binding = set.bindings[j].binding;
+                    bindings[j].descriptorType = set.bindings[j].descriptorType;
+                    bindings[j].count = set.bindings[j].count;
+                    bindings[j].unbounded = set.bindings[j].unbounded ? 1 : 0;
+                    bindings[j].stageMask = set.bindings[j].stageMask;
+                    bindings[j].size = set.bindings[j].size;
+                }
+            }
+
+            if (out->sets)
+            {
+                out->sets[i].set = set.set;
+                out->sets[i].bindingCount = set.bindings.size();
+                out->sets[i].bindings = bindings;
+            }
+        }
+
+        out->pushConstantRanges = arena.AllocateArray<IgnitePushConstantRange>(layout.pushConstantRanges.size());
+        for (size_t i = 0; out->pushConstantRanges && i < layout.pushConstantRanges.size(); ++i)
+        {
+            out->pushConstantRanges[i].stageMask = layout.pushConstantRanges[i].stageMask;
+            out->pushConstantRanges[i].offset = layout.pushConstantRanges[i].offset;
+            out->pushConstantRanges[i].size = layout.pushConstantRanges[i].size;
+        }
+
+        out->diagnostics = arena.AllocateArray<IgnitePipelineLayoutDiagnostic>(layout.diagnostics.size());
+        for (size_t i = 0; i < layout.diagnostics.size(); ++i)
         {
-            return true;
+            char* message = arena.CopyString(layout.diagnostics[i].message);
+            if (out->diagnostics)
+            {
+                out->diagnostics[i].type = layout.diagnostics[i].type;
+                out->diagnostics[i].message = message;
+            }
         }
+    }
 
-        IgniteVertexAttribute* array = static_cast<IgniteVertexAttribute*>(std::calloc(source.size(), sizeof(IgniteVertexAttribute)));
-        if (!array)
+    uint8_t* PackBytes(ReflectionArena& arena, const std::vector<uint8_t>& source)
+    {
+        uint8_t* bytes = arena.AllocateArray<uint8_t>(source.size());
+        if (bytes)
         {
-            return false;
+            std::memcpy(bytes, source.data(), source.size());
         }
+        return bytes;
+    }
 
+    IgniteStageLinkDiagnostic* PackStageLinkDiagnostics(ReflectionArena& arena, const std::vector<ignite::StageLinkDiagnostic>& source)
+    {
+        IgniteStageLinkDiagnostic* array = arena.AllocateArray<IgniteStageLinkDiagnostic>(source.size());
         for (size_t i = 0; i < source.size(); ++i)
         {
-            array[i].name = DuplicateCString(source[i].name);
-            array[i].format = source[i].format;
-            array[i].bufferIndex = source[i].bufferIndex;
-            array[i].offset = source[i].offset;
-            array[i].elementStride = source[i].elementStride;
+            char* message = arena.CopyString(source[i].message);
+            if (array)
+            {
+                array[i].type = source[i].type;
+                array[i].message = message;
+            }
         }
+        return array;
+    }
+
+    void PackStageLinkResult(ReflectionArena& arena, const ignite::StageLinkResult& link, IgniteStageLinkResult* out)
+    {
+        out->producer = PackBytes(arena, link.producer);
+        out->removedOutputs = PackStageIOArray(arena, link.removedOutputs);
+        out->diagnostics = PackStageLinkDiagnostics(arena, link.diagnostics);
+    }
 
-        *outArray = array;
-        return true;
+    void PackVaryingPackResult(ReflectionArena& arena, const ignite::VaryingPackResult& packed, IgniteVaryingPackResult* out)
+    {
+        out->producer = PackBytes(arena, packed.producer);
+        out->consumer = PackBytes(arena, packed.consumer);
+        out->producerOutputs = PackStageIOArray(arena, packed.producerOutputs);
+        out->consumerInputs = PackStageIOArray(arena, packed.consumerInputs);
+        out->diagnostics = PackStageLinkDiagnostics(arena, packed.diagnostics);
+    }
+
+    size_t MeasureCReflectionInfo(const ignite::ShaderReflectionInfo& reflection, size_t* outArraysSize)
+    {
+        IgniteShaderReflectionInfo scratch = {};
+        ReflectionArena sizing;
+        PackReflection(sizing, reflection, &scratch);
+        *outArraysSize = sizing.GetArraysSize();
+        return sizing.GetTotalSize();
     }
 
-    // Populates C reflection object from the C++ reflection model.
+    // Populates C reflection object from the C++ reflection model with a single allocation.
     IGNITE_ResultCode FillCReflectionInfo(const ignite::ShaderReflectionInfo& reflection, IgniteShaderReflectionInfo* outReflectionInfo)
     {
-        outReflectionInfo->shaderType = reflection.shaderType;
-        outReflectionInfo->numUniformBuffers = reflection.numUniformBuffers;
-        outReflectionInfo->numSamplers = reflection.numSamplers;
-        outReflectionInfo->numStorageTextures = reflection.numStorageTextures;
-        outReflectionInfo->numStorageBuffers = reflection.numStorageBuffers;
-        outReflectionInfo->numSeparateSamplers = reflection.numSeparateSamplers;
-        outReflectionInfo->numSeparateImages = reflection.numSeparateImages;
-        outReflectionInfo->numPushConstants = reflection.numPushConstants;
-        outReflectionInfo->numStageInputs = reflection.numStageInputs;
-        outReflectionInfo->numStageOutputs = reflection.numStageOutputs;
-        outReflectionInfo->vertexAttributeCount = reflection.vertexAttributes.size();
+        FillCReflectionCounts(reflection, outReflectionInfo);
+
+        size_t arraysSize = 0;
+        const size_t totalSize = MeasureCReflectionInfo(reflection, &arraysSize);
+        if (totalSize == 0)
+        {
+            return IGNITE_RESULT_OK;
+        }
 
-        if (!FillResourceArray(reflection.uniformBuffers, &outReflectionInfo->uniformBuffers) ||
-            !FillResourceArray(reflection.sampledImages, &outReflectionInfo->sampledImages) ||
-            !FillResourceArray(reflection.storageImages, &outReflectionInfo->storageImages) ||
-            !FillResourceArray(reflection.storageBuffers, &outReflectionInfo->storageBuffers) ||
-            !FillResourceArray(reflection.separateSamplers, &outReflectionInfo->separateSamplers) ||
-            !FillResourceArray(reflection.separateImages, &outReflectionInfo->separateImages) ||
-            !FillPushConstantArray(reflection.pushConstants, &outReflectionInfo->pushConstants) ||
-            !FillStageIOArray(reflection.stageInputs, &outReflectionInfo->stageInputs) ||
-            !FillStageIOArray(reflection.stageOutputs, &outReflectionInfo->stageOutputs) ||
-            !FillVertexArray(reflection.vertexAttributes, &outReflectionInfo->vertexAttributes))
+        uint8_t* block = static_cast<uint8_t*>(std::malloc(totalSize));
+        if (!block)
         {
             return IGNITE_RESULT_INTERNAL_ERROR;
         }
 
+        ReflectionArena arena(block, arraysSize);
+        PackReflection(arena, reflection, outReflectionInfo);
+        outReflectionInfo->arena = block;
+        outReflectionInfo->arenaSize = totalSize;
+        return IGNITE_RESULT_OK;
+    }
+
+    // Same layout as FillCReflectionInfo, written into caller memory instead of a malloc block.
+    IGNITE_ResultCode FillCReflectionInfoInBuffer(const ignite::ShaderReflectionInfo& reflection, void* buffer, size_t bufferSize,
+        size_t* outRequiredSize, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        size_t arraysSize = 0;
+        const size_t totalSize = MeasureCReflectionInfo(reflection, &arraysSize);
+        if (outRequiredSize)
+        {
+            *outRequiredSize = totalSize;
+        }
+
+        if (totalSize > bufferSize)
+        {
+            return IGNITE_RESULT_BUFFER_TOO_SMALL;
+        }
+
+        if (totalSize > 0 && (buffer == nullptr || reinterpret_cast<uintptr_t>(buffer) % alignof(void*) != 0))
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        FillCReflectionCounts(reflection, outReflectionInfo);
+        ReflectionArena arena(static_cast<uint8_t*>(buffer), arraysSize);
+        PackReflection(arena, reflection, outReflectionInfo);
+        outReflectionInfo->arena = nullptr;
+        outReflectionInfo->arenaSize = totalSize;
         return IGNITE_RESULT_OK;
     }
 }
@@ -293,49 +724,7 @@ extern "C"
 
         try
         {
-            ignite::CompilerOptions options = {};
-            options.compilerType = IGNITE_SHADER_COMPILER_TYPE_DXC;
-            options.platformType = request->platformType;
-            options.filepath = request->inputPath;
-
-            if (request->outputDirectory != nullptr && request->outputDirectory[0] != '\0')
-            {
-                options.outputFilepath = request->outputDirectory;
-            }
-
-            options.shaderDesc.entryPoint = (request->entryPoint != nullptr && request->entryPoint[0] != '\0')
-                ? request->entryPoint
-                : "main";
-
-            options.shaderDesc.shaderModel = (request->shaderModel != nullptr && request->shaderModel[0] != '\0')
-                ? request->shaderModel
-                : "6_5";
-
-            options.shaderDesc.vulkanVersion = (request->vulkanVersion != nullptr && request->vulkanVersion[0] != '\0')
-                ? request->vulkanVersion
-                : "1.3";
-
-            if (request->vulkanMemoryLayout != nullptr)
-            {
-                options.shaderDesc.vulkanMemoryLayout = request->vulkanMemoryLayout;
-            }
-
-            options.shaderDesc.shaderType = request->shaderType;
-            options.shaderDesc.optLevel = request->optimizationLevel;
-
-            options.tRegShift = request->tRegShift;
-            options.sRegShift = request->sRegShift;
-            options.bRegShift = request->bRegShift;
-            options.uRegShift = request->uRegShift;
-
-            options.warningsAreErrors = request->warningsAreErrors != 0;
-            options.allResourcesBound = request->allResourcesBound != 0;
-            options.stripReflection = request->stripReflection != 0;
-            options.matrixRowMajor = request->matrixRowMajor != 0;
-            options.hlsl2021 = request->hlsl2021 != 0;
-            options.embedPdb = request->embedPdb != 0;
-            options.pdb = request->pdb != 0;
-            options.verbose = request->verbose != 0;
+            const ignite::CompilerOptions options = BuildCompilerOptions(request);
 
             if (IsGlslFile(options.filepath))
             {
@@ -381,12 +770,14 @@ extern "C"
 
         std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
 
-        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
-        std::vector<uint8_t> shaderCode(bytes, bytes + sizeInBytes);
+        if (sizeInBytes % sizeof(uint32_t) != 0)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
 
         try
         {
-            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::SPIRVReflect(shaderType, shaderCode);
+            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::SPIRVReflect(shaderType, spirvData, sizeInBytes / sizeof(uint32_t));
 
             IGNITE_ResultCode result = FillCReflectionInfo(reflection, outReflectionInfo);
             if (result != IGNITE_RESULT_OK)
@@ -402,55 +793,858 @@ extern "C"
         }
     }
 
-    // C API: DXIL reflection entry point.
-    IGNITE_ResultCode IgniteCompiler_ReflectDXIL(const uint8_t* dxilData, size_t sizeInBytes, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo)
+    // C API: compile and reflect without reading the output back from disk.
+    IGNITE_ResultCode IgniteCompiler_CompileAndReflect(const IgniteCompileRequest* request, IgniteCompiledShader* outShader)
     {
-        if (!dxilData || sizeInBytes == 0 || !outReflectionInfo)
+        if (request == nullptr || request->inputPath == nullptr || request->inputPath[0] == '\0' || outShader == nullptr)
         {
             return IGNITE_RESULT_INVALID_ARGUMENT;
         }
 
-        std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+        std::memset(outShader, 0, sizeof(*outShader));
 
-        std::vector<uint8_t> shaderCode(dxilData, dxilData + sizeInBytes);
+#if !defined(_WIN32)
+        if (!IsGlslFile(request->inputPath))
+        {
+            return IGNITE_RESULT_UNSUPPORTED_PLATFORM;
+        }
+#endif
 
         try
         {
-            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::DXILReflect(shaderType, shaderCode);
+            ignite::CompiledShader compiled = ignite::ShaderCompiler::CompileAndReflect(BuildCompilerOptions(request));
+            if (!compiled)
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
 
-            IGNITE_ResultCode result = FillCReflectionInfo(reflection, outReflectionInfo);
+            outShader->code = static_cast<uint8_t*>(std::malloc(compiled.code.size()));
+            if (!outShader->code)
+            {
+                return IGNITE_RESULT_INTERNAL_ERROR;
+            }
+            std::memcpy(outShader->code, compiled.code.data(), compiled.code.size());
+            outShader->codeSize = compiled.code.size();
+
+            IGNITE_ResultCode result = FillCReflectionInfo(compiled.reflection, &outShader->reflection);
             if (result != IGNITE_RESULT_OK)
             {
-                IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+                IgniteCompiler_FreeCompiledShader(outShader);
             }
             return result;
         }
         catch (...)
         {
-            IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+            IgniteCompiler_FreeCompiledShader(outShader);
             return IGNITE_RESULT_INTERNAL_ERROR;
         }
     }
 
-    // C API: release allocations produced by reflection functions.
-    void IgniteCompiler_FreeReflectionInfo(IgniteShaderReflectionInfo* reflectionInfo)
+    // C API: release a result produced by IgniteCompiler_CompileAndReflect.
+    void IgniteCompiler_FreeCompiledShader(IgniteCompiledShader* shader)
     {
-        if (!reflectionInfo)
+        if (!shader)
         {
             return;
         }
 
-        FreeResourceArray(reflectionInfo->uniformBuffers, reflectionInfo->numUniformBuffers);
-        FreeResourceArray(reflectionInfo->sampledImages, reflectionInfo->numSamplers);
-        FreeResourceArray(reflectionInfo->storageImages, reflectionInfo->numStorageTextures);
-        FreeResourceArray(reflectionInfo->storageBuffers, reflectionInfo->numStorageBuffers);
-        FreeResourceArray(reflectionInfo->separateSamplers, reflectionInfo->numSeparateSamplers);
-        FreeResourceArray(reflectionInfo->separateImages, reflectionInfo->numSeparateImages);
-        FreePushConstantArray(reflectionInfo->pushConstants, reflectionInfo->numPushConstants);
-        FreeStageIOArray(reflectionInfo->stageInputs, reflectionInfo->numStageInputs);
-        FreeStageIOArray(reflectionInfo->stageOutputs, reflectionInfo->numStageOutputs);
-        FreeVertexAttributeArray(reflectionInfo->vertexAttributes, reflectionInfo->vertexAttributeCount);
+        std::free(shader->code);
+        IgniteCompiler_FreeReflectionInfo(&shader->reflection);
+        std::memset(shader, 0, sizeof(*shader));
+    }
 
-        std::memset(reflectionInfo, 0, sizeof(*reflectionInfo));
+    // C API: relayout reflected vertex attributes into explicit buffers, in place.
+    IGNITE_ResultCode IgniteCompiler_AssignVertexStreams(IgniteShaderReflectionInfo* reflectionInfo, const IgniteVertexStreamAssignment* assignments, size_t assignmentCount, const IgniteVertexBufferLayout* buffers, size_t bufferCount)
+    {
+        if (!reflectionInfo || (assignmentCount > 0 && !assignments) || (bufferCount > 0 && !buffers)
+            || (reflectionInfo->vertexAttributeCount > 0 && (!reflectionInfo->vertexAttributes || !reflectionInfo->vertexBuffers)))
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        try
+        {
+            ignite::ShaderReflectionInfo reflection;
+            reflection.vertexAttributes.resize(reflectionInfo->vertexAttributeCount);
+            for (size_t i = 0; i < reflection.vertexAttributes.size(); ++i)
+            {
+                const IgniteVertexAttribute& source = reflectionInfo->vertexAttributes[i];
+                reflection.vertexAttributes[i].name = source.name ? source.name : "";
+                reflection.vertexAttributes[i].format = source.format;
+            }
+
+            ignite::VertexStreamMap map;
+            map.assignments.resize(assignmentCount);
+            for (size_t i = 0; i < assignmentCount; ++i)
+            {
+                if (!assignments[i].attribute)
+                {
+                    return IGNITE_RESULT_INVALID_ARGUMENT;
+                }
+                map.assignments[i].attribute = assignments[i].attribute;
+                map.assignments[i].bufferIndex = assignments[i].bufferIndex;
+            }
+
+            map.buffers.resize(bufferCount);
+            for (size_t i = 0; i < bufferCount; ++i)
+            {
+                map.buffers[i].bufferIndex = buffers[i].bufferIndex;
+                map.buffers[i].inputRate = buffers[i].inputRate;
+                map.buffers[i].stepRate = buffers[i].stepRate;
+            }
+
+            ignite::ShaderReflection::AssignVertexStreams(reflection, map);
+
+            for (size_t i = 0; i < reflection.vertexAttributes.size(); ++i)
+            {
+                IgniteVertexAttribute& target = reflectionInfo->vertexAttributes[i];
+                target.bufferIndex = reflection.vertexAttributes[i].bufferIndex;
+                target.offset = reflection.vertexAttributes[i].offset;
+                target.elementStride = reflection.vertexAttributes[i].elementStride;
+            }
+
+            // Every buffer holds at least one attribute, so the count never exceeds the reserved room.
+            for (size_t i = 0; i < reflection.vertexBuffers.size(); ++i)
+            {
+                IgniteVertexBufferLayout& target = reflectionInfo->vertexBuffers[i];
+                target.bufferIndex = reflection.vertexBuffers[i].bufferIndex;
+                target.stride = reflection.vertexBuffers[i].stride;
+                target.inputRate = reflection.vertexBuffers[i].inputRate;
+                target.stepRate = reflection.vertexBuffers[i].stepRate;
+            }
+            reflectionInfo->vertexBufferCount = reflection.vertexBuffers.size();
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: bake specialization constant values into a SPIR-V module.
+    IGNITE_ResultCode IgniteCompiler_SpecializeSPIRV(const uint32_t* spirvData, size_t sizeInBytes, const IgniteSpecializationConstantValue* values, size_t valueCount, int optimize, IgniteShaderBlob* outBlob)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || (valueCount > 0 && !values) || !outBlob)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outBlob, 0, sizeof(*outBlob));
+
+        try
+        {
+            std::vector<ignite::SpecializationConstantValue> constants(valueCount);
+            for (size_t i = 0; i < valueCount; ++i)
+            {
+                constants[i].constantId = values[i].constantId;
+                constants[i].value = values[i].value;
+            }
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            std::vector<uint8_t> specialized = ignite::ShaderCompiler::SpecializeSPIRV(std::vector<uint8_t>(bytes, bytes + sizeInBytes), constants, optimize != 0);
+            if (specialized.empty())
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
+
+            return FillShaderBlob(specialized, outBlob);
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeShaderBlob(outBlob);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: run a spirv-opt recipe over a SPIR-V module.
+    IGNITE_ResultCode IgniteCompiler_OptimizeSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_SPIRVOptimizerRecipe recipe, const char* const* passes, size_t passCount, IgniteShaderBlob* outBlob)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || (passCount > 0 && !passes) || !outBlob)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outBlob, 0, sizeof(*outBlob));
+
+        try
+        {
+            std::vector<std::string> customPasses;
+            for (size_t i = 0; i < passCount; ++i)
+            {
+                if (!passes[i])
+                {
+                    return IGNITE_RESULT_INVALID_ARGUMENT;
+                }
+                customPasses.push_back(passes[i]);
+            }
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            std::vector<uint8_t> optimized = ignite::ShaderCompiler::OptimizeSPIRV(std::vector<uint8_t>(bytes, bytes + sizeInBytes), recipe, customPasses);
+            if (optimized.empty())
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
+
+            return FillShaderBlob(optimized, outBlob);
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeShaderBlob(outBlob);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: canonicalize a SPIR-V module for compression and deduplication.
+    IGNITE_ResultCode IgniteCompiler_RemapSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IgniteShaderBlob* outBlob)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || !outBlob)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outBlob, 0, sizeof(*outBlob));
+
+        try
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            std::vector<uint8_t> remapped = ignite::ShaderCompiler::RemapSPIRV(std::vector<uint8_t>(bytes, bytes + sizeInBytes));
+            if (remapped.empty())
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
+            return FillShaderBlob(remapped, outBlob);
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeShaderBlob(outBlob);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: strip debug info from a SPIR-V module, optionally keeping it in a sidecar.
+    IGNITE_ResultCode IgniteCompiler_StripSPIRVDebugInfo(const uint32_t* spirvData, size_t sizeInBytes, IgniteShaderBlob* outStripped, IgniteShaderBlob* outSidecar)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || !outStripped)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outStripped, 0, sizeof(*outStripped));
+        if (outSidecar)
+        {
+            std::memset(outSidecar, 0, sizeof(*outSidecar));
+        }
+
+        try
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            std::vector<uint8_t> sidecar;
+            std::vector<uint8_t> stripped = ignite::ShaderCompiler::StripSPIRVDebugInfo(std::vector<uint8_t>(bytes, bytes + sizeInBytes), outSidecar ? &sidecar : nullptr);
+            if (stripped.empty())
+            {
+                return IGNITE_RESULT_INVALID_ARGUMENT;
+            }
+
+            IGNITE_ResultCode result = FillShaderBlob(stripped, outStripped);
+            if (result == IGNITE_RESULT_OK && outSidecar)
+            {
+                result = FillShaderBlob(sidecar, outSidecar);
+            }
+            if (result != IGNITE_RESULT_OK)
+            {
+                IgniteCompiler_FreeShaderBlob(outStripped);
+                IgniteCompiler_FreeShaderBlob(outSidecar);
+            }
+            return result;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeShaderBlob(outStripped);
+            IgniteCompiler_FreeShaderBlob(outSidecar);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: reflect a stripped SPIR-V module with names from its debug sidecar.
+    IGNITE_ResultCode IgniteCompiler_ReflectSPIRVWithDebugSidecar(const uint32_t* spirvData, size_t sizeInBytes, const uint8_t* sidecarData, size_t sidecarSize, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || (sidecarSize > 0 && !sidecarData) || !outReflectionInfo)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+
+        try
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::SPIRVReflect(shaderType,
+                std::vector<uint8_t>(bytes, bytes + sizeInBytes), std::vector<uint8_t>(sidecarData, sidecarData + sidecarSize));
+
+            IGNITE_ResultCode result = FillCReflectionInfo(reflection, outReflectionInfo);
+            if (result != IGNITE_RESULT_OK)
+            {
+                IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+            }
+            return result;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: cross-compile a SPIR-V module to one or more source targets.
+    IGNITE_ResultCode IgniteCompiler_CrossCompileSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_ShaderType shaderType,
+        const IgniteCrossCompileOptions* targets, size_t targetCount, IgniteShaderBlob* outSources, IgniteShaderReflectionInfo* outReflection)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || (targetCount > 0 && (!targets || !outSources)))
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        if (outSources)
+        {
+            std::memset(outSources, 0, sizeof(*outSources) * targetCount);
+        }
+        if (outReflection)
+        {
+            std::memset(outReflection, 0, sizeof(*outReflection));
+        }
+
+        auto release = [&] {
+            for (size_t i = 0; i < targetCount; ++i)
+            {
+                IgniteCompiler_FreeShaderBlob(&outSources[i]);
+            }
+            if (outReflection)
+            {
+                IgniteCompiler_FreeReflectionInfo(outReflection);
+            }
+        };
+
+        try
+        {
+            std::vector<ignite::CrossCompileOptions> options;
+            options.reserve(targetCount);
+            for (size_t i = 0; i < targetCount; ++i)
+            {
+                options.push_back(ToCrossCompileOptions(targets[i]));
+            }
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(spirvData);
+            ignite::ShaderReflectionInfo reflection = {};
+            std::vector<ignite::CrossCompiledShader> sources;
+            if (!ignite::ShaderCompiler::CrossCompileSPIRV(shaderType, std::vector<uint8_t>(bytes, bytes + sizeInBytes), options, sources,
+                outReflection ? &reflection : nullptr))
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
+
+            IGNITE_ResultCode result = IGNITE_RESULT_OK;
+            for (size_t i = 0; i < targetCount; ++i)
+            {
+                if (!sources[i])
+                {
+                    result = IGNITE_RESULT_COMPILATION_FAILED;
+                    continue;
+                }
+
+                const std::string& source = sources[i].source;
+                if (FillShaderBlob(std::vector<uint8_t>(source.c_str(), source.c_str() + source.size() + 1), &outSources[i]) != IGNITE_RESULT_OK)
+                {
+                    release();
+                    return IGNITE_RESULT_INTERNAL_ERROR;
+                }
+                outSources[i].size = source.size();
+            }
+
+            if (outReflection)
+            {
+                const IGNITE_ResultCode reflected = FillCReflectionInfo(reflection, outReflection);
+                if (reflected != IGNITE_RESULT_OK)
+                {
+                    release();
+                    return reflected;
+                }
+            }
+            return result;
+        }
+        catch (...)
+        {
+            release();
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: link SPIR-V modules in process.
+    IGNITE_ResultCode IgniteCompiler_LinkSPIRV(const uint32_t* const* modules, const size_t* sizesInBytes, size_t moduleCount, int createLibrary, IgniteShaderBlob* outBlob)
+    {
+        if (!modules || !sizesInBytes || moduleCount == 0 || !outBlob)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        for (size_t i = 0; i < moduleCount; ++i)
+        {
+            if (!modules[i] || sizesInBytes[i] == 0 || sizesInBytes[i] % sizeof(uint32_t) != 0)
+            {
+                return IGNITE_RESULT_INVALID_ARGUMENT;
+            }
+        }
+
+        std::memset(outBlob, 0, sizeof(*outBlob));
+
+        try
+        {
+            std::vector<std::vector<uint8_t>> inputs;
+            inputs.reserve(moduleCount);
+            for (size_t i = 0; i < moduleCount; ++i)
+            {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(modules[i]);
+                inputs.emplace_back(bytes, bytes + sizesInBytes[i]);
+            }
+
+            std::vector<uint8_t> linked = ignite::ShaderCompiler::LinkSPIRV(inputs, createLibrary != 0);
+            if (linked.empty())
+            {
+                return IGNITE_RESULT_COMPILATION_FAILED;
+            }
+            return FillShaderBlob(linked, outBlob);
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeShaderBlob(outBlob);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: create a library module cache.
+    IGNITE_ResultCode IgniteCompiler_CreateLibraryCache(size_t maxEntries, IgniteShaderLibraryCache** outCache)
+    {
+        if (!outCache)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        *outCache = nullptr;
+
+        try
+        {
+            *outCache = new IgniteShaderLibraryCache(maxEntries);
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: destroy a library module cache.
+    void IgniteCompiler_DestroyLibraryCache(IgniteShaderLibraryCache* cache)
+    {
+        delete cache;
+    }
+
+    // C API: release bytes returned in an IgniteShaderBlob.
+    void IgniteCompiler_FreeShaderBlob(IgniteShaderBlob* blob)
+    {
+        if (!blob)
+        {
+            return;
+        }
+
+        std::free(blob->data);
+        std::memset(blob, 0, sizeof(*blob));
+    }
+
+    // C API: choose the backend used by IgniteCompiler_ReflectSPIRV.
+    void IgniteCompiler_SetSPIRVReflectionBackend(IGNITE_SPIRVReflectionBackend backend)
+    {
+        ignite::ShaderReflection::SetSPIRVReflectionBackend(backend);
+    }
+
+    // C API: DXIL reflection entry point.
+    IGNITE_ResultCode IgniteCompiler_ReflectDXIL(const uint8_t* dxilData, size_t sizeInBytes, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        if (!dxilData || sizeInBytes == 0 || !outReflectionInfo)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+
+        std::vector<uint8_t> shaderCode(dxilData, dxilData + sizeInBytes);
+
+        try
+        {
+            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::DXILReflect(shaderType, shaderCode);
+
+            IGNITE_ResultCode result = FillCReflectionInfo(reflection, outReflectionInfo);
+            if (result != IGNITE_RESULT_OK)
+            {
+                IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+            }
+            return result;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeReflectionInfo(outReflectionInfo);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: SPIR-V reflection into caller-owned memory.
+    IGNITE_ResultCode IgniteCompiler_ReflectSPIRVToBuffer(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_ShaderType shaderType,
+        void* buffer, size_t bufferSize, size_t* outRequiredSize, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        if (!spirvData || sizeInBytes == 0 || sizeInBytes % sizeof(uint32_t) != 0 || !outReflectionInfo)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+
+        try
+        {
+            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::SPIRVReflect(shaderType, spirvData, sizeInBytes / sizeof(uint32_t));
+            return FillCReflectionInfoInBuffer(reflection, buffer, bufferSize, outRequiredSize, outReflectionInfo);
+        }
+        catch (...)
+        {
+            std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: DXIL reflection into caller-owned memory.
+    IGNITE_ResultCode IgniteCompiler_ReflectDXILToBuffer(const uint8_t* dxilData, size_t sizeInBytes, IGNITE_ShaderType shaderType,
+        void* buffer, size_t bufferSize, size_t* outRequiredSize, IgniteShaderReflectionInfo* outReflectionInfo)
+    {
+        if (!dxilData || sizeInBytes == 0 || !outReflectionInfo)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+
+        std::vector<uint8_t> shaderCode(dxilData, dxilData + sizeInBytes);
+
+        try
+        {
+            ignite::ShaderReflectionInfo reflection = ignite::ShaderReflection::DXILReflect(shaderType, shaderCode);
+            return FillCReflectionInfoInBuffer(reflection, buffer, bufferSize, outRequiredSize, outReflectionInfo);
+        }
+        catch (...)
+        {
+            std::memset(outReflectionInfo, 0, sizeof(*outReflectionInfo));
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: release allocations produced by reflection functions.
+    void IgniteCompiler_FreeReflectionInfo(IgniteShaderReflectionInfo* reflectionInfo)
+    {
+        if (!reflectionInfo)
+        {
+            return;
+        }
+
+        std::free(reflectionInfo->arena);
+        std::memset(reflectionInfo, 0, sizeof(*reflectionInfo));
+    }
+
+    // C API: classify the interface change between two reflections of a shader.
+    IGNITE_ResultCode IgniteCompiler_DiffReflection(const IgniteShaderReflectionInfo* oldInfo, const IgniteShaderReflectionInfo* newInfo, uint32_t* outChanges)
+    {
+        if (!oldInfo || !newInfo || !outChanges)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        try
+        {
+            *outChanges = ignite::ShaderReflection::Diff(UnpackReflection(*oldInfo), UnpackReflection(*newInfo)).changes;
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: same as IgniteCompiler_DiffReflection, plus the CODE bit when the blobs differ.
+    IGNITE_ResultCode IgniteCompiler_DiffCompiledShaders(const IgniteCompiledShader* oldShader, const IgniteCompiledShader* newShader, uint32_t* outChanges)
+    {
+        if (!oldShader || !newShader || !outChanges || (oldShader->codeSize > 0 && !oldShader->code) || (newShader->codeSize > 0 && !newShader->code))
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        IGNITE_ResultCode result = IgniteCompiler_DiffReflection(&oldShader->reflection, &newShader->reflection, outChanges);
+        if (result == IGNITE_RESULT_OK && (oldShader->codeSize != newShader->codeSize
+            || (oldShader->codeSize > 0 && std::memcmp(oldShader->code, newShader->code, oldShader->codeSize) != 0)))
+        {
+            *outChanges |= IGNITE_REFLECTION_CHANGE_CODE;
+        }
+        return result;
+    }
+
+    // C API: merge stage reflections into one pipeline layout.
+    IGNITE_ResultCode IgniteCompiler_BuildPipelineLayout(const IgniteShaderReflectionInfo* const* stages, size_t stageCount, IGNITE_ShaderPlatformType platformType, IgnitePipelineLayout* outLayout)
+    {
+        if ((stageCount > 0 && !stages) || !outLayout)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outLayout, 0, sizeof(*outLayout));
+
+        try
+        {
+            ignite::PipelineLayoutBuilder builder(platformType);
+            for (size_t i = 0; i < stageCount; ++i)
+            {
+                if (!stages[i])
+                {
+                    return IGNITE_RESULT_INVALID_ARGUMENT;
+                }
+                builder.AddStage(UnpackReflectionBindings(*stages[i]));
+            }
+
+            const ignite::PipelineLayout layout = builder.Build();
+            outLayout->setCount = layout.sets.size();
+            outLayout->pushConstantRangeCount = layout.pushConstantRanges.size();
+            outLayout->diagnosticCount = layout.diagnostics.size();
+            outLayout->hash = layout.hash;
+            outLayout->valid = layout.IsValid() ? 1 : 0;
+
+            IgnitePipelineLayout scratch = {};
+            ReflectionArena sizing;
+            PackPipelineLayout(sizing, layout, &scratch);
+            const size_t totalSize = sizing.GetTotalSize();
+            if (totalSize == 0)
+            {
+                return IGNITE_RESULT_OK;
+            }
+
+            uint8_t* block = static_cast<uint8_t*>(std::malloc(totalSize));
+            if (!block)
+            {
+                std::memset(outLayout, 0, sizeof(*outLayout));
+                return IGNITE_RESULT_INTERNAL_ERROR;
+            }
+
+            ReflectionArena arena(block, sizing.GetArraysSize());
+            PackPipelineLayout(arena, layout, outLayout);
+            outLayout->arena = block;
+            outLayout->arenaSize = totalSize;
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreePipelineLayout(outLayout);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: release a merged pipeline layout.
+    void IgniteCompiler_FreePipelineLayout(IgnitePipelineLayout* layout)
+    {
+        if (!layout)
+        {
+            return;
+        }
+
+        std::free(layout->arena);
+        std::memset(layout, 0, sizeof(*layout));
+    }
+
+    // C API: validate two consecutive stages and strip unread producer outputs.
+    IGNITE_ResultCode IgniteCompiler_LinkStages(IGNITE_ShaderType producerType, const uint32_t* producerData, size_t producerSize, IGNITE_ShaderType consumerType, const uint32_t* consumerData, size_t consumerSize, IgniteStageLinkResult* outResult)
+    {
+        if (!producerData || producerSize == 0 || !consumerData || consumerSize == 0 || !outResult)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outResult, 0, sizeof(*outResult));
+
+        try
+        {
+            const uint8_t* producerBytes = reinterpret_cast<const uint8_t*>(producerData);
+            const uint8_t* consumerBytes = reinterpret_cast<const uint8_t*>(consumerData);
+            const ignite::StageLinkResult link = ignite::LinkStages(producerType, std::vector<uint8_t>(producerBytes, producerBytes + producerSize),
+                consumerType, std::vector<uint8_t>(consumerBytes, consumerBytes + consumerSize));
+
+            outResult->producerSize = link.producer.size();
+            outResult->removedOutputCount = link.removedOutputs.size();
+            outResult->diagnosticCount = link.diagnostics.size();
+            outResult->valid = link.IsValid() ? 1 : 0;
+
+            IgniteStageLinkResult scratch = {};
+            ReflectionArena sizing;
+            PackStageLinkResult(sizing, link, &scratch);
+            const size_t totalSize = sizing.GetTotalSize();
+            if (totalSize == 0)
+            {
+                return IGNITE_RESULT_OK;
+            }
+
+            uint8_t* block = static_cast<uint8_t*>(std::malloc(totalSize));
+            if (!block)
+            {
+                std::memset(outResult, 0, sizeof(*outResult));
+                return IGNITE_RESULT_INTERNAL_ERROR;
+            }
+
+            ReflectionArena arena(block, sizing.GetArraysSize());
+            PackStageLinkResult(arena, link, outResult);
+            outResult->arena = block;
+            outResult->arenaSize = totalSize;
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeStageLinkResult(outResult);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: release a stage link result.
+    void IgniteCompiler_FreeStageLinkResult(IgniteStageLinkResult* result)
+    {
+        if (!result)
+        {
+            return;
+        }
+
+        std::free(result->arena);
+        std::memset(result, 0, sizeof(*result));
+    }
+
+    // C API: pack small varyings of two consecutive stages into shared locations.
+    IGNITE_ResultCode IgniteCompiler_PackVaryings(IGNITE_ShaderType producerType, const uint32_t* producerData, size_t producerSize, IGNITE_ShaderType consumerType, const uint32_t* consumerData, size_t consumerSize, IgniteVaryingPackResult* outResult)
+    {
+        if (!producerData || producerSize == 0 || !consumerData || consumerSize == 0 || !outResult)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outResult, 0, sizeof(*outResult));
+
+        try
+        {
+            const uint8_t* producerBytes = reinterpret_cast<const uint8_t*>(producerData);
+            const uint8_t* consumerBytes = reinterpret_cast<const uint8_t*>(consumerData);
+            const ignite::VaryingPackResult packed = ignite::PackVaryings(producerType, std::vector<uint8_t>(producerBytes, producerBytes + producerSize),
+                consumerType, std::vector<uint8_t>(consumerBytes, consumerBytes + consumerSize));
+
+            outResult->producerSize = packed.producer.size();
+            outResult->consumerSize = packed.consumer.size();
+            outResult->producerOutputCount = packed.producerOutputs.size();
+            outResult->consumerInputCount = packed.consumerInputs.size();
+            outResult->locationsBefore = packed.locationsBefore;
+            outResult->locationsAfter = packed.locationsAfter;
+            outResult->diagnosticCount = packed.diagnostics.size();
+            outResult->valid = packed.IsValid() ? 1 : 0;
+
+            IgniteVaryingPackResult scratch = {};
+            ReflectionArena sizing;
+            PackVaryingPackResult(sizing, packed, &scratch);
+            const size_t totalSize = sizing.GetTotalSize();
+            if (totalSize == 0)
+            {
+                return IGNITE_RESULT_OK;
+            }
+
+            uint8_t* block = static_cast<uint8_t*>(std::malloc(totalSize));
+            if (!block)
+            {
+                std::memset(outResult, 0, sizeof(*outResult));
+                return IGNITE_RESULT_INTERNAL_ERROR;
+            }
+
+            ReflectionArena arena(block, sizing.GetArraysSize());
+            PackVaryingPackResult(arena, packed, outResult);
+            outResult->arena = block;
+            outResult->arenaSize = totalSize;
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            IgniteCompiler_FreeVaryingPackResult(outResult);
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: release a varying packing result.
+    void IgniteCompiler_FreeVaryingPackResult(IgniteVaryingPackResult* result)
+    {
+        if (!result)
+        {
+            return;
+        }
+
+        std::free(result->arena);
+        std::memset(result, 0, sizeof(*result));
+    }
+
+    // C API: map a shader archive from disk.
+    IGNITE_ResultCode IgniteCompiler_OpenArchive(const char* path, IgniteShaderArchive** outArchive)
+    {
+        if (!path || path[0] == '\0' || !outArchive)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        *outArchive = nullptr;
+
+        try
+        {
+            IgniteShaderArchive* archive = new IgniteShaderArchive();
+            if (!archive->reader.Open(path))
+            {
+                delete archive;
+                return IGNITE_RESULT_NOT_FOUND;
+            }
+
+            *outArchive = archive;
+            return IGNITE_RESULT_OK;
+        }
+        catch (...)
+        {
+            return IGNITE_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // C API: resolve one archive entry to a blob view.
+    IGNITE_ResultCode IgniteCompiler_FindArchiveShader(const IgniteShaderArchive* archive, const char* name, IGNITE_ShaderType shaderType, IGNITE_ShaderPlatformType platformType, uint32_t permutationId, IgniteShaderBlobView* outView)
+    {
+        if (!archive || !name || !outView)
+        {
+            return IGNITE_RESULT_INVALID_ARGUMENT;
+        }
+
+        std::memset(outView, 0, sizeof(*outView));
+
+        const ignite::ShaderBlobView view = archive->reader.Find(name, shaderType, platformType, permutationId);
+        if (!view)
+        {
+            return IGNITE_RESULT_NOT_FOUND;
+        }
+
+        outView->data = view.data;
+        outView->size = view.size;
+        outView->reflection = view.reflection;
+        outView->reflectionSize = view.reflectionSize;
+        return IGNITE_RESULT_OK;
+    }
+
+    // C API: release an archive handle.
+    void IgniteCompiler_CloseArchive(IgniteShaderArchive* archive)
+    {
+        delete archive;
     }
 }
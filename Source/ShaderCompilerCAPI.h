@@ -18,6 +18,7 @@
 #endif
 
 #include "ShaderBase.h"
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -28,9 +29,27 @@ extern "C" {
  * C API surface for the Ignite shader compiler.
  * - Compile shader files to target bytecode formats.
  * - Reflect SPIR-V and DXIL binaries into plain C structs.
- * - Release reflection allocations via IgniteCompiler_FreeReflectionInfo.
+ * - Release reflection results via IgniteCompiler_FreeReflectionInfo (one block per result),
+ *   or reflect into caller memory with the *ToBuffer variants.
+ * - Look up blobs in memory-mapped shader archives.
  */
 
+/* Options for one SPIR-V cross-compile target; zero-initialized fields pick the defaults. */
+typedef struct IgniteCrossCompileOptions
+{
+    IGNITE_CrossCompileTarget target;
+    uint32_t version; /* GLSL/ESSL #version, HLSL shader model (50, 60, ...), MSL major * 10000 + minor * 100 */
+    int vulkanSemantics; /* GLSL: emit Vulkan GLSL */
+    int plainUniforms; /* GLSL/ESSL: emit uniform buffers as plain uniforms */
+    int fixupClipSpace; /* convert clip-space depth from [0, w] to [-w, w] */
+    int flipVertexY;
+    int mslIOS; /* MSL: target iOS instead of macOS */
+    int mslArgumentBuffers;
+} IgniteCrossCompileOptions;
+
+/* Opaque handle to a cache of compiled SPIR-V library modules. */
+typedef struct IgniteShaderLibraryCache IgniteShaderLibraryCache;
+
 /* Input parameters for one compile invocation. */
 typedef struct IgniteCompileRequest
 {
@@ -59,6 +78,18 @@ typedef struct IgniteCompileRequest
         uint32_t rRegShift;
     };
     uint32_t uRegShift;
+    IGNITE_SPIRVOptimizerRecipe spirvOptimizer; /* DEFAULT (0) follows optimizationLevel */
+    const char* const* spirvOptimizerPasses; /* spirv-opt flags for IGNITE_SPIRV_OPTIMIZER_RECIPE_CUSTOM */
+    size_t spirvOptimizerPassCount;
+    int remapIds; /* SPIR-V: canonical ids and declaration order for compression and deduplication */
+    int stripDebugInfo; /* SPIR-V: drop names, source, line and NonSemantic debug info */
+    int debugSidecar; /* with stripDebugInfo, write the removed debug info to "<output>.spvdbg" */
+    const IgniteCrossCompileOptions* crossCompileTargets; /* SPIR-V: also write these sources next to the output */
+    size_t crossCompileTargetCount;
+    int spirvLibrary; /* SPIR-V: compile a library module (lib profile, no entry point) that keeps its exports */
+    const char* const* spirvLibraries; /* SPIR-V: library sources linked into the output before optimization; the shader compiles with the lib profile */
+    size_t spirvLibraryCount;
+    IgniteShaderLibraryCache* libraryCache; /* optional: compile each of spirvLibraries once */
 } IgniteCompileRequest;
 
 /* Reflected vertex attribute metadata. */
@@ -71,14 +102,51 @@ typedef struct IgniteVertexAttribute
     uint32_t elementStride;
 } IgniteVertexAttribute;
 
-/* Generic reflected resource (UBO/image/buffer/sampler). */
+/* One vertex buffer of the reflected input layout; stepRate counts instances per element for per-instance buffers. */
+typedef struct IgniteVertexBufferLayout
+{
+    uint32_t bufferIndex;
+    uint32_t stride;
+    IGNITE_VertexInputRate inputRate;
+    uint32_t stepRate;
+} IgniteVertexBufferLayout;
+
+/* Places the vertex attribute with this name (GLSL variable or HLSL semantic plus index) in a buffer. */
+typedef struct IgniteVertexStreamAssignment
+{
+    const char* attribute;
+    uint32_t bufferIndex;
+} IgniteVertexStreamAssignment;
+
+/* Flattened buffer block member; struct members are followed by their own members with dotted names.
+   Offsets are absolute within the block; arraySize is 0 for non-arrays and runtime arrays (arrayStride != 0). */
+typedef struct IgniteShaderBufferMember
+{
+    char* name;
+    IGNITE_ShaderDataType type;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t vecSize;
+    uint32_t columns;
+    uint32_t arraySize;
+    uint32_t arrayStride;
+    uint32_t matrixStride;
+    uint32_t depth;
+    int rowMajor;
+} IgniteShaderBufferMember;
+
+/* Generic reflected resource (UBO/image/buffer/sampler). size and members are set for UBOs/storage buffers. */
 typedef struct IgniteShaderResourceInfo
 {
     char* name;
     uint32_t id;
     uint32_t set;
     uint32_t binding;
-    uint32_t count;
+    uint32_t count; /* product of array dimensions; 0 when unbounded */
+    int unbounded; /* runtime-sized descriptor array */
+    uint32_t size;
+    size_t memberCount;
+    IgniteShaderBufferMember* members;
 } IgniteShaderResourceInfo;
 
 /* Reflected stage input/output entry metadata. */
@@ -87,6 +155,7 @@ typedef struct IgniteShaderStageIOInfo
     char* name;
     uint32_t id;
     uint32_t location;
+    uint32_t component;
     IGNITE_VertexElementFormat format;
     uint32_t vecSize;
     uint32_t columns;
@@ -97,8 +166,31 @@ typedef struct IgniteShaderPushConstantInfo
 {
     char* name;
     uint32_t size;
+    size_t memberCount;
+    IgniteShaderBufferMember* members;
 } IgniteShaderPushConstantInfo;
 
+/* Reflected scalar specialization constant; defaultValue holds the raw bits (booleans are 0/1). */
+typedef struct IgniteShaderSpecializationConstant
+{
+    char* name;
+    uint32_t id;
+    uint32_t constantId;
+    IGNITE_ShaderDataType type;
+    uint64_t defaultValue;
+} IgniteShaderSpecializationConstant;
+
+/* Workgroup metadata (compute, task and mesh stages); zeroed for other stages.
+   localSizeSpecialized[i] != 0 means dimension i comes from specialization constant localSizeSpecIds[i].
+   sharedMemorySize is the std430 size of Workgroup variables (SPIR-V only). */
+typedef struct IgniteShaderComputeInfo
+{
+    uint32_t localSize[3];
+    int localSizeSpecialized[3];
+    uint32_t localSizeSpecIds[3];
+    uint32_t sharedMemorySize;
+} IgniteShaderComputeInfo;
+
 /* Aggregate reflection result for one shader binary. */
 typedef struct IgniteShaderReflectionInfo
 {
@@ -113,6 +205,7 @@ typedef struct IgniteShaderReflectionInfo
     size_t numPushConstants;
     size_t numStageInputs;
     size_t numStageOutputs;
+    size_t numSpecializationConstants;
 
     IgniteShaderResourceInfo* uniformBuffers;
     IgniteShaderResourceInfo* sampledImages;
@@ -125,8 +218,146 @@ typedef struct IgniteShaderReflectionInfo
     IgniteShaderStageIOInfo* stageOutputs;
     IgniteVertexAttribute* vertexAttributes;
     size_t vertexAttributeCount;
+    IgniteVertexBufferLayout* vertexBuffers; /* sorted by bufferIndex; room for vertexAttributeCount entries */
+    size_t vertexBufferCount;
+    IgniteShaderSpecializationConstant* specializationConstants;
+    IgniteShaderComputeInfo compute;
+
+    /* Every array and name above lives in one block: arrays first, then a string pool.
+       arena is the library-owned block (NULL for *ToBuffer results); arenaSize is its used size. */
+    void* arena;
+    size_t arenaSize;
 } IgniteShaderReflectionInfo;
 
+/* Compiled blob plus reflection; release with IgniteCompiler_FreeCompiledShader. */
+typedef struct IgniteCompiledShader
+{
+    uint8_t* code;
+    size_t codeSize;
+    IgniteShaderReflectionInfo reflection;
+} IgniteCompiledShader;
+
+/* Value baked into a specialization constant, as raw bits of the constant's type. */
+typedef struct IgniteSpecializationConstantValue
+{
+    uint32_t constantId;
+    uint64_t value;
+} IgniteSpecializationConstantValue;
+
+/* Library-allocated shader bytes; release with IgniteCompiler_FreeShaderBlob. */
+typedef struct IgniteShaderBlob
+{
+    uint8_t* data;
+    size_t size;
+} IgniteShaderBlob;
+
+/* One binding of a merged descriptor set layout; stageMask holds IGNITE_ShaderStageFlags bits. */
+typedef struct IgnitePipelineBinding
+{
+    char* name;
+    uint32_t binding;
+    IGNITE_DescriptorType descriptorType;
+    uint32_t count;
+    int unbounded;
+    uint32_t stageMask;
+    uint32_t size;
+} IgnitePipelineBinding;
+
+typedef struct IgnitePipelineDescriptorSet
+{
+    uint32_t set;
+    size_t bindingCount;
+    IgnitePipelineBinding* bindings;
+} IgnitePipelineDescriptorSet;
+
+typedef struct IgnitePushConstantRange
+{
+    uint32_t stageMask;
+    uint32_t offset;
+    uint32_t size;
+} IgnitePushConstantRange;
+
+typedef struct IgnitePipelineLayoutDiagnostic
+{
+    IGNITE_LogType type;
+    char* message;
+} IgnitePipelineLayoutDiagnostic;
+
+/* Layout merged from several stage reflections; release with IgniteCompiler_FreePipelineLayout.
+   valid is zero when a diagnostic is an error. hash only covers compatibility-relevant fields. */
+typedef struct IgnitePipelineLayout
+{
+    size_t setCount;
+    IgnitePipelineDescriptorSet* sets;
+    size_t pushConstantRangeCount;
+    IgnitePushConstantRange* pushConstantRanges;
+    size_t diagnosticCount;
+    IgnitePipelineLayoutDiagnostic* diagnostics;
+    uint64_t hash;
+    int valid;
+
+    void* arena;
+    size_t arenaSize;
+} IgnitePipelineLayout;
+
+typedef struct IgniteStageLinkDiagnostic
+{
+    IGNITE_LogType type;
+    char* message;
+} IgniteStageLinkDiagnostic;
+
+/* Result of linking two SPIR-V stages; release with IgniteCompiler_FreeStageLinkResult.
+   producer holds the rewritten producer (producerSize 0 when an input is invalid or the interface
+   mismatches); valid is zero when a diagnostic is an error. */
+typedef struct IgniteStageLinkResult
+{
+    uint8_t* producer;
+    size_t producerSize;
+    size_t removedOutputCount;
+    IgniteShaderStageIOInfo* removedOutputs;
+    size_t diagnosticCount;
+    IgniteStageLinkDiagnostic* diagnostics;
+    int valid;
+
+    void* arena;
+    size_t arenaSize;
+} IgniteStageLinkResult;
+
+/* Both stages with their small varyings packed into shared locations; release with
+   IgniteCompiler_FreeVaryingPackResult. producerOutputs/consumerInputs reflect the packed modules;
+   locationsBefore/After count the locations used by the packable varyings. */
+typedef struct IgniteVaryingPackResult
+{
+    uint8_t* producer;
+    size_t producerSize;
+    uint8_t* consumer;
+    size_t consumerSize;
+    size_t producerOutputCount;
+    IgniteShaderStageIOInfo* producerOutputs;
+    size_t consumerInputCount;
+    IgniteShaderStageIOInfo* consumerInputs;
+    uint32_t locationsBefore;
+    uint32_t locationsAfter;
+    size_t diagnosticCount;
+    IgniteStageLinkDiagnostic* diagnostics;
+    int valid;
+
+    void* arena;
+    size_t arenaSize;
+} IgniteVaryingPackResult;
+
+/* Opaque handle to a memory-mapped shader archive. */
+typedef struct IgniteShaderArchive IgniteShaderArchive;
+
+/* Read-only view into archive memory, valid until the archive is closed. */
+typedef struct IgniteShaderBlobView
+{
+    const uint8_t* data;
+    size_t size;
+    const uint8_t* reflection;
+    size_t reflectionSize;
+} IgniteShaderBlobView;
+
 /* Callback signature for compiler/reflection log forwarding. */
 typedef void(*IgniteLogCallback)(IGNITE_LogType type, const char* message, void* userData);
 
@@ -139,15 +370,109 @@ IGNITECOMPILER_CAPI void IgniteCompiler_SetLogCallback(IgniteLogCallback callbac
 /* Compiles an input shader file to request->platformType output. */
 IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_Compile(const IgniteCompileRequest* request);
 
+/* Compiles like IgniteCompiler_Compile and reflects the in-memory result in the same call. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_CompileAndReflect(const IgniteCompileRequest* request, IgniteCompiledShader* outShader);
+
+/* Releases the blob and reflection stored in IgniteCompiledShader. */
+IGNITECOMPILER_CAPI void IgniteCompiler_FreeCompiledShader(IgniteCompiledShader* shader);
+
 /* Reflects SPIR-V words and fills outReflectionInfo. */
 IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_ReflectSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo);
 
+/* Selects the SPIR-V reflection backend (native parser by default, SPIRV-Cross as reference). */
+IGNITECOMPILER_CAPI void IgniteCompiler_SetSPIRVReflectionBackend(IGNITE_SPIRVReflectionBackend backend);
+
 /* Reflects DXIL bytes and fills outReflectionInfo. */
 IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_ReflectDXIL(const uint8_t* dxilData, size_t sizeInBytes, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo);
 
-/* Releases heap allocations stored in IgniteShaderReflectionInfo. */
+/* Reflects into a caller-supplied, pointer-aligned buffer that stays owned by the caller.
+   *outRequiredSize receives the needed size; IGNITE_RESULT_BUFFER_TOO_SMALL if bufferSize is short. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_ReflectSPIRVToBuffer(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_ShaderType shaderType, void* buffer, size_t bufferSize, size_t* outRequiredSize, IgniteShaderReflectionInfo* outReflectionInfo);
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_ReflectDXILToBuffer(const uint8_t* dxilData, size_t sizeInBytes, IGNITE_ShaderType shaderType, void* buffer, size_t bufferSize, size_t* outRequiredSize, IgniteShaderReflectionInfo* outReflectionInfo);
+
+/* Reassigns the reflected vertex attributes to buffers and recomputes offsets, strides and vertexBuffers in place.
+   Unlisted attributes go to buffer 0; buffers missing from buffers advance per vertex (stride is ignored there). */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_AssignVertexStreams(IgniteShaderReflectionInfo* reflectionInfo, const IgniteVertexStreamAssignment* assignments, size_t assignmentCount, const IgniteVertexBufferLayout* buffers, size_t bufferCount);
+
+/* Releases the single allocation backing IgniteShaderReflectionInfo (no-op for *ToBuffer results). */
 IGNITECOMPILER_CAPI void IgniteCompiler_FreeReflectionInfo(IgniteShaderReflectionInfo* reflectionInfo);
 
+/* Bakes specialization constant values into a SPIR-V module and folds the code depending on them
+   (plus the performance passes when optimize is non-zero). Constants without a value keep their default. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_SpecializeSPIRV(const uint32_t* spirvData, size_t sizeInBytes, const IgniteSpecializationConstantValue* values, size_t valueCount, int optimize, IgniteShaderBlob* outBlob);
+
+/* Runs a spirv-opt recipe over a SPIR-V module in process. DEFAULT means PERFORMANCE; CUSTOM runs the given pass flags.
+   Release the result with IgniteCompiler_FreeShaderBlob. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_OptimizeSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_SPIRVOptimizerRecipe recipe, const char* const* passes, size_t passCount, IgniteShaderBlob* outBlob);
+
+/* Canonicalizes ids and declaration/function order of a SPIR-V module, like spirv-remap.
+   Release the result with IgniteCompiler_FreeShaderBlob. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_RemapSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IgniteShaderBlob* outBlob);
+
+/* Strips debug info from a SPIR-V module. outSidecar (optional) receives the original module behind a header
+   that links it to the stripped one by content hash. Release both with IgniteCompiler_FreeShaderBlob. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_StripSPIRVDebugInfo(const uint32_t* spirvData, size_t sizeInBytes, IgniteShaderBlob* outStripped, IgniteShaderBlob* outSidecar);
+
+/* Reflects a stripped SPIR-V module, taking names from its debug sidecar when the sidecar matches. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_ReflectSPIRVWithDebugSidecar(const uint32_t* spirvData, size_t sizeInBytes, const uint8_t* sidecarData, size_t sidecarSize, IGNITE_ShaderType shaderType, IgniteShaderReflectionInfo* outReflectionInfo);
+
+/* Emits GLSL, ESSL, HLSL or MSL sources from a SPIR-V module with SPIRV-Cross, parsing the module once for all targets.
+   outSources receives targetCount NUL-terminated sources (size excludes the terminator); failed targets stay empty and
+   make the call return IGNITE_RESULT_COMPILATION_FAILED. outReflection (optional) is filled from the same parse; with
+   targetCount 0 the call only reflects and fails only if the module cannot be parsed.
+   Release each source with IgniteCompiler_FreeShaderBlob and the reflection with IgniteCompiler_FreeReflectionInfo. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_CrossCompileSPIRV(const uint32_t* spirvData, size_t sizeInBytes, IGNITE_ShaderType shaderType,
+    const IgniteCrossCompileOptions* targets, size_t targetCount, IgniteShaderBlob* outSources, IgniteShaderReflectionInfo* outReflection);
+
+/* Links SPIR-V modules like spirv-link, resolving Import LinkageAttributes against Exports of the same name and type.
+   Unless createLibrary is non-zero, unresolved imports fail and the result is an executable module without linkage
+   decorations or unreachable functions. Release the result with IgniteCompiler_FreeShaderBlob. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_LinkSPIRV(const uint32_t* const* modules, const size_t* sizesInBytes, size_t moduleCount, int createLibrary, IgniteShaderBlob* outBlob);
+
+/* Creates a thread-safe LRU cache of library modules for IgniteCompileRequest::libraryCache. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_CreateLibraryCache(size_t maxEntries, IgniteShaderLibraryCache** outCache);
+
+/* Destroys a library cache; no compile may be using it. */
+IGNITECOMPILER_CAPI void IgniteCompiler_DestroyLibraryCache(IgniteShaderLibraryCache* cache);
+
+/* Releases bytes returned in an IgniteShaderBlob. */
+IGNITECOMPILER_CAPI void IgniteCompiler_FreeShaderBlob(IgniteShaderBlob* blob);
+
+/* Classifies how the interface changed between two reflections of a shader, as IGNITE_ReflectionChangeFlags bits.
+   The CompiledShaders variant also sets IGNITE_REFLECTION_CHANGE_CODE when the blobs differ. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_DiffReflection(const IgniteShaderReflectionInfo* oldInfo, const IgniteShaderReflectionInfo* newInfo, uint32_t* outChanges);
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_DiffCompiledShaders(const IgniteCompiledShader* oldShader, const IgniteCompiledShader* newShader, uint32_t* outChanges);
+
+/* Merges the bindings and push constants of several stage reflections into one pipeline layout. platformType is the
+   bytecode the reflections came from; for DXIL and DXBC, bindings of different register classes never collide. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_BuildPipelineLayout(const IgniteShaderReflectionInfo* const* stages, size_t stageCount, IGNITE_ShaderPlatformType platformType, IgnitePipelineLayout* outLayout);
+
+/* Releases the single allocation backing IgnitePipelineLayout. */
+IGNITECOMPILER_CAPI void IgniteCompiler_FreePipelineLayout(IgnitePipelineLayout* layout);
+
+/* Checks the producer outputs against the consumer inputs and removes producer outputs (and the code
+   computing them) that the consumer never reads. Interface mismatches are reported in outResult. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_LinkStages(IGNITE_ShaderType producerType, const uint32_t* producerData, size_t producerSize, IGNITE_ShaderType consumerType, const uint32_t* consumerData, size_t consumerSize, IgniteStageLinkResult* outResult);
+
+/* Releases the single allocation backing IgniteStageLinkResult. */
+IGNITECOMPILER_CAPI void IgniteCompiler_FreeStageLinkResult(IgniteStageLinkResult* result);
+
+/* Packs scalar, vec2 and vec3 varyings of a stage feeding a fragment shader into shared vec4 locations
+   (Location + Component aliasing), rewriting both modules consistently. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_PackVaryings(IGNITE_ShaderType producerType, const uint32_t* producerData, size_t producerSize, IGNITE_ShaderType consumerType, const uint32_t* consumerData, size_t consumerSize, IgniteVaryingPackResult* outResult);
+
+/* Releases the single allocation backing IgniteVaryingPackResult. */
+IGNITECOMPILER_CAPI void IgniteCompiler_FreeVaryingPackResult(IgniteVaryingPackResult* result);
+
+/* Memory-maps a shader archive written by ignite::ShaderArchiveWriter. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_OpenArchive(const char* path, IgniteShaderArchive** outArchive);
+
+/* Looks up one shader variant; returns IGNITE_RESULT_NOT_FOUND when the key is absent. */
+IGNITECOMPILER_CAPI IGNITE_ResultCode IgniteCompiler_FindArchiveShader(const IgniteShaderArchive* archive, const char* name, IGNITE_ShaderType shaderType, IGNITE_ShaderPlatformType platformType, uint32_t permutationId, IgniteShaderBlobView* outView);
+
+/* Unmaps the archive; blob views obtained from it become invalid. */
+IGNITECOMPILER_CAPI void IgniteCompiler_CloseArchive(IgniteShaderArchive* archive);
+
 #ifdef __cplusplus
 }
 #endif
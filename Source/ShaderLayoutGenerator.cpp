@@ -0,0 +1,461 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "ShaderLayoutGenerator.h"
+#include "ShaderLog.h"
+
+#include <algorithm>
+#include <cctype>
+#include <unordered_set>
+
+namespace ignite
+{
+    namespace
+    {
+        // Reflected names are mostly valid identifiers already; anything else becomes '_'.
+        std::string ToIdentifier(const std::string& name)
+        {
+            std::string identifier = name;
+            for (char& ch : identifier)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(ch)))
+                {
+                    ch = '_';
+                }
+            }
+
+            if (identifier.empty() || std::isdigit(static_cast<unsigned char>(identifier[0])))
+            {
+                identifier.insert(identifier.begin(), '_');
+            }
+            return identifier;
+        }
+
+        // Field name of a flattened member: the last component of its dotted path.
+        std::string FieldName(const std::string& path)
+        {
+            const size_t dot = path.rfind('.');
+            return ToIdentifier(dot == std::string::npos ? path : path.substr(dot + 1));
+        }
+
+        uint32_t ScalarSize(IGNITE_ShaderDataType type)
+        {
+            switch (type)
+            {
+            case IGNITE_SHADER_DATA_TYPE_INT8:
+            case IGNITE_SHADER_DATA_TYPE_UINT8: return 1;
+            case IGNITE_SHADER_DATA_TYPE_INT16:
+            case IGNITE_SHADER_DATA_TYPE_UINT16:
+            case IGNITE_SHADER_DATA_TYPE_HALF: return 2;
+            case IGNITE_SHADER_DATA_TYPE_BOOL:
+            case IGNITE_SHADER_DATA_TYPE_INT:
+            case IGNITE_SHADER_DATA_TYPE_UINT:
+            case IGNITE_SHADER_DATA_TYPE_FLOAT: return 4;
+            case IGNITE_SHADER_DATA_TYPE_INT64:
+            case IGNITE_SHADER_DATA_TYPE_UINT64:
+            case IGNITE_SHADER_DATA_TYPE_DOUBLE: return 8;
+            default: return 0;
+            }
+        }
+
+        // Buffer booleans are 32-bit and halves are stored as their raw bits.
+        const char* ScalarTypeName(IGNITE_ShaderDataType type)
+        {
+            switch (type)
+            {
+            case IGNITE_SHADER_DATA_TYPE_BOOL: return "uint32_t";
+            case IGNITE_SHADER_DATA_TYPE_INT8: return "int8_t";
+            case IGNITE_SHADER_DATA_TYPE_UINT8: return "uint8_t";
+            case IGNITE_SHADER_DATA_TYPE_INT16: return "int16_t";
+            case IGNITE_SHADER_DATA_TYPE_UINT16: return "uint16_t";
+            case IGNITE_SHADER_DATA_TYPE_HALF: return "uint16_t";
+            case IGNITE_SHADER_DATA_TYPE_INT: return "int32_t";
+            case IGNITE_SHADER_DATA_TYPE_UINT: return "uint32_t";
+            case IGNITE_SHADER_DATA_TYPE_FLOAT: return "float";
+            case IGNITE_SHADER_DATA_TYPE_INT64: return "int64_t";
+            case IGNITE_SHADER_DATA_TYPE_UINT64: return "uint64_t";
+            case IGNITE_SHADER_DATA_TYPE_DOUBLE: return "double";
+            default: return "uint8_t";
+            }
+        }
+
+        const char* ShaderTypeName(IGNITE_ShaderDataType type)
+        {
+            switch (type)
+            {
+            case IGNITE_SHADER_DATA_TYPE_BOOL: return "bool";
+            case IGNITE_SHADER_DATA_TYPE_INT8: return "int8";
+            case IGNITE_SHADER_DATA_TYPE_UINT8: return "uint8";
+            case IGNITE_SHADER_DATA_TYPE_INT16: return "int16";
+            case IGNITE_SHADER_DATA_TYPE_UINT16: return "uint16";
+            case IGNITE_SHADER_DATA_TYPE_INT: return "int";
+            case IGNITE_SHADER_DATA_TYPE_UINT: return "uint";
+            case IGNITE_SHADER_DATA_TYPE_INT64: return "int64";
+            case IGNITE_SHADER_DATA_TYPE_UINT64: return "uint64";
+            case IGNITE_SHADER_DATA_TYPE_HALF: return "half";
+            case IGNITE_SHADER_DATA_TYPE_FLOAT: return "float";
+            case IGNITE_SHADER_DATA_TYPE_DOUBLE: return "double";
+            case IGNITE_SHADER_DATA_TYPE_STRUCT: return "struct";
+            default: return "unknown";
+            }
+        }
+
+        // Shader-side spelling used in field comments, e.g. "float4x4 row_major".
+        std::string DescribeMember(const ShaderBufferMember& member)
+        {
+            std::string text = ShaderTypeName(member.type);
+            if (member.columns > 1)
+            {
+                text += std::to_string(member.vecSize) + "x" + std::to_string(member.columns);
+                text += member.rowMajor ? " row_major" : " column_major";
+            }
+            else if (member.vecSize > 1)
+            {
+                text += std::to_string(member.vecSize);
+            }
+
+            if (member.arraySize > 0)
+            {
+                text += "[" + std::to_string(member.arraySize) + "]";
+            }
+            else if (member.arrayStride > 0)
+            {
+                text += "[]";
+            }
+            return text;
+        }
+
+        struct MemberNode
+        {
+            const ShaderBufferMember* member = nullptr;
+            std::vector<MemberNode> children;
+        };
+
+        // Rebuilds the member tree from the depth-first flattened list.
+        std::vector<MemberNode> BuildTree(const std::vector<ShaderBufferMember>& members, size_t& index, uint32_t depth)
+        {
+            std::vector<MemberNode> nodes;
+            while (index < members.size() && members[index].depth >= depth)
+            {
+                if (members[index].depth > depth)
+                {
+                    ++index; // child without a parent entry
+                    continue;
+                }
+
+                MemberNode node;
+                node.member = &members[index++];
+                node.children = BuildTree(members, index, depth + 1);
+                nodes.push_back(std::move(node));
+            }
+
+            std::stable_sort(nodes.begin(), nodes.end(), [](const MemberNode& a, const MemberNode& b) {
+                return a.member->offset < b.member->offset;
+            });
+            return nodes;
+        }
+
+        // Makes type names unique within the generated header.
+        std::string UniqueName(const std::string& base, std::unordered_set<std::string>& used)
+        {
+            std::string name = base;
+            for (uint32_t suffix = 1; !used.insert(name).second; ++suffix)
+            {
+                name = base + "_" + std::to_string(suffix);
+            }
+            return name;
+        }
+
+        class LayoutWriter
+        {
+        public:
+            LayoutWriter(std::string indent, std::unordered_set<std::string>& usedNames)
+                : m_indent(std::move(indent))
+                , m_usedNames(usedNames)
+            {
+            }
+
+            // Emits a struct covering [baseOffset, baseOffset + size) of the block, nested types first.
+            // Returns the struct's alignment.
+            uint32_t EmitStruct(const std::string& typeName, const std::vector<MemberNode>& nodes, uint32_t baseOffset, uint32_t size, const std::string& constants)
+            {
+                return BuildStruct(typeName, nodes, baseOffset, size, constants, m_text);
+            }
+
+            const std::string& GetText() const { return m_text; }
+
+        private:
+            // Appends the struct and the nested types it uses to text. Returns the struct's alignment.
+            uint32_t BuildStruct(const std::string& typeName, const std::vector<MemberNode>& nodes, uint32_t baseOffset, uint32_t size,
+                const std::string& constants, std::string& text)
+            {
+                struct Field
+                {
+                    std::string declaration;
+                    std::string name;
+                    std::string comment;
+                    uint32_t offset = 0;
+                };
+
+                std::vector<Field> fields;
+                std::string nestedTypes;
+                uint32_t cursor = 0;
+                uint32_t alignment = 1;
+                uint32_t padCount = 0;
+
+                auto addPadding = [&](uint32_t bytes) {
+                    Field& pad = fields.emplace_back();
+                    pad.name = "_pad" + std::to_string(padCount++);
+                    pad.declaration = "uint8_t " + pad.name + "[" + std::to_string(bytes) + "];";
+                    pad.offset = cursor;
+                    cursor += bytes;
+                };
+
+                for (size_t i = 0; i < nodes.size(); ++i)
+                {
+                    const ShaderBufferMember& member = *nodes[i].member;
+                    const uint32_t offset = member.offset - baseOffset;
+                    const uint32_t limit = i + 1 < nodes.size() ? nodes[i + 1].member->offset - baseOffset : size;
+                    if (member.offset < baseOffset || offset < cursor)
+                    {
+                        DispatchLog(IGNITE_LOG_TYPE_WARNING, "Layout header: " + typeName + "." + member.name + " overlaps the previous member; skipped.");
+                        continue;
+                    }
+
+                    if (offset > cursor)
+                    {
+                        addPadding(offset - cursor);
+                    }
+
+                    Field field;
+                    field.name = FieldName(member.name);
+                    field.offset = offset;
+                    field.comment = "offset " + std::to_string(offset) + ", " + DescribeMember(member);
+
+                    uint32_t fieldAlignment = 1;
+                    uint32_t fieldSize = 0;
+                    if (!DeclareField(typeName, nodes[i], member, limit - offset, field.name, field.declaration, fieldSize, fieldAlignment, nestedTypes))
+                    {
+                        field.declaration = "uint8_t " + field.name + "[" + std::to_string(member.size) + "];";
+                        field.comment += " (raw bytes)";
+                        fieldSize = member.size;
+                        fieldAlignment = 1;
+                    }
+
+                    alignment = std::max(alignment, fieldAlignment);
+                    cursor = offset + fieldSize;
+                    fields.push_back(std::move(field));
+                }
+
+                // sizeof rounds up to the strictest member; the tail padding reflects that.
+                const uint32_t paddedSize = (std::max(size, cursor) + alignment - 1) / alignment * alignment;
+                if (cursor < paddedSize)
+                {
+                    addPadding(paddedSize - cursor);
+                }
+
+                text += nestedTypes;
+                text += m_indent + "struct " + typeName + "\n";
+                text += m_indent + "{\n";
+                if (!constants.empty())
+                {
+                    text += constants + "\n";
+                }
+                for (const Field& field : fields)
+                {
+                    text += m_indent + "    " + field.declaration;
+                    if (!field.comment.empty())
+                    {
+                        text += " // " + field.comment;
+                    }
+                    text += "\n";
+                }
+                text += m_indent + "};\n";
+
+                text += m_indent + "static_assert(sizeof(" + typeName + ") == " + std::to_string(paddedSize) + ", \"" + typeName + " size mismatch\");\n";
+                for (const Field& field : fields)
+                {
+                    if (field.comment.empty())
+                    {
+                        continue; // padding
+                    }
+                    text += m_indent + "static_assert(offsetof(" + typeName + ", " + field.name + ") == " + std::to_string(field.offset)
+                        + ", \"" + typeName + "::" + field.name + " offset mismatch\");\n";
+                }
+                text += "\n";
+                return alignment;
+            }
+
+            // Builds the declaration for one member within `available` bytes. Returns false to fall back to raw bytes.
+            // A struct member's type definition is appended to nestedTypes only once it is known to fit.
+            bool DeclareField(const std::string& ownerType, const MemberNode& node, const ShaderBufferMember& member, uint32_t available,
+                const std::string& name, std::string& declaration, uint32_t& size, uint32_t& alignment, std::string& nestedTypes)
+            {
+                const bool isArray = member.arraySize > 0;
+                if (!isArray && member.arrayStride > 0)
+                {
+                    return false; // runtime-sized
+                }
+
+                const std::string arrayDims = isArray ? "[" + std::to_string(member.arraySize) + "]" : std::string();
+
+                if (member.type == IGNITE_SHADER_DATA_TYPE_STRUCT)
+                {
+                    const uint32_t elementSize = isArray ? member.arrayStride : member.size;
+                    size = isArray ? member.arraySize * member.arrayStride : member.size;
+                    if (elementSize == 0 || size > available)
+                    {
+                        return false;
+                    }
+
+                    const std::string nestedType = UniqueName(ownerType + "_" + name, m_usedNames);
+                    std::string definition;
+                    alignment = BuildStruct(nestedType, node.children, member.offset, elementSize, std::string(), definition);
+                    if (elementSize % alignment != 0)
+                    {
+                        return false;
+                    }
+
+                    nestedTypes += definition;
+                    declaration = nestedType + " " + name + arrayDims + ";";
+                    return true;
+                }
+
+                const uint32_t scalarSize = ScalarSize(member.type);
+                if (scalarSize == 0)
+                {
+                    return false;
+                }
+
+                std::string elementDims;
+                uint32_t elementSize = scalarSize;
+                if (member.columns > 1)
+                {
+                    const uint32_t major = member.rowMajor ? member.vecSize : member.columns;
+                    if (member.matrixStride == 0 || member.matrixStride % scalarSize != 0)
+                    {
+                        return false;
+                    }
+                    elementDims = "[" + std::to_string(major) + "][" + std::to_string(member.matrixStride / scalarSize) + "]";
+                    elementSize = major * member.matrixStride;
+                }
+                else if (member.vecSize > 1)
+                {
+                    elementDims = "[" + std::to_string(member.vecSize) + "]";
+                    elementSize = member.vecSize * scalarSize;
+                }
+
+                if (isArray && member.arrayStride != elementSize)
+                {
+                    // Padded elements (std140 scalars/vectors, HLSL cbuffer arrays): widen each element to the stride.
+                    if (member.columns > 1 || member.arrayStride < elementSize || member.arrayStride % scalarSize != 0)
+                    {
+                        return false;
+                    }
+                    elementDims = "[" + std::to_string(member.arrayStride / scalarSize) + "]";
+                    elementSize = member.arrayStride;
+                }
+
+                size = isArray ? member.arraySize * elementSize : elementSize;
+                if (size > available)
+                {
+                    return false;
+                }
+
+                alignment = scalarSize;
+                declaration = std::string(ScalarTypeName(member.type)) + " " + name + arrayDims + elementDims + ";";
+                return true;
+            }
+
+            std::string m_indent;
+            std::unordered_set<std::string>& m_usedNames;
+            std::string m_text;
+        };
+    }
+
+    std::string GenerateLayoutHeader(const ShaderReflectionInfo& info, const LayoutHeaderOptions& options)
+    {
+        const bool hasBlocks = !info.uniformBuffers.empty() || !info.pushConstants.empty();
+        const bool hasBindings = hasBlocks || !info.sampledImages.empty() || !info.storageImages.empty() || !info.storageBuffers.empty()
+            || !info.separateSamplers.empty() || !info.separateImages.empty();
+        if (!hasBindings)
+        {
+            return {};
+        }
+
+        const std::string indent = options.namespaceName.empty() ? std::string() : std::string("    ");
+        std::unordered_set<std::string> usedNames;
+        LayoutWriter writer(indent, usedNames);
+
+        // Block names are reserved before any nested type is named, so nested types yield to them.
+        std::vector<std::string> blockNames;
+        for (const ShaderResourceInfo& buffer : info.uniformBuffers)
+        {
+            blockNames.push_back(UniqueName(ToIdentifier(buffer.name), usedNames));
+        }
+        for (const ShaderPushConstantInfo& pushConstant : info.pushConstants)
+        {
+            blockNames.push_back(UniqueName(ToIdentifier(pushConstant.name), usedNames));
+        }
+
+        size_t blockIndex = 0;
+        for (const ShaderResourceInfo& buffer : info.uniformBuffers)
+        {
+            size_t index = 0;
+            const std::vector<MemberNode> tree = BuildTree(buffer.members, index, 0);
+            const std::string constants =
+                indent + "    static constexpr uint32_t kSet = " + std::to_string(buffer.set) + ";\n" +
+                indent + "    static constexpr uint32_t kBinding = " + std::to_string(buffer.binding) + ";\n";
+            writer.EmitStruct(blockNames[blockIndex++], tree, 0, buffer.size, constants);
+        }
+
+        for (const ShaderPushConstantInfo& pushConstant : info.pushConstants)
+        {
+            size_t index = 0;
+            const std::vector<MemberNode> tree = BuildTree(pushConstant.members, index, 0);
+            writer.EmitStruct(blockNames[blockIndex++], tree, 0, pushConstant.size, std::string());
+        }
+
+        // Bindings is its own namespace, so its names only need to be unique among themselves.
+        std::string bindings;
+        std::unordered_set<std::string> usedBindingNames;
+        auto addBindings = [&](const std::vector<ShaderResourceInfo>& resources) {
+            for (const ShaderResourceInfo& resource : resources)
+            {
+                bindings += indent + "    struct " + UniqueName(ToIdentifier(resource.name), usedBindingNames) + " { static constexpr uint32_t kSet = " + std::to_string(resource.set)
+                    + "; static constexpr uint32_t kBinding = " + std::to_string(resource.binding)
+                    + "; static constexpr uint32_t kCount = " + std::to_string(resource.count) + "; };\n";
+            }
+        };
+        addBindings(info.sampledImages);
+        addBindings(info.storageImages);
+        addBindings(info.storageBuffers);
+        addBindings(info.separateSamplers);
+        addBindings(info.separateImages);
+
+        std::string text;
+        text += "// Generated from " + (options.sourceName.empty() ? std::string("shader reflection") : options.sourceName)
+            + " (" + IGNITE_GetShaderTypeString(info.shaderType) + "). Do not edit.\n";
+        text += "#pragma once\n\n";
+        text += "#include <cstddef>\n";
+        text += "#include <cstdint>\n\n";
+        if (!options.namespaceName.empty())
+        {
+            text += "namespace " + options.namespaceName + "\n{\n";
+        }
+
+        text += writer.GetText();
+        if (!bindings.empty())
+        {
+            text += indent + "namespace Bindings\n";
+            text += indent + "{\n";
+            text += bindings;
+            text += indent + "}\n";
+        }
+
+        if (!options.namespaceName.empty())
+        {
+            text += "}\n";
+        }
+        return text;
+    }
+}
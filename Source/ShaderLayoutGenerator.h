@@ -0,0 +1,36 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_LAYOUT_GENERATOR_H
+#define _SHADER_LAYOUT_GENERATOR_H
+
+#pragma once
+
+#include "ShaderCompiler.h"
+
+namespace ignite
+{
+    /*
+     * C++ header generation from reflected buffer layouts.
+     *
+     * Every uniform buffer and push constant block becomes a POD struct whose fields sit at
+     * the reflected offsets: gaps are filled with explicit padding bytes, padded array
+     * elements are widened ("float values[4][4]" for a std140 float[4]) and every field is
+     * checked with static_assert(offsetof/sizeof). Nested structs get their own types.
+     * Descriptor set/binding numbers are emitted as constexpr values.
+     *
+     * Members the generator cannot express exactly (overlapping offsets, runtime arrays,
+     * unknown types, arrays whose last element is packed into the next member's space)
+     * are emitted as raw byte arrays so the struct layout stays exact.
+     */
+
+    struct LayoutHeaderOptions
+    {
+        std::string namespaceName = "ShaderLayout"; // empty emits at global scope
+        std::string sourceName; // shown in the header comment
+    };
+
+    // Returns the header text; empty if the reflection has no buffers to describe.
+    IGNITECOMPILER_API std::string GenerateLayoutHeader(const ShaderReflectionInfo& info, const LayoutHeaderOptions& options = {});
+}
+
+#endif
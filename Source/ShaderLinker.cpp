@@ -0,0 +1,684 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "ShaderLinker.h"
+#include "ShaderLog.h"
+#include "SPIRVModule.h"
+#include "SPIRVOptimizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+
+namespace ignite
+{
+    namespace
+    {
+        std::string DescribeIO(const ShaderStageIOInfo& io)
+        {
+            std::string text = "'" + io.name + "' (location " + std::to_string(io.location);
+            if (io.component != 0)
+            {
+                text += ", component " + std::to_string(io.component);
+            }
+            return text + ")";
+        }
+
+        bool ComponentsOverlap(const ShaderStageIOInfo& a, const ShaderStageIOInfo& b)
+        {
+            return a.location == b.location && a.component < b.component + std::max(b.vecSize, 1u)
+                && b.component < a.component + std::max(a.vecSize, 1u);
+        }
+
+        // Component type and per-component width; formats without traits (blocks) compare equal.
+        bool SameComponentType(IGNITE_VertexElementFormat a, IGNITE_VertexElementFormat b)
+        {
+            const IGNITE_VertexFormatInfo infoA = IGNITE_GetVertexFormatInfo(a);
+            const IGNITE_VertexFormatInfo infoB = IGNITE_GetVertexFormatInfo(b);
+            if (infoA.componentCount == 0 || infoB.componentCount == 0)
+            {
+                return true;
+            }
+            return infoA.componentType == infoB.componentType
+                && infoA.size / infoA.componentCount == infoB.size / infoB.componentCount;
+        }
+
+        bool IsAccessChain(SpvOp opcode)
+        {
+            return opcode == SpvOpAccessChain || opcode == SpvOpInBoundsAccessChain || opcode == SpvOpPtrAccessChain
+                || opcode == SpvOpInBoundsPtrAccessChain || opcode == SpvOpCopyObject;
+        }
+
+        // Rewrites the given Output variables into Private ones. The variables and every pointer
+        // derived from them get Private pointer types, their decorations are dropped and, before
+        // SPIR-V 1.4, they leave the entry point interface. An existing Private pointer type is
+        // reused only if it is declared before the first retyped id; otherwise a new one is
+        // declared next to the Output pointer, so no type is referenced before its declaration.
+        // Returns false if a pointer escapes into a call, phi or select, which would need its
+        // type changed elsewhere too.
+        bool DemoteOutputsToPrivate(const std::vector<uint32_t>& words, const std::set<uint32_t>& variables, std::vector<uint32_t>& output)
+        {
+            std::map<uint32_t, uint32_t> pointees; // pointer type -> pointee
+            std::map<uint32_t, uint32_t> declaredPrivate; // pointee -> Private pointer type declared so far
+            std::map<uint32_t, uint32_t> privatePointers; // pointee -> Private pointer type the retyped ids use
+            std::map<uint32_t, uint32_t> retyped; // demoted id -> pointee of its pointer type
+            bool escapes = false;
+
+            // Globals and types interleave, so a Private pointer type may follow the first use.
+            auto retype = [&](uint32_t id, uint32_t pointerType) {
+                const uint32_t pointee = pointees[pointerType];
+                retyped[id] = pointee;
+                auto declared = declaredPrivate.find(pointee);
+                if (declared != declaredPrivate.end())
+                {
+                    privatePointers.try_emplace(pointee, declared->second);
+                }
+                else
+                {
+                    privatePointers.try_emplace(pointee, 0);
+                }
+            };
+
+            const bool walked = spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                if (instruction.opcode == SpvOpTypePointer)
+                {
+                    pointees[instruction.Operand(0)] = instruction.Operand(2);
+                    if (instruction.Operand(1) == SpvStorageClassPrivate)
+                    {
+                        declaredPrivate.try_emplace(instruction.Operand(2), instruction.Operand(0));
+                    }
+                }
+                else if (instruction.opcode == SpvOpVariable && variables.count(instruction.Operand(1)))
+                {
+                    retype(instruction.Operand(1), instruction.Operand(0));
+                }
+                else if (IsAccessChain(instruction.opcode) && retyped.count(instruction.Operand(2)))
+                {
+                    retype(instruction.Operand(1), instruction.Operand(0));
+                }
+                else if (instruction.opcode == SpvOpFunctionCall || instruction.opcode == SpvOpPhi || instruction.opcode == SpvOpSelect)
+                {
+                    for (uint32_t i = 2; i + 1 < instruction.wordCount; ++i)
+                    {
+                        escapes = escapes || retyped.count(instruction.Operand(i)) != 0;
+                    }
+                }
+                return !escapes;
+            });
+            if (!walked || escapes)
+            {
+                return false;
+            }
+
+            // Missing Private pointer types (0 above) get fresh ids and are declared right after
+            // the first Output pointer to their pointee, which precedes every retyped id.
+            uint32_t bound = words[3];
+            std::map<uint32_t, std::vector<std::pair<uint32_t, uint32_t>>> declareAfter; // Output pointer -> (id, pointee)
+            spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                if (instruction.opcode == SpvOpTypePointer && instruction.Operand(1) == SpvStorageClassOutput)
+                {
+                    const uint32_t pointee = instruction.Operand(2);
+                    auto needed = privatePointers.find(pointee);
+                    if (needed != privatePointers.end() && needed->second == 0)
+                    {
+                        privatePointers[pointee] = bound;
+                        declareAfter[instruction.Operand(0)].emplace_back(bound++, pointee);
+                    }
+                }
+                return instruction.opcode != SpvOpFunction;
+            });
+
+            const bool listsPrivate = words[1] >= 0x10400;
+            output.assign(words.begin(), words.begin() + spirv::kHeaderWordCount);
+            output[3] = bound;
+            output.reserve(words.size() + declareAfter.size() * 4);
+
+            return spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                const size_t first = output.size();
+                switch (instruction.opcode)
+                {
+                case SpvOpEntryPoint:
+                {
+                    uint32_t nameWords = 0;
+                    spirv::ReadString(instruction, 3, &nameWords);
+                    output.insert(output.end(), instruction.words, instruction.words + 3 + nameWords);
+                    for (uint32_t i = 3 + nameWords; i < instruction.wordCount; ++i)
+                    {
+                        if (listsPrivate || !variables.count(instruction.words[i]))
+                        {
+                            output.push_back(instruction.words[i]);
+                        }
+                    }
+                    output[first] = (static_cast<uint32_t>(output.size() - first) << SpvWordCountShift) | SpvOpEntryPoint;
+                    return true;
+                }
+                case SpvOpDecorate:
+                case SpvOpDecorateId:
+                case SpvOpDecorateString:
+                    if (variables.count(instruction.Operand(0)))
+                    {
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+                }
+
+                output.insert(output.end(), instruction.words, instruction.words + instruction.wordCount);
+                if (instruction.opcode == SpvOpTypePointer)
+                {
+                    auto it = declareAfter.find(instruction.Operand(0));
+                    for (size_t i = 0; it != declareAfter.end() && i < it->second.size(); ++i)
+                    {
+                        output.insert(output.end(), { (4u << SpvWordCountShift) | SpvOpTypePointer, it->second[i].first, SpvStorageClassPrivate, it->second[i].second });
+                    }
+                }
+                else if ((instruction.opcode == SpvOpVariable || IsAccessChain(instruction.opcode)) && retyped.count(instruction.Operand(1)))
+                {
+                    output[first + 1] = privatePointers[retyped[instruction.Operand(1)]];
+                    if (instruction.opcode == SpvOpVariable)
+                    {
+                        output[first + 3] = SpvStorageClassPrivate;
+                    }
+                }
+                return true;
+            });
+        }
+
+        SpvExecutionModel ExecutionModel(const std::vector<uint32_t>& words)
+        {
+            SpvExecutionModel model = SpvExecutionModelMax;
+            spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                if (instruction.opcode == SpvOpEntryPoint)
+                {
+                    model = static_cast<SpvExecutionModel>(instruction.Operand(0));
+                    return false;
+                }
+                return instruction.opcode != SpvOpFunction;
+            });
+            return model;
+        }
+
+        // Global variables of struct type: I/O blocks, whose locations sit on their members.
+        std::set<uint32_t> BlockVariables(const std::vector<uint32_t>& words)
+        {
+            std::set<uint32_t> result;
+            spirv::Module module;
+            if (!spirv::ParseModule(words.data(), words.size(), module))
+            {
+                return result;
+            }
+
+            for (uint32_t variableId : module.variables)
+            {
+                const spirv::IdRecord* base = module.Find(module.BaseType(module.ids[variableId].resultType));
+                if (base && base->opcode == SpvOpTypeStruct)
+                {
+                    result.insert(variableId);
+                }
+            }
+            return result;
+        }
+
+        void AddDiagnostic(std::vector<StageLinkDiagnostic>& diagnostics, IGNITE_LogType type, std::string message)
+        {
+            DispatchLog(type, message);
+            diagnostics.push_back({ type, std::move(message) });
+        }
+
+        // Copies a blob into words; false (with a diagnostic) if it is not a SPIR-V module.
+        bool LoadWords(const std::vector<uint8_t>& blob, std::vector<uint32_t>& words, const char* operation, std::vector<StageLinkDiagnostic>& diagnostics)
+        {
+            if (blob.empty() || blob.size() % sizeof(uint32_t) != 0)
+            {
+                AddDiagnostic(diagnostics, IGNITE_LOG_TYPE_ERROR, std::string(operation) + " failed: shader blob size is not aligned to 4 bytes.");
+                return false;
+            }
+
+            words.resize(blob.size() / sizeof(uint32_t));
+            std::memcpy(words.data(), blob.data(), blob.size());
+            if (!spirv::HasValidHeader(words.data(), words.size()))
+            {
+                AddDiagnostic(diagnostics, IGNITE_LOG_TYPE_ERROR, std::string(operation) + " failed: input is not a SPIR-V module.");
+                return false;
+            }
+            return true;
+        }
+
+        // Every consumer input needs a producer output at the same location whose components
+        // cover the input's, with the same component type and shape. The input may start inside
+        // the output (Component decoration), as the Vulkan interface matching rules allow.
+        void ValidateInterface(const ShaderReflectionInfo& producerInfo, const ShaderReflectionInfo& consumerInfo, std::vector<StageLinkDiagnostic>& diagnostics)
+        {
+            const std::string producerStage = IGNITE_GetShaderTypeString(producerInfo.shaderType);
+            const std::string consumerStage = IGNITE_GetShaderTypeString(consumerInfo.shaderType);
+            for (const ShaderStageIOInfo& input : consumerInfo.stageInputs)
+            {
+                const uint32_t inputEnd = input.component + std::max(input.vecSize, 1u);
+                auto match = std::find_if(producerInfo.stageOutputs.begin(), producerInfo.stageOutputs.end(), [&](const ShaderStageIOInfo& output) {
+                    return output.location == input.location && output.component <= input.component
+                        && inputEnd <= output.component + std::max(output.vecSize, 1u);
+                });
+
+                if (match == producerInfo.stageOutputs.end())
+                {
+                    auto overlap = std::find_if(producerInfo.stageOutputs.begin(), producerInfo.stageOutputs.end(), [&](const ShaderStageIOInfo& output) {
+                        return ComponentsOverlap(output, input);
+                    });
+                    AddDiagnostic(diagnostics, IGNITE_LOG_TYPE_ERROR, "Stage link: " + consumerStage + " input " + DescribeIO(input) + (overlap != producerInfo.stageOutputs.end()
+                        ? " reads components " + std::to_string(input.component) + "-" + std::to_string(inputEnd - 1) + " that " + producerStage + " output "
+                            + DescribeIO(*overlap) + " does not cover."
+                        : " is not written by the " + producerStage + " stage."));
+                }
+                else if (!SameComponentType(match->format, input.format) || match->columns != input.columns)
+                {
+                    AddDiagnostic(diagnostics, IGNITE_LOG_TYPE_ERROR, "Stage link: " + consumerStage + " input " + DescribeIO(input) + " does not match the type of "
+                        + producerStage + " output " + DescribeIO(*match) + ".");
+                }
+            }
+        }
+
+        // Locations a value of this type occupies: arrays multiply, matrices take one per column
+        // and 64-bit vectors of more than two components take two.
+        uint32_t LocationSpan(const spirv::Module& module, uint32_t typeId, uint32_t depth = 0)
+        {
+            const spirv::IdRecord* type = module.Find(typeId);
+            if (!type || depth > 32)
+            {
+                return 1;
+            }
+
+            switch (type->opcode)
+            {
+            case SpvOpTypePointer:
+                return LocationSpan(module, type->args[1], depth + 1);
+            case SpvOpTypeArray:
+                return static_cast<uint32_t>(module.ConstantValue(type->args[1], 1)) * LocationSpan(module, type->args[0], depth + 1);
+            case SpvOpTypeMatrix:
+                return type->args[1] * LocationSpan(module, type->args[0], depth + 1);
+            case SpvOpTypeVector:
+            {
+                const spirv::IdRecord* component = module.Find(type->args[0]);
+                return component && component->args[0] == 64 && type->args[1] > 2 ? 2 : 1;
+            }
+            case SpvOpTypeStruct:
+            {
+                uint32_t span = 0;
+                for (uint32_t i = 0; i < type->memberCount; ++i)
+                {
+                    span += LocationSpan(module, module.members[type->firstMember + i].typeId, depth + 1);
+                }
+                return span;
+            }
+            default:
+                return 1;
+            }
+        }
+
+        // Marks the locations a variable that keeps its placement covers. Block members use their
+        // own Location decoration or continue after the previous member.
+        void ReserveLocations(const spirv::Module& module, uint32_t variableId, std::set<uint32_t>& reserved)
+        {
+            const spirv::IdRecord& variable = module.ids[variableId];
+            const spirv::IdRecord* base = module.Find(module.BaseType(variable.resultType));
+            if (base && base->opcode == SpvOpTypeStruct)
+            {
+                uint32_t next = variable.location;
+                for (uint32_t i = 0; i < base->memberCount; ++i)
+                {
+                    const spirv::MemberRecord& member = module.members[base->firstMember + i];
+                    const uint32_t first = module.HasMemberDecoration(member, SpvDecorationLocation) ? member.location : next;
+                    next = first + LocationSpan(module, member.typeId);
+                    for (uint32_t location = first; location < next; ++location)
+                    {
+                        reserved.insert(location);
+                    }
+                }
+                return;
+            }
+
+            const uint32_t span = LocationSpan(module, variable.resultType);
+            for (uint32_t location = variable.location; location < variable.location + span; ++location)
+            {
+                reserved.insert(location);
+            }
+        }
+
+        // Scalars and vectors of up to three 32-bit components that are not arrays or blocks.
+        bool IsPackable(const spirv::Module& module, uint32_t variableId)
+        {
+            const spirv::IdRecord* pointer = module.Find(module.ids[variableId].resultType);
+            const spirv::IdRecord* type = pointer && pointer->opcode == SpvOpTypePointer ? module.Find(pointer->args[1]) : nullptr;
+            uint32_t count = 1;
+            if (type && type->opcode == SpvOpTypeVector)
+            {
+                count = type->args[1];
+                type = module.Find(type->args[0]);
+            }
+            return type && (type->opcode == SpvOpTypeFloat || type->opcode == SpvOpTypeInt) && type->args[0] == 32 && count < 4
+                && module.HasDecoration(variableId, SpvDecorationLocation);
+        }
+
+        uint32_t InterpolationMask(const spirv::Module& module, uint32_t variableId)
+        {
+            static constexpr SpvDecoration kInterpolation[] = { SpvDecorationFlat, SpvDecorationNoPerspective, SpvDecorationCentroid, SpvDecorationSample };
+            uint32_t mask = 0;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                mask |= module.HasDecoration(variableId, kInterpolation[i]) ? 1u << i : 0u;
+            }
+            return mask;
+        }
+
+        // Rewrites the Location and Component decorations of the placed variables (location, component),
+        // adding a Component decoration where a variable had none.
+        bool AssignLocations(const std::vector<uint32_t>& words, const std::map<uint32_t, std::pair<uint32_t, uint32_t>>& placements, std::vector<uint32_t>& output)
+        {
+            std::set<uint32_t> hasComponent;
+            spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                if (instruction.opcode == SpvOpDecorate && instruction.Operand(1) == SpvDecorationComponent && placements.count(instruction.Operand(0)))
+                {
+                    hasComponent.insert(instruction.Operand(0));
+                }
+                return instruction.opcode != SpvOpFunction;
+            });
+
+            output.assign(words.begin(), words.begin() + spirv::kHeaderWordCount);
+            output.reserve(words.size() + placements.size() * 4);
+            return spirv::ForEachInstruction(words.data(), words.size(), [&](const spirv::Instruction& instruction) {
+                const size_t first = output.size();
+                output.insert(output.end(), instruction.words, instruction.words + instruction.wordCount);
+                if (instruction.opcode != SpvOpDecorate || instruction.wordCount < 4)
+                {
+                    return true;
+                }
+
+                const uint32_t target = instruction.Operand(0);
+                auto placement = placements.find(target);
+                if (placement == placements.end())
+                {
+                    return true;
+                }
+
+                if (instruction.Operand(1) == SpvDecorationLocation)
+                {
+                    output[first + 3] = placement->second.first;
+                    if (!hasComponent.count(target) && placement->second.second != 0)
+                    {
+                        output.insert(output.end(), { (4u << SpvWordCountShift) | SpvOpDecorate, target, SpvDecorationComponent, placement->second.second });
+                    }
+                }
+                else if (instruction.Operand(1) == SpvDecorationComponent)
+                {
+                    output[first + 3] = placement->second.second;
+                }
+                return true;
+            });
+        }
+
+        std::vector<uint8_t> ToBytes(const std::vector<uint32_t>& words)
+        {
+            std::vector<uint8_t> bytes(words.size() * sizeof(uint32_t));
+            std::memcpy(bytes.data(), words.data(), bytes.size());
+            return bytes;
+        }
+    }
+
+    StageLinkResult LinkStages(IGNITE_ShaderType producerType, const std::vector<uint8_t>& producer, IGNITE_ShaderType consumerType, const std::vector<uint8_t>& consumer)
+    {
+        StageLinkResult result;
+        auto report = [&](IGNITE_LogType type, std::string message) {
+            AddDiagnostic(result.diagnostics, type, std::move(message));
+        };
+
+        std::vector<uint32_t> words;
+        std::vector<uint32_t> consumerWords;
+        if (!LoadWords(producer, words, "Stage link", result.diagnostics) || !LoadWords(consumer, consumerWords, "Stage link", result.diagnostics))
+        {
+            return result;
+        }
+
+        const ShaderReflectionInfo producerInfo = ShaderReflection::SPIRVReflect(producerType, producer);
+        const ShaderReflectionInfo consumerInfo = ShaderReflection::SPIRVReflect(consumerType, consumer);
+        const std::string producerStage = IGNITE_GetShaderTypeString(producerType);
+        const std::string consumerStage = IGNITE_GetShaderTypeString(consumerType);
+        ValidateInterface(producerInfo, consumerInfo, result.diagnostics);
+
+        if (!result.IsValid())
+        {
+            return result;
+        }
+
+        std::set<uint32_t> unused;
+        std::vector<ShaderStageIOInfo> removed;
+        if (ExecutionModel(words) == SpvExecutionModelTessellationControl)
+        {
+            report(IGNITE_LOG_TYPE_INFO, "Stage link: tessellation control outputs are shared by the patch and are kept.");
+        }
+        else
+        {
+            const std::set<uint32_t> blocks = BlockVariables(words);
+            for (const ShaderStageIOInfo& output : producerInfo.stageOutputs)
+            {
+                const bool read = std::any_of(consumerInfo.stageInputs.begin(), consumerInfo.stageInputs.end(), [&](const ShaderStageIOInfo& input) {
+                    return ComponentsOverlap(output, input);
+                });
+                if (!read && !blocks.count(output.id))
+                {
+                    unused.insert(output.id);
+                    removed.push_back(output);
+                }
+            }
+        }
+
+        result.producer = producer;
+        if (unused.empty())
+        {
+            return result;
+        }
+
+        std::vector<uint32_t> demoted;
+        if (!DemoteOutputsToPrivate(words, unused, demoted))
+        {
+            report(IGNITE_LOG_TYPE_WARNING, "Stage link: unused " + producerStage + " outputs are passed through pointers and were kept.");
+            return result;
+        }
+
+        // Private variables of an entry point without calls are local to it, so after inlining
+        // ADCE drops their stores and everything computed only for them.
+        const std::vector<std::string> passes = {
+            "--inline-entry-points-exhaustive",
+            "--eliminate-dead-functions",
+            "--private-to-local",
+            "--eliminate-local-single-block",
+            "--eliminate-local-single-store",
+            "--eliminate-dead-code-aggressive",
+            "--eliminate-dead-variables",
+            "--eliminate-dead-const",
+        };
+
+        // The optimizer also validates the demoted module; if either fails, the producer stays as it was.
+        std::vector<uint32_t> optimized;
+        if (!spirv::RunOptimizer(demoted.data(), demoted.size(), passes, optimized))
+        {
+            report(IGNITE_LOG_TYPE_WARNING, "Stage link: dead-code elimination failed; unused " + producerStage + " outputs were kept.");
+            return result;
+        }
+
+        for (const ShaderStageIOInfo& output : removed)
+        {
+            report(IGNITE_LOG_TYPE_INFO, "Stage link: removed " + producerStage + " output " + DescribeIO(output) + ", not read by the " + consumerStage + " stage.");
+        }
+
+        result.producer = ToBytes(optimized);
+        result.removedOutputs = std::move(removed);
+        return result;
+    }
+
+    VaryingPackResult PackVaryings(IGNITE_ShaderType producerType, const std::vector<uint8_t>& producer, IGNITE_ShaderType consumerType, const std::vector<uint8_t>& consumer)
+    {
+        VaryingPackResult result;
+        std::vector<uint32_t> producerWords;
+        std::vector<uint32_t> consumerWords;
+        if (!LoadWords(producer, producerWords, "Varying packing", result.diagnostics) || !LoadWords(consumer, consumerWords, "Varying packing", result.diagnostics))
+        {
+            return result;
+        }
+
+        spirv::Module producerModule;
+        spirv::Module consumerModule;
+        if (!spirv::ParseModule(producerWords.data(), producerWords.size(), producerModule) || !spirv::ParseModule(consumerWords.data(), consumerWords.size(), consumerModule))
+        {
+            AddDiagnostic(result.diagnostics, IGNITE_LOG_TYPE_ERROR, "Varying packing failed: malformed SPIR-V module.");
+            return result;
+        }
+
+        const ShaderReflectionInfo producerInfo = ShaderReflection::SPIRVReflect(producerType, producer);
+        const ShaderReflectionInfo consumerInfo = ShaderReflection::SPIRVReflect(consumerType, consumer);
+        ValidateInterface(producerInfo, consumerInfo, result.diagnostics);
+        if (!result.IsValid())
+        {
+            return result;
+        }
+
+        result.producer = producer;
+        result.consumer = consumer;
+        result.producerOutputs = producerInfo.stageOutputs;
+        result.consumerInputs = consumerInfo.stageInputs;
+
+        // Other consumers read arrayed (per-vertex) inputs, and mesh and tessellation control outputs are arrayed.
+        const SpvExecutionModel producerModel = producerModule.executionModel;
+        if (consumerModule.executionModel != SpvExecutionModelFragment || (producerModel != SpvExecutionModelVertex
+            && producerModel != SpvExecutionModelTessellationEvaluation && producerModel != SpvExecutionModelGeometry))
+        {
+            AddDiagnostic(result.diagnostics, IGNITE_LOG_TYPE_INFO, "Varying packing: only vertex, tessellation evaluation and geometry stages feeding a fragment shader are packed.");
+            return result;
+        }
+
+        struct Varying
+        {
+            const ShaderStageIOInfo* output = nullptr;
+            std::vector<const ShaderStageIOInfo*> inputs;
+            uint64_t group = 0; // component type and fragment-side interpolation
+        };
+
+        std::vector<Varying> varyings;
+        std::set<uint32_t> reserved;
+        std::set<uint32_t> packedInputs;
+        std::set<uint32_t> originalLocations;
+        for (const ShaderStageIOInfo& output : producerInfo.stageOutputs)
+        {
+            Varying varying;
+            varying.output = &output;
+            bool packable = IsPackable(producerModule, output.id);
+            uint32_t interpolation = InterpolationMask(producerModule, output.id);
+            for (const ShaderStageIOInfo& input : consumerInfo.stageInputs)
+            {
+                if (ComponentsOverlap(output, input))
+                {
+                    varying.inputs.push_back(&input);
+                    packable = packable && IsPackable(consumerModule, input.id);
+                    interpolation = InterpolationMask(consumerModule, input.id);
+                }
+            }
+
+            if (!packable)
+            {
+                ReserveLocations(producerModule, output.id, reserved);
+                continue;
+            }
+
+            varying.group = (uint64_t(IGNITE_GetVertexFormatInfo(output.format).componentType) << 32) | interpolation;
+            for (const ShaderStageIOInfo* input : varying.inputs)
+            {
+                packedInputs.insert(input->id);
+            }
+            originalLocations.insert(output.location);
+            varyings.push_back(std::move(varying));
+        }
+
+        for (const ShaderStageIOInfo& input : consumerInfo.stageInputs)
+        {
+            if (!packedInputs.count(input.id))
+            {
+                ReserveLocations(consumerModule, input.id, reserved);
+            }
+        }
+
+        // First fit, widest first, into vec4 slots shared only within a group; new slots take
+        // the lowest location nothing else keeps.
+        std::stable_sort(varyings.begin(), varyings.end(), [](const Varying& a, const Varying& b) {
+            if (a.group != b.group)
+            {
+                return a.group < b.group;
+            }
+            if (a.output->vecSize != b.output->vecSize)
+            {
+                return a.output->vecSize > b.output->vecSize;
+            }
+            return a.output->location != b.output->location ? a.output->location < b.output->location : a.output->component < b.output->component;
+        });
+
+        struct Slot
+        {
+            uint64_t group = 0;
+            uint32_t location = 0;
+            uint32_t used = 0; // components taken
+        };
+
+        std::vector<Slot> slots;
+        std::map<uint32_t, std::pair<uint32_t, uint32_t>> producerPlacements;
+        std::map<uint32_t, std::pair<uint32_t, uint32_t>> consumerPlacements;
+        uint32_t nextLocation = 0;
+        for (const Varying& varying : varyings)
+        {
+            const uint32_t size = std::max(varying.output->vecSize, 1u);
+            auto slot = std::find_if(slots.begin(), slots.end(), [&](const Slot& candidate) {
+                return candidate.group == varying.group && candidate.used + size <= 4;
+            });
+            if (slot == slots.end())
+            {
+                while (reserved.count(nextLocation))
+                {
+                    ++nextLocation;
+                }
+                slots.push_back({ varying.group, nextLocation++, 0 });
+                slot = std::prev(slots.end());
+            }
+
+            producerPlacements[varying.output->id] = { slot->location, slot->used };
+            // An input may read a tail of the output's components; it keeps its offset within it.
+            for (const ShaderStageIOInfo* input : varying.inputs)
+            {
+                consumerPlacements[input->id] = { slot->location, slot->used + input->component - varying.output->component };
+            }
+            slot->used += size;
+        }
+
+        result.locationsBefore = static_cast<uint32_t>(originalLocations.size());
+        result.locationsAfter = static_cast<uint32_t>(slots.size());
+        if (result.locationsAfter >= result.locationsBefore)
+        {
+            AddDiagnostic(result.diagnostics, IGNITE_LOG_TYPE_INFO, "Varying packing: no locations to save; modules left unchanged.");
+            return result;
+        }
+
+        std::vector<uint32_t> packedProducer;
+        std::vector<uint32_t> packedConsumer;
+        if (!AssignLocations(producerWords, producerPlacements, packedProducer) || !AssignLocations(consumerWords, consumerPlacements, packedConsumer))
+        {
+            AddDiagnostic(result.diagnostics, IGNITE_LOG_TYPE_ERROR, "Varying packing failed: malformed SPIR-V module.");
+            result.producer.clear();
+            result.consumer.clear();
+            return result;
+        }
+
+        result.producer = ToBytes(packedProducer);
+        result.consumer = ToBytes(packedConsumer);
+        result.producerOutputs = ShaderReflection::SPIRVReflect(producerType, result.producer).stageOutputs;
+        result.consumerInputs = ShaderReflection::SPIRVReflect(consumerType, result.consumer).stageInputs;
+        AddDiagnostic(result.diagnostics, IGNITE_LOG_TYPE_INFO, "Varying packing: " + std::to_string(varyings.size()) + " varyings moved from "
+            + std::to_string(result.locationsBefore) + " locations into " + std::to_string(result.locationsAfter) + ".");
+        return result;
+    }
+}
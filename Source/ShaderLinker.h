@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_LINKER_H
+#define _SHADER_LINKER_H
+
+#pragma once
+
+#include "ShaderCompiler.h"
+
+namespace ignite
+{
+    /*
+     * Links two consecutive SPIR-V stages (vertex -> pixel, vertex -> geometry, ...).
+     *
+     * Both modules are reflected and every consumer input is checked against the producer
+     * output at the same location and component. The output must exist, use the same
+     * component type and matrix shape, and have at least as many components. Anything else
+     * is reported as an error.
+     *
+     * Producer outputs that no consumer input overlaps are then removed. Each one is demoted
+     * to a Private variable, losing its Location and interpolation decorations, and spirv-opt
+     * inlines the entry point and runs aggressive dead-code elimination. That removes the
+     * stores and the arithmetic feeding them, so the interpolator slots and the ALU work go
+     * away together. Built-in outputs (position, clip distances, ...) and output blocks are
+     * kept, and tessellation control outputs are never removed because other invocations
+     * of the patch may read them.
+     *
+     * PackVaryings packs the scalar, vec2 and vec3 varyings of a stage feeding a fragment
+     * shader into shared vec4 locations, using SPIR-V Location + Component aliasing. Only the
+     * decorations of both modules change, so no code is rewritten. Varyings share a location only
+     * when they have the same component type and the same interpolation decorations (flat,
+     * noperspective, centroid, sample) on the fragment side, as aliasing requires. Larger
+     * varyings, arrays, matrices, 64-bit types and blocks keep their locations.
+     */
+
+    struct StageLinkDiagnostic
+    {
+        IGNITE_LogType type = IGNITE_LOG_TYPE_WARNING; // IGNITE_LOG_TYPE_ERROR for interface mismatches
+        std::string message;
+    };
+
+    struct StageLinkResult
+    {
+        std::vector<uint8_t> producer; // rewritten producer; empty when an input is invalid or the interface mismatches
+        std::vector<ShaderStageIOInfo> removedOutputs; // producer reflection of every output removed
+        std::vector<StageLinkDiagnostic> diagnostics;
+
+        // True when no diagnostic is an error.
+        bool IsValid() const
+        {
+            for (const StageLinkDiagnostic& diagnostic : diagnostics)
+            {
+                if (diagnostic.type == IGNITE_LOG_TYPE_ERROR)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    struct VaryingPackResult
+    {
+        std::vector<uint8_t> producer; // empty when an input is invalid or the interface mismatches
+        std::vector<uint8_t> consumer;
+        std::vector<ShaderStageIOInfo> producerOutputs; // reflection of the packed modules
+        std::vector<ShaderStageIOInfo> consumerInputs;
+        uint32_t locationsBefore = 0; // locations used by the packable varyings
+        uint32_t locationsAfter = 0;
+        std::vector<StageLinkDiagnostic> diagnostics;
+
+        // True when no diagnostic is an error.
+        bool IsValid() const
+        {
+            for (const StageLinkDiagnostic& diagnostic : diagnostics)
+            {
+                if (diagnostic.type == IGNITE_LOG_TYPE_ERROR)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    // Validates the producer -> consumer interface and strips producer outputs the consumer never reads.
+    // Diagnostics also go to the log callback.
+    IGNITECOMPILER_API StageLinkResult LinkStages(IGNITE_ShaderType producerType, const std::vector<uint8_t>& producer,
+        IGNITE_ShaderType consumerType, const std::vector<uint8_t>& consumer);
+
+    // Validates the interface, then reassigns the locations and components of small varyings in both
+    // modules so they share vec4 locations. The modules come back unchanged when packing saves nothing.
+    IGNITECOMPILER_API VaryingPackResult PackVaryings(IGNITE_ShaderType producerType, const std::vector<uint8_t>& producer,
+        IGNITE_ShaderType consumerType, const std::vector<uint8_t>& consumer);
+}
+
+#endif
@@ -0,0 +1,19 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_LOG_H
+#define _SHADER_LOG_H
+
+#pragma once
+
+#include <string>
+
+#include "ShaderBase.h"
+
+namespace ignite
+{
+    // Internal: routes diagnostics from any library translation unit to the
+    // callback installed through ShaderCompiler::SetLogCallback. Not installed.
+    void DispatchLog(IGNITE_LogType type, const std::string& message);
+}
+
+#endif
@@ -0,0 +1,257 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "ShaderPipelineLayout.h"
+#include "ShaderLog.h"
+#include "ShaderUtils.h"
+
+#include <algorithm>
+
+namespace ignite
+{
+    namespace
+    {
+        const char* DescriptorTypeName(IGNITE_DescriptorType type)
+        {
+            switch (type)
+            {
+            case IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER: return "uniform buffer";
+            case IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER: return "storage buffer";
+            case IGNITE_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: return "combined image sampler";
+            case IGNITE_DESCRIPTOR_TYPE_STORAGE_IMAGE: return "storage image";
+            case IGNITE_DESCRIPTOR_TYPE_SAMPLER: return "sampler";
+            case IGNITE_DESCRIPTOR_TYPE_SAMPLED_IMAGE: return "sampled image";
+            default: return "unknown";
+            }
+        }
+
+        std::string BindingLocation(uint32_t set, uint32_t binding)
+        {
+            return "set " + std::to_string(set) + " binding " + std::to_string(binding);
+        }
+
+        bool SameMemberShape(const ShaderBufferMember& a, const ShaderBufferMember& b)
+        {
+            return a.offset == b.offset && a.size == b.size && a.type == b.type && a.vecSize == b.vecSize
+                && a.columns == b.columns && a.arraySize == b.arraySize && a.arrayStride == b.arrayStride
+                && a.matrixStride == b.matrixStride && a.rowMajor == b.rowMajor;
+        }
+    }
+
+    PipelineLayoutBuilder::PipelineLayoutBuilder(IGNITE_ShaderPlatformType platform)
+        : m_platform(platform)
+    {
+    }
+
+    PipelineLayoutBuilder& PipelineLayoutBuilder::AddStage(const ShaderReflectionInfo& reflection)
+    {
+        const IGNITE_ShaderType stage = reflection.shaderType;
+        AddBindings(reflection.uniformBuffers, IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER, stage);
+        AddBindings(reflection.storageBuffers, IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER, stage);
+        AddBindings(reflection.sampledImages, IGNITE_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, stage);
+        AddBindings(reflection.storageImages, IGNITE_DESCRIPTOR_TYPE_STORAGE_IMAGE, stage);
+        AddBindings(reflection.separateSamplers, IGNITE_DESCRIPTOR_TYPE_SAMPLER, stage);
+        AddBindings(reflection.separateImages, IGNITE_DESCRIPTOR_TYPE_SAMPLED_IMAGE, stage);
+
+        for (const ShaderPushConstantInfo& block : reflection.pushConstants)
+        {
+            StagePushConstants entry = {};
+            entry.stage = stage;
+            entry.blockName = block.name;
+
+            // The range starts at the first member the stage declares, so stages using
+            // disjoint parts of a shared block get disjoint ranges.
+            uint32_t begin = UINT32_MAX;
+            uint32_t end = block.size;
+            for (const ShaderBufferMember& member : block.members)
+            {
+                if (member.depth != 0)
+                {
+                    continue;
+                }
+                entry.members.push_back(member);
+                begin = std::min(begin, member.offset);
+                end = std::max(end, member.offset + member.size);
+            }
+
+            entry.offset = begin == UINT32_MAX ? 0 : begin;
+            end = (end + 3u) & ~3u;
+            if (end <= entry.offset)
+            {
+                continue;
+            }
+            entry.size = end - entry.offset;
+            m_pushConstants.push_back(std::move(entry));
+        }
+
+        return *this;
+    }
+
+    void PipelineLayoutBuilder::AddBindings(const std::vector<ShaderResourceInfo>& resources, IGNITE_DescriptorType type, IGNITE_ShaderType stage)
+    {
+        const uint32_t stageBit = 1u << stage;
+        const bool isBuffer = type == IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        const char registerClass = m_platform == IGNITE_SHADER_PLATFORM_TYPE_SPIRV ? 0 : DescriptorRegisterClass(type);
+        for (const ShaderResourceInfo& resource : resources)
+        {
+            auto [it, inserted] = m_bindings.try_emplace(std::make_tuple(resource.set, resource.binding, registerClass));
+            PipelineBinding& binding = it->second;
+            if (inserted)
+            {
+                binding.name = resource.name;
+                binding.binding = resource.binding;
+                binding.descriptorType = type;
+                binding.count = resource.count;
+                binding.unbounded = resource.unbounded;
+                binding.stageMask = stageBit;
+                binding.size = isBuffer ? resource.size : 0;
+                continue;
+            }
+
+            const std::string location = BindingLocation(resource.set, resource.binding);
+            if (binding.descriptorType != type)
+            {
+                AddDiagnostic(IGNITE_LOG_TYPE_ERROR, "Pipeline layout: " + location + " is " + DescriptorTypeName(binding.descriptorType) + " " + binding.name
+                    + " in earlier stages but " + DescriptorTypeName(type) + " " + resource.name + " in the " + IGNITE_GetShaderTypeString(stage) + " stage.");
+            }
+            else if (binding.unbounded || resource.unbounded)
+            {
+                // A bounded declaration in one stage indexes into the unbounded array of another.
+                binding.unbounded = true;
+                binding.count = 0;
+                binding.size = std::max(binding.size, isBuffer ? resource.size : 0u);
+            }
+            else
+            {
+                if (binding.count != resource.count)
+                {
+                    AddDiagnostic(IGNITE_LOG_TYPE_WARNING, "Pipeline layout: " + location + " (" + binding.name + ") has " + std::to_string(binding.count)
+                        + " descriptors in earlier stages but " + std::to_string(resource.count) + " in the " + IGNITE_GetShaderTypeString(stage) + " stage; using the larger.");
+                    binding.count = std::max(binding.count, resource.count);
+                }
+
+                if (isBuffer && binding.size != resource.size && binding.size != 0 && resource.size != 0)
+                {
+                    AddDiagnostic(IGNITE_LOG_TYPE_WARNING, "Pipeline layout: " + location + " (" + binding.name + ") is " + std::to_string(binding.size)
+                        + " bytes in earlier stages but " + std::to_string(resource.size) + " in the " + IGNITE_GetShaderTypeString(stage) + " stage.");
+                }
+                binding.size = std::max(binding.size, isBuffer ? resource.size : 0u);
+            }
+
+            binding.stageMask |= stageBit;
+        }
+    }
+
+    void PipelineLayoutBuilder::AddDiagnostic(IGNITE_LogType type, std::string message)
+    {
+        DispatchLog(type, message);
+        m_diagnostics.push_back({ type, std::move(message) });
+    }
+
+    PipelineLayout PipelineLayoutBuilder::Build() const
+    {
+        PipelineLayout layout;
+        layout.diagnostics = m_diagnostics;
+
+        for (const auto& [key, binding] : m_bindings)
+        {
+            const uint32_t setIndex = std::get<0>(key);
+            if (layout.sets.empty() || layout.sets.back().set != setIndex)
+            {
+                PipelineDescriptorSet set = {};
+                set.set = setIndex;
+                layout.sets.push_back(std::move(set));
+            }
+            layout.sets.back().bindings.push_back(binding);
+        }
+
+        // Direct members of different stages must agree wherever they overlap.
+        for (size_t i = 0; i < m_pushConstants.size(); ++i)
+        {
+            for (size_t j = i + 1; j < m_pushConstants.size(); ++j)
+            {
+                const StagePushConstants& a = m_pushConstants[i];
+                const StagePushConstants& b = m_pushConstants[j];
+                for (const ShaderBufferMember& memberA : a.members)
+                {
+                    for (const ShaderBufferMember& memberB : b.members)
+                    {
+                        const bool overlaps = memberA.offset < memberB.offset + std::max(memberB.size, 1u)
+                            && memberB.offset < memberA.offset + std::max(memberA.size, 1u);
+                        if (!overlaps || SameMemberShape(memberA, memberB))
+                        {
+                            continue;
+                        }
+
+                        std::string message = "Pipeline layout: push constant " + a.blockName + "." + memberA.name + " (" + IGNITE_GetShaderTypeString(a.stage)
+                            + ", offset " + std::to_string(memberA.offset) + ") overlaps " + b.blockName + "." + memberB.name + " (" + IGNITE_GetShaderTypeString(b.stage)
+                            + ", offset " + std::to_string(memberB.offset) + ") with a different layout.";
+                        DispatchLog(IGNITE_LOG_TYPE_ERROR, message);
+                        layout.diagnostics.push_back({ IGNITE_LOG_TYPE_ERROR, std::move(message) });
+                    }
+                }
+            }
+        }
+
+        // One range per stage (a stage seen twice gets the union), then stages with equal ranges share one.
+        std::map<IGNITE_ShaderType, std::pair<uint32_t, uint32_t>> stageRanges; // stage -> (begin, end)
+        for (const StagePushConstants& entry : m_pushConstants)
+        {
+            auto [it, inserted] = stageRanges.try_emplace(entry.stage, entry.offset, entry.offset + entry.size);
+            if (!inserted)
+            {
+                it->second.first = std::min(it->second.first, entry.offset);
+                it->second.second = std::max(it->second.second, entry.offset + entry.size);
+            }
+        }
+
+        std::map<std::pair<uint32_t, uint32_t>, uint32_t> rangeMasks; // (offset, size) -> stages
+        for (const auto& [stage, range] : stageRanges)
+        {
+            rangeMasks[std::make_pair(range.first, range.second - range.first)] |= 1u << stage;
+        }
+
+        for (const auto& [range, stageMask] : rangeMasks)
+        {
+            layout.pushConstantRanges.push_back({ stageMask, range.first, range.second });
+        }
+
+        layout.hash = HashPipelineLayout(layout);
+        return layout;
+    }
+
+    void PipelineLayoutBuilder::Reset()
+    {
+        m_bindings.clear();
+        m_pushConstants.clear();
+        m_diagnostics.clear();
+    }
+
+    uint64_t HashPipelineLayout(const PipelineLayout& layout)
+    {
+        std::vector<uint32_t> words;
+        words.push_back(static_cast<uint32_t>(layout.sets.size()));
+        for (const PipelineDescriptorSet& set : layout.sets)
+        {
+            words.push_back(set.set);
+            words.push_back(static_cast<uint32_t>(set.bindings.size()));
+            for (const PipelineBinding& binding : set.bindings)
+            {
+                words.push_back(binding.binding);
+                words.push_back(static_cast<uint32_t>(binding.descriptorType));
+                words.push_back(binding.count);
+                words.push_back(binding.unbounded ? 1u : 0u);
+                words.push_back(binding.stageMask);
+            }
+        }
+
+        words.push_back(static_cast<uint32_t>(layout.pushConstantRanges.size()));
+        for (const PushConstantRange& range : layout.pushConstantRanges)
+        {
+            words.push_back(range.stageMask);
+            words.push_back(range.offset);
+            words.push_back(range.size);
+        }
+
+        return HashBytes64(words.data(), words.size() * sizeof(uint32_t));
+    }
+}
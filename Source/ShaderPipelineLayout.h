@@ -0,0 +1,124 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_PIPELINE_LAYOUT_H
+#define _SHADER_PIPELINE_LAYOUT_H
+
+#pragma once
+
+#include "ShaderCompiler.h"
+
+#include <map>
+#include <tuple>
+#include <utility>
+
+namespace ignite
+{
+    /*
+     * Merges per-stage reflections into one pipeline layout.
+     *
+     * Bindings with the same (set, binding) across stages become one entry whose
+     * stageMask ORs the stages using it. For DXIL and DXBC, set and binding are the
+     * register space and number, so the register class (b, t, u, s) is part of the
+     * key too and a set may list one binding number once per class. Push constant
+     * blocks become one range per stage, covering that stage's members; stages with
+     * the same range share an entry.
+     * Mismatches (different descriptor types on one binding, overlapping push constant
+     * members of different shape) are reported as errors, and smaller disagreements
+     * (array counts, buffer sizes) as warnings, both through DispatchLog and in
+     * PipelineLayout::diagnostics.
+     *
+     * The hash covers only what makes two layouts compatible (sets, bindings, types,
+     * counts, stage masks, push constant ranges), not names or buffer sizes, so
+     * pipelines whose layouts hash equal can share them.
+     */
+
+    // One binding of a merged descriptor set layout.
+    struct PipelineBinding
+    {
+        std::string name; // from the first stage declaring it
+        uint32_t binding = 0;
+        IGNITE_DescriptorType descriptorType = IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uint32_t count = 1; // largest count declared by any stage; 0 when unbounded
+        bool unbounded = false; // some stage declares a runtime-sized array (variable descriptor count)
+        uint32_t stageMask = 0; // IGNITE_ShaderStageFlags
+        uint32_t size = 0; // largest declared block size, buffers only
+    };
+
+    struct PipelineDescriptorSet
+    {
+        uint32_t set = 0;
+        std::vector<PipelineBinding> bindings; // sorted by binding
+    };
+
+    struct PushConstantRange
+    {
+        uint32_t stageMask = 0; // IGNITE_ShaderStageFlags
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    struct PipelineLayoutDiagnostic
+    {
+        IGNITE_LogType type = IGNITE_LOG_TYPE_WARNING; // IGNITE_LOG_TYPE_ERROR for conflicts
+        std::string message;
+    };
+
+    struct PipelineLayout
+    {
+        std::vector<PipelineDescriptorSet> sets; // sorted by set; sets without bindings are omitted
+        std::vector<PushConstantRange> pushConstantRanges; // sorted by offset, then size
+        std::vector<PipelineLayoutDiagnostic> diagnostics;
+        uint64_t hash = 0;
+
+        // True when no diagnostic is an error.
+        bool IsValid() const
+        {
+            for (const PipelineLayoutDiagnostic& diagnostic : diagnostics)
+            {
+                if (diagnostic.type == IGNITE_LOG_TYPE_ERROR)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    class IGNITECOMPILER_API PipelineLayoutBuilder
+    {
+    public:
+        // platform is the bytecode the stage reflections came from; it decides how bindings collide.
+        explicit PipelineLayoutBuilder(IGNITE_ShaderPlatformType platform = IGNITE_SHADER_PLATFORM_TYPE_SPIRV);
+
+        // Merges one stage; its visibility bit comes from reflection.shaderType.
+        PipelineLayoutBuilder& AddStage(const ShaderReflectionInfo& reflection);
+
+        // Produces the merged layout of every stage added so far.
+        PipelineLayout Build() const;
+
+        void Reset();
+
+    private:
+        struct StagePushConstants
+        {
+            IGNITE_ShaderType stage = IGNITE_SHADER_TYPE_VERTEX;
+            std::string blockName;
+            std::vector<ShaderBufferMember> members; // direct members only
+            uint32_t offset = 0;
+            uint32_t size = 0;
+        };
+
+        void AddBindings(const std::vector<ShaderResourceInfo>& resources, IGNITE_DescriptorType type, IGNITE_ShaderType stage);
+        void AddDiagnostic(IGNITE_LogType type, std::string message);
+
+        IGNITE_ShaderPlatformType m_platform = IGNITE_SHADER_PLATFORM_TYPE_SPIRV;
+        std::map<std::tuple<uint32_t, uint32_t, char>, PipelineBinding> m_bindings; // keyed by (set, binding, register class or 0 for SPIR-V)
+        std::vector<StagePushConstants> m_pushConstants;
+        std::vector<PipelineLayoutDiagnostic> m_diagnostics;
+    };
+
+    // Hash of the compatibility-relevant parts of a layout (see above).
+    IGNITECOMPILER_API uint64_t HashPipelineLayout(const PipelineLayout& layout);
+}
+
+#endif
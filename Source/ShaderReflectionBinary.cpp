@@ -0,0 +1,531 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#include "ShaderReflectionBinary.h"
+#include "ShaderLog.h"
+
+#include <bit>
+
+namespace ignite
+{
+    static_assert(std::endian::native == std::endian::little, "Reflection binaries are written in host order and must be little-endian");
+
+    namespace
+    {
+        // Name pool shared by every record; identical names are stored once.
+        class StringTable
+        {
+        public:
+            uint32_t Add(const std::string& value)
+            {
+                auto it = m_offsets.find(value);
+                if (it != m_offsets.end())
+                {
+                    return it->second;
+                }
+
+                const uint32_t offset = static_cast<uint32_t>(m_data.size());
+                m_data.insert(m_data.end(), value.begin(), value.end());
+                m_data.push_back('\0');
+                m_offsets.emplace(value, offset);
+                return offset;
+            }
+
+            const std::vector<char>& GetData() const { return m_data; }
+
+        private:
+            std::vector<char> m_data;
+            std::unordered_map<std::string, uint32_t> m_offsets;
+        };
+
+        struct SectionBuilder
+        {
+            std::vector<ShaderReflectionSection> sections;
+            std::vector<uint8_t> records; // offsets are relative until the layout is final
+
+            template<typename Record>
+            void Append(ShaderReflectionSectionKind kind, const std::vector<Record>& source)
+            {
+                ShaderReflectionSection& section = sections.emplace_back();
+                section.kind = static_cast<uint32_t>(kind);
+                section.recordSize = sizeof(Record);
+                section.offset = static_cast<uint32_t>(records.size());
+                section.count = static_cast<uint32_t>(source.size());
+
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(source.data());
+                records.insert(records.end(), bytes, bytes + source.size() * sizeof(Record));
+            }
+        };
+
+        // Appends block members to the shared member list and returns the index of the first one.
+        uint32_t EncodeMembers(const std::vector<ShaderBufferMember>& source, StringTable& strings, std::vector<ShaderReflectionMemberRecord>& members)
+        {
+            const uint32_t first = static_cast<uint32_t>(members.size());
+            for (const ShaderBufferMember& member : source)
+            {
+                ShaderReflectionMemberRecord& record = members.emplace_back();
+                record.nameOffset = strings.Add(member.name);
+                record.nameLength = static_cast<uint32_t>(member.name.size());
+                record.type = static_cast<uint32_t>(member.type);
+                record.offset = member.offset;
+                record.size = member.size;
+                record.vecSize = member.vecSize;
+                record.columns = member.columns;
+                record.arraySize = member.arraySize;
+                record.arrayStride = member.arrayStride;
+                record.matrixStride = member.matrixStride;
+                record.depth = member.depth;
+                record.flags = member.rowMajor ? SHADER_REFLECTION_MEMBER_ROW_MAJOR : 0;
+            }
+            return first;
+        }
+
+        std::vector<ShaderReflectionResourceRecord> EncodeResources(const std::vector<ShaderResourceInfo>& source, StringTable& strings, std::vector<ShaderReflectionMemberRecord>& members)
+        {
+            std::vector<ShaderReflectionResourceRecord> records(source.size());
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                records[i].nameOffset = strings.Add(source[i].name);
+                records[i].nameLength = static_cast<uint32_t>(source[i].name.size());
+                records[i].id = source[i].id;
+                records[i].set = source[i].set;
+                records[i].binding = source[i].binding;
+                records[i].count = source[i].count;
+                records[i].size = source[i].size;
+                records[i].firstMember = EncodeMembers(source[i].members, strings, members);
+                records[i].memberCount = static_cast<uint32_t>(source[i].members.size());
+                records[i].flags = source[i].unbounded ? SHADER_REFLECTION_RESOURCE_UNBOUNDED : 0u;
+            }
+            return records;
+        }
+
+        std::vector<ShaderReflectionStageIORecord> EncodeStageIO(const std::vector<ShaderStageIOInfo>& source, StringTable& strings)
+        {
+            std::vector<ShaderReflectionStageIORecord> records(source.size());
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                records[i].nameOffset = strings.Add(source[i].name);
+                records[i].nameLength = static_cast<uint32_t>(source[i].name.size());
+                records[i].id = source[i].id;
+                records[i].location = source[i].location;
+                records[i].format = static_cast<uint32_t>(source[i].format);
+                records[i].vecSize = source[i].vecSize;
+                records[i].columns = source[i].columns;
+                records[i].component = source[i].component;
+            }
+            return records;
+        }
+
+        std::vector<ShaderBufferMember> DecodeMembers(const ShaderReflectionView& view, uint32_t firstMember, uint32_t memberCount)
+        {
+            const ShaderReflectionRecords<ShaderReflectionMemberRecord> records = view.GetBufferMembers(firstMember, memberCount);
+            std::vector<ShaderBufferMember> result(records.size());
+            for (size_t i = 0; i < records.size(); ++i)
+            {
+                const ShaderReflectionMemberRecord record = records[i];
+                result[i].name = std::string(view.GetString(record.nameOffset, record.nameLength));
+                result[i].type = static_cast<IGNITE_ShaderDataType>(record.type);
+                result[i].offset = record.offset;
+                result[i].size = record.size;
+                result[i].vecSize = record.vecSize;
+                result[i].columns = record.columns;
+                result[i].arraySize = record.arraySize;
+                result[i].arrayStride = record.arrayStride;
+                result[i].matrixStride = record.matrixStride;
+                result[i].depth = record.depth;
+                result[i].rowMajor = (record.flags & SHADER_REFLECTION_MEMBER_ROW_MAJOR) != 0;
+            }
+            return result;
+        }
+
+        std::vector<ShaderResourceInfo> DecodeResources(const ShaderReflectionView& view, ShaderReflectionSectionKind kind)
+        {
+            const ShaderReflectionRecords<ShaderReflectionResourceRecord> records = view.GetResources(kind);
+            std::vector<ShaderResourceInfo> result(records.size());
+            for (size_t i = 0; i < records.size(); ++i)
+            {
+                const ShaderReflectionResourceRecord record = records[i];
+                result[i].name = std::string(view.GetString(record.nameOffset, record.nameLength));
+                result[i].id = record.id;
+                result[i].set = record.set;
+                result[i].binding = record.binding;
+                result[i].count = record.count;
+                result[i].unbounded = (record.flags & SHADER_REFLECTION_RESOURCE_UNBOUNDED) != 0;
+                result[i].size = record.size;
+                result[i].members = DecodeMembers(view, record.firstMember, record.memberCount);
+            }
+            return result;
+        }
+
+        std::vector<ShaderStageIOInfo> DecodeStageIO(const ShaderReflectionView& view, const ShaderReflectionRecords<ShaderReflectionStageIORecord>& records)
+        {
+            std::vector<ShaderStageIOInfo> result(records.size());
+            for (size_t i = 0; i < records.size(); ++i)
+            {
+                const ShaderReflectionStageIORecord record = records[i];
+                result[i].name = std::string(view.GetString(record.nameOffset, record.nameLength));
+                result[i].id = record.id;
+                result[i].location = record.location;
+                result[i].format = static_cast<IGNITE_VertexElementFormat>(record.format);
+                result[i].vecSize = record.vecSize;
+                result[i].columns = record.columns;
+                result[i].component = record.component;
+            }
+            return result;
+        }
+    }
+
+    std::vector<uint8_t> SerializeReflection(const ShaderReflectionInfo& info)
+    {
+        StringTable strings;
+        SectionBuilder builder;
+        std::vector<ShaderReflectionMemberRecord> members;
+
+        builder.Append(ShaderReflectionSectionKind::UniformBuffers, EncodeResources(info.uniformBuffers, strings, members));
+        builder.Append(ShaderReflectionSectionKind::SampledImages, EncodeResources(info.sampledImages, strings, members));
+        builder.Append(ShaderReflectionSectionKind::StorageImages, EncodeResources(info.storageImages, strings, members));
+        builder.Append(ShaderReflectionSectionKind::StorageBuffers, EncodeResources(info.storageBuffers, strings, members));
+        builder.Append(ShaderReflectionSectionKind::SeparateSamplers, EncodeResources(info.separateSamplers, strings, members));
+        builder.Append(ShaderReflectionSectionKind::SeparateImages, EncodeResources(info.separateImages, strings, members));
+
+        std::vector<ShaderReflectionPushConstantRecord> pushConstants(info.pushConstants.size());
+        for (size_t i = 0; i < info.pushConstants.size(); ++i)
+        {
+            pushConstants[i].nameOffset = strings.Add(info.pushConstants[i].name);
+            pushConstants[i].nameLength = static_cast<uint32_t>(info.pushConstants[i].name.size());
+            pushConstants[i].size = info.pushConstants[i].size;
+            pushConstants[i].firstMember = EncodeMembers(info.pushConstants[i].members, strings, members);
+            pushConstants[i].memberCount = static_cast<uint32_t>(info.pushConstants[i].members.size());
+        }
+        builder.Append(ShaderReflectionSectionKind::PushConstants, pushConstants);
+
+        builder.Append(ShaderReflectionSectionKind::StageInputs, EncodeStageIO(info.stageInputs, strings));
+        builder.Append(ShaderReflectionSectionKind::StageOutputs, EncodeStageIO(info.stageOutputs, strings));
+
+        std::vector<ShaderReflectionVertexAttributeRecord> attributes(info.vertexAttributes.size());
+        for (size_t i = 0; i < info.vertexAttributes.size(); ++i)
+        {
+            const VertexAttribute& source = info.vertexAttributes[i];
+            attributes[i].nameOffset = strings.Add(source.name);
+            attributes[i].nameLength = static_cast<uint32_t>(source.name.size());
+            attributes[i].format = static_cast<uint32_t>(source.format);
+            attributes[i].bufferIndex = source.bufferIndex;
+            attributes[i].offset = source.offset;
+            attributes[i].elementStride = source.elementStride;
+        }
+        builder.Append(ShaderReflectionSectionKind::VertexAttributes, attributes);
+        builder.Append(ShaderReflectionSectionKind::BufferMembers, members);
+
+        std::vector<ShaderReflectionSpecializationConstantRecord> constants(info.specializationConstants.size());
+        for (size_t i = 0; i < info.specializationConstants.size(); ++i)
+        {
+            const ShaderSpecializationConstant& source = info.specializationConstants[i];
+            constants[i].nameOffset = strings.Add(source.name);
+            constants[i].nameLength = static_cast<uint32_t>(source.name.size());
+            constants[i].id = source.id;
+            constants[i].constantId = source.constantId;
+            constants[i].type = static_cast<uint32_t>(source.type);
+            constants[i].defaultValueLow = static_cast<uint32_t>(source.defaultValue);
+            constants[i].defaultValueHigh = static_cast<uint32_t>(source.defaultValue >> 32);
+        }
+        builder.Append(ShaderReflectionSectionKind::SpecializationConstants, constants);
+
+        std::vector<ShaderReflectionComputeRecord> compute(1);
+        for (uint32_t dimension = 0; dimension < 3; ++dimension)
+        {
+            compute[0].localSize[dimension] = info.compute.localSize[dimension];
+            compute[0].localSizeSpecIds[dimension] = info.compute.localSizeSpecIds[dimension];
+            compute[0].specializedMask |= info.compute.localSizeSpecialized[dimension] ? 1u << dimension : 0u;
+        }
+        compute[0].sharedMemorySize = info.compute.sharedMemorySize;
+        builder.Append(ShaderReflectionSectionKind::Compute, compute);
+
+        std::vector<ShaderReflectionVertexBufferRecord> vertexBuffers(info.vertexBuffers.size());
+        for (size_t i = 0; i < info.vertexBuffers.size(); ++i)
+        {
+            vertexBuffers[i].bufferIndex = info.vertexBuffers[i].bufferIndex;
+            vertexBuffers[i].stride = info.vertexBuffers[i].stride;
+            vertexBuffers[i].inputRate = static_cast<uint32_t>(info.vertexBuffers[i].inputRate);
+            vertexBuffers[i].stepRate = info.vertexBuffers[i].stepRate;
+        }
+        builder.Append(ShaderReflectionSectionKind::VertexBuffers, vertexBuffers);
+
+        const std::vector<char>& stringData = strings.GetData();
+
+        ShaderReflectionBinaryHeader header = {};
+        header.magic = SHADER_REFLECTION_MAGIC;
+        header.version = SHADER_REFLECTION_VERSION;
+        header.shaderType = static_cast<uint32_t>(info.shaderType);
+        header.sectionCount = static_cast<uint32_t>(builder.sections.size());
+        header.sectionsOffset = sizeof(ShaderReflectionBinaryHeader);
+
+        const uint32_t recordsOffset = header.sectionsOffset + header.sectionCount * sizeof(ShaderReflectionSection);
+        header.stringsOffset = recordsOffset + static_cast<uint32_t>(builder.records.size());
+        header.stringsSize = static_cast<uint32_t>(stringData.size());
+        header.totalSize = (header.stringsOffset + header.stringsSize + 3u) & ~3u;
+
+        for (ShaderReflectionSection& section : builder.sections)
+        {
+            section.offset += recordsOffset;
+        }
+
+        std::vector<uint8_t> image(header.totalSize, 0);
+        std::memcpy(image.data(), &header, sizeof(header));
+        std::memcpy(image.data() + header.sectionsOffset, builder.sections.data(), builder.sections.size() * sizeof(ShaderReflectionSection));
+        if (!builder.records.empty())
+        {
+            std::memcpy(image.data() + recordsOffset, builder.records.data(), builder.records.size());
+        }
+        if (!stringData.empty())
+        {
+            std::memcpy(image.data() + header.stringsOffset, stringData.data(), stringData.size());
+        }
+        return image;
+    }
+
+    bool DeserializeReflection(const void* data, size_t size, ShaderReflectionInfo& outInfo)
+    {
+        ShaderReflectionView view;
+        if (!view.Attach(data, size))
+        {
+            return false;
+        }
+
+        ShaderReflectionInfo info = {};
+        info.shaderType = view.GetShaderType();
+        info.uniformBuffers = DecodeResources(view, ShaderReflectionSectionKind::UniformBuffers);
+        info.sampledImages = DecodeResources(view, ShaderReflectionSectionKind::SampledImages);
+        info.storageImages = DecodeResources(view, ShaderReflectionSectionKind::StorageImages);
+        info.storageBuffers = DecodeResources(view, ShaderReflectionSectionKind::StorageBuffers);
+        info.separateSamplers = DecodeResources(view, ShaderReflectionSectionKind::SeparateSamplers);
+        info.separateImages = DecodeResources(view, ShaderReflectionSectionKind::SeparateImages);
+
+        const ShaderReflectionRecords<ShaderReflectionPushConstantRecord> pushConstants = view.GetPushConstants();
+        info.pushConstants.resize(pushConstants.size());
+        for (size_t i = 0; i < pushConstants.size(); ++i)
+        {
+            const ShaderReflectionPushConstantRecord record = pushConstants[i];
+            info.pushConstants[i].name = std::string(view.GetString(record.nameOffset, record.nameLength));
+            info.pushConstants[i].size = record.size;
+            info.pushConstants[i].members = DecodeMembers(view, record.firstMember, record.memberCount);
+        }
+
+        info.stageInputs = DecodeStageIO(view, view.GetStageInputs());
+        info.stageOutputs = DecodeStageIO(view, view.GetStageOutputs());
+
+        const ShaderReflectionRecords<ShaderReflectionVertexAttributeRecord> attributes = view.GetVertexAttributes();
+        info.vertexAttributes.resize(attributes.size());
+        for (size_t i = 0; i < attributes.size(); ++i)
+        {
+            const ShaderReflectionVertexAttributeRecord record = attributes[i];
+            VertexAttribute& attribute = info.vertexAttributes[i];
+            attribute.name = std::string(view.GetString(record.nameOffset, record.nameLength));
+            attribute.format = static_cast<IGNITE_VertexElementFormat>(record.format);
+            attribute.bufferIndex = record.bufferIndex;
+            attribute.offset = record.offset;
+            attribute.elementStride = record.elementStride;
+        }
+
+        const ShaderReflectionRecords<ShaderReflectionVertexBufferRecord> vertexBuffers = view.GetVertexBuffers();
+        info.vertexBuffers.resize(vertexBuffers.size());
+        for (size_t i = 0; i < vertexBuffers.size(); ++i)
+        {
+            const ShaderReflectionVertexBufferRecord record = vertexBuffers[i];
+            info.vertexBuffers[i].bufferIndex = record.bufferIndex;
+            info.vertexBuffers[i].stride = record.stride;
+            info.vertexBuffers[i].inputRate = static_cast<IGNITE_VertexInputRate>(record.inputRate);
+            info.vertexBuffers[i].stepRate = record.stepRate;
+        }
+
+        const ShaderReflectionRecords<ShaderReflectionSpecializationConstantRecord> constants = view.GetSpecializationConstants();
+        info.specializationConstants.resize(constants.size());
+        for (size_t i = 0; i < constants.size(); ++i)
+        {
+            const ShaderReflectionSpecializationConstantRecord record = constants[i];
+            ShaderSpecializationConstant& constant = info.specializationConstants[i];
+            constant.name = std::string(view.GetString(record.nameOffset, record.nameLength));
+            constant.id = record.id;
+            constant.constantId = record.constantId;
+            constant.type = static_cast<IGNITE_ShaderDataType>(record.type);
+            constant.defaultValue = (uint64_t(record.defaultValueHigh) << 32) | record.defaultValueLow;
+        }
+
+        const ShaderReflectionRecords<ShaderReflectionComputeRecord> compute = view.GetCompute();
+        if (!compute.empty())
+        {
+            const ShaderReflectionComputeRecord record = compute[0];
+            for (uint32_t dimension = 0; dimension < 3; ++dimension)
+            {
+                info.compute.localSize[dimension] = record.localSize[dimension];
+                info.compute.localSizeSpecIds[dimension] = record.localSizeSpecIds[dimension];
+                info.compute.localSizeSpecialized[dimension] = (record.specializedMask & (1u << dimension)) != 0;
+            }
+            info.compute.sharedMemorySize = record.sharedMemorySize;
+        }
+
+        info.numUniformBuffers = info.uniformBuffers.size();
+        info.numSamplers = info.sampledImages.size();
+        info.numStorageTextures = info.storageImages.size();
+        info.numStorageBuffers = info.storageBuffers.size();
+        info.numSeparateSamplers = info.separateSamplers.size();
+        info.numSeparateImages = info.separateImages.size();
+        info.numPushConstants = info.pushConstants.size();
+        info.numStageInputs = info.stageInputs.size();
+        info.numStageOutputs = info.stageOutputs.size();
+        info.numSpecializationConstants = info.specializationConstants.size();
+
+        outInfo = std::move(info);
+        return true;
+    }
+
+    bool ShaderReflectionView::Attach(const void* data, size_t size)
+    {
+        m_data = nullptr;
+        m_header = nullptr;
+        m_sections = nullptr;
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        if (!bytes || size < sizeof(ShaderReflectionBinaryHeader) || reinterpret_cast<uintptr_t>(bytes) % alignof(uint32_t) != 0)
+        {
+            return false;
+        }
+
+        const ShaderReflectionBinaryHeader* header = reinterpret_cast<const ShaderReflectionBinaryHeader*>(bytes);
+        if (header->magic != SHADER_REFLECTION_MAGIC || header->version != SHADER_REFLECTION_VERSION || header->totalSize > size)
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Reflection binary: bad header or unsupported version.");
+            return false;
+        }
+
+        const uint64_t totalSize = header->totalSize;
+        const uint64_t sectionsEnd = uint64_t(header->sectionsOffset) + uint64_t(header->sectionCount) * sizeof(ShaderReflectionSection);
+        const uint64_t stringsEnd = uint64_t(header->stringsOffset) + header->stringsSize;
+        if (header->sectionsOffset % alignof(uint32_t) != 0 || sectionsEnd > totalSize || stringsEnd > totalSize
+            || (header->stringsSize > 0 && bytes[stringsEnd - 1] != '\0'))
+        {
+            DispatchLog(IGNITE_LOG_TYPE_ERROR, "Reflection binary: section table or string table out of bounds.");
+            return false;
+        }
+
+        const ShaderReflectionSection* sections = reinterpret_cast<const ShaderReflectionSection*>(bytes + header->sectionsOffset);
+        for (uint32_t i = 0; i < header->sectionCount; ++i)
+        {
+            const ShaderReflectionSection& section = sections[i];
+            const uint64_t end = uint64_t(section.offset) + uint64_t(section.count) * section.recordSize;
+            if (section.offset % alignof(uint32_t) != 0 || end > totalSize || (section.count > 0 && section.recordSize == 0))
+            {
+                DispatchLog(IGNITE_LOG_TYPE_ERROR, "Reflection binary: section " + std::to_string(section.kind) + " out of bounds.");
+                return false;
+            }
+        }
+
+        m_data = bytes;
+        m_header = header;
+        m_sections = sections;
+        return true;
+    }
+
+    IGNITE_ShaderType ShaderReflectionView::GetShaderType() const
+    {
+        return m_header ? static_cast<IGNITE_ShaderType>(m_header->shaderType) : IGNITE_SHADER_TYPE_VERTEX;
+    }
+
+    const ShaderReflectionSection* ShaderReflectionView::FindSection(ShaderReflectionSectionKind kind) const
+    {
+        if (!m_header)
+        {
+            return nullptr;
+        }
+
+        // Sections are written in kind order, so the direct slot is checked before scanning.
+        const uint32_t index = static_cast<uint32_t>(kind);
+        if (index < m_header->sectionCount && m_sections[index].kind == index)
+        {
+            return &m_sections[index];
+        }
+
+        for (uint32_t i = 0; i < m_header->sectionCount; ++i)
+        {
+            if (m_sections[i].kind == index)
+            {
+                return &m_sections[i];
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename Record>
+    ShaderReflectionRecords<Record> ShaderReflectionView::GetRecords(ShaderReflectionSectionKind kind) const
+    {
+        const ShaderReflectionSection* section = FindSection(kind);
+        if (!section || section->count == 0)
+        {
+            return {};
+        }
+        return ShaderReflectionRecords<Record>(m_data + section->offset, section->count, section->recordSize);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionResourceRecord> ShaderReflectionView::GetResources(ShaderReflectionSectionKind kind) const
+    {
+        switch (kind)
+        {
+        case ShaderReflectionSectionKind::UniformBuffers:
+        case ShaderReflectionSectionKind::SampledImages:
+        case ShaderReflectionSectionKind::StorageImages:
+        case ShaderReflectionSectionKind::StorageBuffers:
+        case ShaderReflectionSectionKind::SeparateSamplers:
+        case ShaderReflectionSectionKind::SeparateImages:
+            return GetRecords<ShaderReflectionResourceRecord>(kind);
+        default:
+            return {};
+        }
+    }
+
+    ShaderReflectionRecords<ShaderReflectionPushConstantRecord> ShaderReflectionView::GetPushConstants() const
+    {
+        return GetRecords<ShaderReflectionPushConstantRecord>(ShaderReflectionSectionKind::PushConstants);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionStageIORecord> ShaderReflectionView::GetStageInputs() const
+    {
+        return GetRecords<ShaderReflectionStageIORecord>(ShaderReflectionSectionKind::StageInputs);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionStageIORecord> ShaderReflectionView::GetStageOutputs() const
+    {
+        return GetRecords<ShaderReflectionStageIORecord>(ShaderReflectionSectionKind::StageOutputs);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionVertexAttributeRecord> ShaderReflectionView::GetVertexAttributes() const
+    {
+        return GetRecords<ShaderReflectionVertexAttributeRecord>(ShaderReflectionSectionKind::VertexAttributes);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionVertexBufferRecord> ShaderReflectionView::GetVertexBuffers() const
+    {
+        return GetRecords<ShaderReflectionVertexBufferRecord>(ShaderReflectionSectionKind::VertexBuffers);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionSpecializationConstantRecord> ShaderReflectionView::GetSpecializationConstants() const
+    {
+        return GetRecords<ShaderReflectionSpecializationConstantRecord>(ShaderReflectionSectionKind::SpecializationConstants);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionComputeRecord> ShaderReflectionView::GetCompute() const
+    {
+        return GetRecords<ShaderReflectionComputeRecord>(ShaderReflectionSectionKind::Compute);
+    }
+
+    ShaderReflectionRecords<ShaderReflectionMemberRecord> ShaderReflectionView::GetBufferMembers(uint32_t firstMember, uint32_t memberCount) const
+    {
+        return GetRecords<ShaderReflectionMemberRecord>(ShaderReflectionSectionKind::BufferMembers).Slice(firstMember, memberCount);
+    }
+
+    std::string_view ShaderReflectionView::GetString(uint32_t offset, uint32_t length) const
+    {
+        if (!m_header || uint64_t(offset) + length >= m_header->stringsSize)
+        {
+            return {};
+        }
+        return std::string_view(reinterpret_cast<const char*>(m_data + m_header->stringsOffset + offset), length);
+    }
+}
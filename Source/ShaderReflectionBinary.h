@@ -0,0 +1,260 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_REFLECTION_BINARY_H
+#define _SHADER_REFLECTION_BINARY_H
+
+#pragma once
+
+#include "ShaderCompiler.h"
+
+#include <string_view>
+
+namespace ignite
+{
+    /*
+     * Position-independent binary encoding of ShaderReflectionInfo.
+     *
+     * Layout (little-endian, 4-byte aligned):
+     *   ShaderReflectionBinaryHeader
+     *   ShaderReflectionSection[sectionCount]   one per record kind
+     *   records                                 fixed-size, grouped by section
+     *   char strings[stringsSize]               names, referenced by (offset, length), null-terminated
+     *
+     * Readers look sections up by kind and honour recordSize, so newer writers may
+     * append record fields or sections without breaking older readers. The version
+     * only changes for incompatible layouts.
+     */
+
+    constexpr uint32_t SHADER_REFLECTION_MAGIC = 0x4C465249; // "IRFL"
+    constexpr uint32_t SHADER_REFLECTION_VERSION = 1;
+
+    enum class ShaderReflectionSectionKind : uint32_t
+    {
+        UniformBuffers = 0,
+        SampledImages,
+        StorageImages,
+        StorageBuffers,
+        SeparateSamplers,
+        SeparateImages,
+        PushConstants,
+        StageInputs,
+        StageOutputs,
+        VertexAttributes,
+        BufferMembers,
+        SpecializationConstants,
+        Compute,
+        VertexBuffers,
+        Count
+    };
+
+    struct ShaderReflectionBinaryHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t shaderType;
+        uint32_t sectionCount;
+        uint32_t sectionsOffset;
+        uint32_t stringsOffset;
+        uint32_t stringsSize;
+        uint32_t totalSize;
+    };
+    static_assert(sizeof(ShaderReflectionBinaryHeader) == 32, "ShaderReflectionBinaryHeader layout changed");
+
+    struct ShaderReflectionSection
+    {
+        uint32_t kind;
+        uint32_t recordSize;
+        uint32_t offset;
+        uint32_t count;
+    };
+    static_assert(sizeof(ShaderReflectionSection) == 16, "ShaderReflectionSection layout changed");
+
+    struct ShaderReflectionResourceRecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t id;
+        uint32_t set;
+        uint32_t binding;
+        uint32_t count;
+        uint32_t size;
+        uint32_t firstMember; // index into the BufferMembers section
+        uint32_t memberCount;
+        uint32_t flags; // SHADER_REFLECTION_RESOURCE_*
+    };
+    static_assert(sizeof(ShaderReflectionResourceRecord) == 40, "ShaderReflectionResourceRecord layout changed");
+
+    constexpr uint32_t SHADER_REFLECTION_RESOURCE_UNBOUNDED = 1u << 0;
+
+    struct ShaderReflectionPushConstantRecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t size;
+        uint32_t firstMember;
+        uint32_t memberCount;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(ShaderReflectionPushConstantRecord) == 24, "ShaderReflectionPushConstantRecord layout changed");
+
+    struct ShaderReflectionStageIORecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t id;
+        uint32_t location;
+        uint32_t format;
+        uint32_t vecSize;
+        uint32_t columns;
+        uint32_t component;
+    };
+    static_assert(sizeof(ShaderReflectionStageIORecord) == 32, "ShaderReflectionStageIORecord layout changed");
+
+    struct ShaderReflectionVertexAttributeRecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t format;
+        uint32_t bufferIndex;
+        uint32_t offset;
+        uint32_t elementStride;
+    };
+    static_assert(sizeof(ShaderReflectionVertexAttributeRecord) == 24, "ShaderReflectionVertexAttributeRecord layout changed");
+
+    struct ShaderReflectionVertexBufferRecord
+    {
+        uint32_t bufferIndex;
+        uint32_t stride;
+        uint32_t inputRate; // IGNITE_VertexInputRate
+        uint32_t stepRate;
+    };
+    static_assert(sizeof(ShaderReflectionVertexBufferRecord) == 16, "ShaderReflectionVertexBufferRecord layout changed");
+
+    constexpr uint32_t SHADER_REFLECTION_MEMBER_ROW_MAJOR = 1u << 0;
+
+    struct ShaderReflectionMemberRecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t type; // IGNITE_ShaderDataType
+        uint32_t offset;
+        uint32_t size;
+        uint32_t vecSize;
+        uint32_t columns;
+        uint32_t arraySize;
+        uint32_t arrayStride;
+        uint32_t matrixStride;
+        uint32_t depth;
+        uint32_t flags; // SHADER_REFLECTION_MEMBER_*
+    };
+    static_assert(sizeof(ShaderReflectionMemberRecord) == 48, "ShaderReflectionMemberRecord layout changed");
+
+    struct ShaderReflectionSpecializationConstantRecord
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t id;
+        uint32_t constantId;
+        uint32_t type; // IGNITE_ShaderDataType
+        uint32_t defaultValueLow;
+        uint32_t defaultValueHigh;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(ShaderReflectionSpecializationConstantRecord) == 32, "ShaderReflectionSpecializationConstantRecord layout changed");
+
+    // Bit i of specializedMask: localSize[i] comes from specialization constant localSizeSpecIds[i].
+    struct ShaderReflectionComputeRecord
+    {
+        uint32_t localSize[3];
+        uint32_t localSizeSpecIds[3];
+        uint32_t specializedMask;
+        uint32_t sharedMemorySize;
+    };
+    static_assert(sizeof(ShaderReflectionComputeRecord) == 32, "ShaderReflectionComputeRecord layout changed");
+
+    // Strided, read-only range of records inside an encoded blob. Elements are returned
+    // by value so records written with a different recordSize still read correctly
+    // (missing trailing fields read as zero).
+    template<typename Record>
+    class ShaderReflectionRecords
+    {
+    public:
+        ShaderReflectionRecords() = default;
+        ShaderReflectionRecords(const uint8_t* data, uint32_t count, uint32_t recordSize)
+            : m_data(data), m_count(count), m_recordSize(recordSize)
+        {
+        }
+
+        size_t size() const { return m_count; }
+        bool empty() const { return m_count == 0; }
+
+        // Sub-range [first, first + count), clamped to this range.
+        ShaderReflectionRecords Slice(uint32_t first, uint32_t count) const
+        {
+            if (first >= m_count)
+            {
+                return {};
+            }
+            return ShaderReflectionRecords(m_data + size_t(first) * m_recordSize, count < m_count - first ? count : m_count - first, m_recordSize);
+        }
+
+        Record operator[](size_t index) const
+        {
+            Record record = {};
+            std::memcpy(&record, m_data + index * m_recordSize, m_recordSize < sizeof(Record) ? m_recordSize : sizeof(Record));
+            return record;
+        }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        uint32_t m_count = 0;
+        uint32_t m_recordSize = 0;
+    };
+
+    // Encodes reflection into the binary format.
+    IGNITECOMPILER_API std::vector<uint8_t> SerializeReflection(const ShaderReflectionInfo& info);
+
+    // Decodes an encoded blob back into the owning structure. Returns false if malformed.
+    IGNITECOMPILER_API bool DeserializeReflection(const void* data, size_t size, ShaderReflectionInfo& outInfo);
+
+    // Zero-copy reader over an encoded blob (for example a mapped file or an archive entry's
+    // reflection bytes). The memory must stay alive and 4-byte aligned while the view is used.
+    class IGNITECOMPILER_API ShaderReflectionView
+    {
+    public:
+        ShaderReflectionView() = default;
+
+        // Validates header, section bounds and the string table; returns false if malformed.
+        bool Attach(const void* data, size_t size);
+
+        bool IsValid() const { return m_header != nullptr; }
+        IGNITE_ShaderType GetShaderType() const;
+
+        ShaderReflectionRecords<ShaderReflectionResourceRecord> GetResources(ShaderReflectionSectionKind kind) const;
+        ShaderReflectionRecords<ShaderReflectionPushConstantRecord> GetPushConstants() const;
+        ShaderReflectionRecords<ShaderReflectionStageIORecord> GetStageInputs() const;
+        ShaderReflectionRecords<ShaderReflectionStageIORecord> GetStageOutputs() const;
+        ShaderReflectionRecords<ShaderReflectionVertexAttributeRecord> GetVertexAttributes() const;
+        ShaderReflectionRecords<ShaderReflectionVertexBufferRecord> GetVertexBuffers() const;
+        ShaderReflectionRecords<ShaderReflectionSpecializationConstantRecord> GetSpecializationConstants() const;
+        ShaderReflectionRecords<ShaderReflectionComputeRecord> GetCompute() const; // a single record
+
+        // Members of one buffer or push constant block, from its (firstMember, memberCount).
+        ShaderReflectionRecords<ShaderReflectionMemberRecord> GetBufferMembers(uint32_t firstMember, uint32_t memberCount) const;
+
+        // Resolves a (nameOffset, nameLength) pair; empty view when out of range.
+        std::string_view GetString(uint32_t offset, uint32_t length) const;
+
+    private:
+        const ShaderReflectionSection* FindSection(ShaderReflectionSectionKind kind) const;
+
+        template<typename Record>
+        ShaderReflectionRecords<Record> GetRecords(ShaderReflectionSectionKind kind) const;
+
+        const uint8_t* m_data = nullptr;
+        const ShaderReflectionBinaryHeader* m_header = nullptr;
+        const ShaderReflectionSection* m_sections = nullptr;
+    };
+}
+
+#endif
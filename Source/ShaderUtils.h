@@ -0,0 +1,40 @@
+// Copyright (c) 2026 Evangelion Manuhutu
+
+#ifndef _SHADER_UTILS_H
+#define _SHADER_UTILS_H
+
+#pragma once
+
+#include "ShaderBase.h"
+
+namespace ignite
+{
+    // Internal: helpers shared by the library translation units. Not installed.
+
+    // Rounds value up to a multiple of alignment; alignments of 0 and 1 leave it unchanged.
+    template<typename T>
+    constexpr T AlignUp(T value, T alignment)
+    {
+        return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+    }
+
+    // D3D register class of a descriptor type: 'b' constant buffers, 't' read-only resources,
+    // 'u' read-write resources, 's' samplers. DXIL reflection keeps the register number as the
+    // binding, so DXIL bindings are only unique within one class.
+    inline char DescriptorRegisterClass(IGNITE_DescriptorType type)
+    {
+        switch (type)
+        {
+        case IGNITE_DESCRIPTOR_TYPE_UNIFORM_BUFFER: return 'b';
+        case IGNITE_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case IGNITE_DESCRIPTOR_TYPE_STORAGE_IMAGE: return 'u';
+        case IGNITE_DESCRIPTOR_TYPE_SAMPLER: return 's';
+        case IGNITE_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case IGNITE_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        default:
+            return 't';
+        }
+    }
+}
+
+#endif